@@ -1,10 +1,15 @@
 ﻿
 
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <ostream>
+#include <string>
 
+#include "DirectCodeGenerator.h"
 #include "ExprLexer.h"
 #include "ExprParser.h"
+#include "GeneratedParseTable.h"
 #include "IMessageHandler.h"
 
 struct MessageHandle : public IMessageHandler
@@ -23,9 +28,30 @@ struct MessageHandle : public IMessageHandler
 	}
 };
 
-int main(void)
+//
+// ExampleExpr -direct <directory>
+//
+// Write ExprParserdirect.h, the terminal actions of the parser coded as
+// switch blocks (see DirectCodeGenerator), to directory. Run it again
+// whenever ExprParserprs.h is regenerated.
+//
+static int writeDirectCode(const std::string& directory)
 {
-    
+    std::ofstream out(directory + "/ExprParserdirect.h");
+    GeneratedParseTable<ExprParserprs> table;
+    if (!out || !DirectCodeGenerator::generate(&table, "ExprParserprs", "ExprParserdirect", out))
+    {
+        std::cout << "Cannot write " << directory << "/ExprParserdirect.h" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 2 && strcmp(argv[1], "-direct") == 0)
+        return writeDirectCode(argv[2]);
+
     int idd = 2;
     MessageHandle  handle;
   
@@ -1,9 +1,9 @@
 
-    //#line 122 "LexerTemplateD.g
+    //#line 140 "LexerTemplateD.g
 
 
 
-    //#line 128 "LexerTemplateD.g
+    //#line 146 "LexerTemplateD.g
 
 
 #pragma once  
@@ -11,6 +11,7 @@
 #include <iostream>
 #include "IPrsStream.h"
 #include "Object.h"
+#include "GeneratedParseTable.h"
 #include "ParseTable.h"
 #include "RuleAction.h"
 #include "stringex.h"
@@ -19,20 +20,22 @@
 #include "ExprLexerprs.h"
 #include "ExprParsersym.h"
 #include "LexParser.h"
+#include "LexParserT.h"
 #include "LpgLexStream.h"
 
  struct ExprLexer :public LpgLexStream ,public ExprParsersym, public ExprLexersym,public RuleAction
 {
-    inline  static ParseTable* prs = new ExprLexerprs();
+    inline  static ParseTable* prs = new GeneratedParseTable<ExprLexerprs>();
 
     ~ExprLexer(){
         delete lexParser;
     }
      ParseTable* getParseTable() { return prs; }
 
-     LexParser* lexParser = new LexParser(this, prs, this);
+     LexParser* lexParser = new LexParserT<ExprLexer, ExprLexerprs, ExprLexer>(this, prs, this);
      LexParser* getParser() { return lexParser; }
 
+     using LpgLexStream::getToken; // the lexer is its own stream
      int getToken(int i) { return lexParser->getToken(i); }
      int getRhsFirstTokenIndex(int i) { return lexParser->getFirstToken(i); }
      int getRhsLastTokenIndex(int i) { return lexParser->getLastToken(i); }
@@ -143,9 +146,25 @@
         					  Char_Unused);
     }
 
-    //#line 248 "LexerTemplateD.g
+    //#line 269 "LexerTemplateD.g
 
      void ruleAction(int ruleNumber)
+    {
+        ruleAction<false>(ruleNumber, nullptr);
+    }
+
+     const unsigned char* getRuleActionMap()
+    {
+        static const std::vector<unsigned char> map = findRuleActions(this, ExprLexerprs::NUM_RULES);
+        return map.data();
+    }
+
+    //
+    // The actions of the rules, or, with probe, whether a rule has one
+    // (see findRuleActions).
+    //
+     template <bool probe>
+     void ruleAction(int ruleNumber, bool* found)
     {
         switch(ruleNumber)
         {
@@ -153,7 +172,8 @@
             //
             // Rule 1:  Token ::= IntegerLiteral
             //
-            case 1: { 
+            case 1: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(ExprParsersym::TK_IntegerLiteral);
                 break;
             }
@@ -161,7 +181,8 @@
             //
             // Rule 2:  Token ::= +
             //
-            case 2: { 
+            case 2: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(ExprParsersym::TK_PLUS);
                 break;
             }
@@ -169,7 +190,8 @@
             //
             // Rule 3:  Token ::= *
             //
-            case 3: { 
+            case 3: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(ExprParsersym::TK_MULTIPLY);
                 break;
             }
@@ -177,7 +199,8 @@
             //
             // Rule 4:  Token ::= (
             //
-            case 4: { 
+            case 4: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(ExprParsersym::TK_LPAREN);
                 break;
             }
@@ -185,12 +208,13 @@
             //
             // Rule 5:  Token ::= )
             //
-            case 5: { 
+            case 5: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(ExprParsersym::TK_RPAREN);
                 break;
             }
     
-    //#line 252 "LexerTemplateD.g
+    //#line 273 "LexerTemplateD.g
 
     
             default:
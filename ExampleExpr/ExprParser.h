@@ -1,18 +1,19 @@
 
-//#line 156 "dtParserTemplateD.g
+//#line 176 "dtParserTemplateD.g
 
 
 
-//#line 162 "dtParserTemplateD.g
+//#line 182 "dtParserTemplateD.g
 
 
 #include <iostream>
 
 #include "ExprParserprs.h"
-#include "DeterministicParser.h"
+#include "DeterministicParserT.h"
 #include "diagnose.h"
 #include "ErrorToken.h"
 #include "Exception.h"
+#include "GeneratedParseTable.h"
 #include "IAbstractArrayList.h"
 #include "IAst.h"
 #include "ILexStream.h"
@@ -28,7 +29,7 @@ struct ExprParser :public PrsStream, public RuleAction
     bool unimplementedSymbolsWarning = false;
 
 
-    inline static ParseTable* prs = new ExprParserprs();
+    inline static ParseTable* prs = new GeneratedParseTable<ExprParserprs>();
     ParseTable* getParseTable() { return prs; }
 
     DeterministicParser* dtParser = nullptr;
@@ -101,7 +102,7 @@ struct ExprParser :public PrsStream, public RuleAction
 
         try
         {
-            dtParser = new DeterministicParser(this, prs, this);
+            dtParser = new DeterministicParserT<ExprParserprs, ExprParser>(this, prs, this);
         }
         catch (NotDeterministicParseTableException& e)
         {
@@ -158,9 +159,25 @@ struct ExprParser :public PrsStream, public RuleAction
     //
 
 
-    //#line 318 "dtParserTemplateD.g
+    //#line 339 "dtParserTemplateD.g
 
     void ruleAction(int ruleNumber)
+    {
+        ruleAction<false>(ruleNumber, nullptr);
+    }
+
+    const unsigned char* getRuleActionMap()
+    {
+        static const std::vector<unsigned char> map = findRuleActions(this, ExprParserprs::NUM_RULES);
+        return map.data();
+    }
+
+    //
+    // The actions of the rules, or, with probe, whether a rule has one
+    // (see findRuleActions).
+    //
+    template <bool probe>
+    void ruleAction(int ruleNumber, bool* found)
     {
         switch (ruleNumber)
         {
@@ -170,6 +187,7 @@ struct ExprParser :public PrsStream, public RuleAction
             // Rule 1:  E ::= E + T
             //
         case 1: {
+            if constexpr (probe) { *found = true; break; }
             setResult(
                 //#line 13 ExprParser.g
                 _automatic_ast_pool << new E(getLeftIToken(), getRightIToken(),
@@ -190,6 +208,7 @@ struct ExprParser :public PrsStream, public RuleAction
             // Rule 3:  T ::= T * F
             //
         case 3: {
+            if constexpr (probe) { *found = true; break; }
             setResult(
                 //#line 15 ExprParser.g
                 _automatic_ast_pool << new T(getLeftIToken(), getRightIToken(),
@@ -210,6 +229,7 @@ struct ExprParser :public PrsStream, public RuleAction
             // Rule 5:  F ::= IntegerLiteral
             //
         case 5: {
+            if constexpr (probe) { *found = true; break; }
             setResult(
                 //#line 17 ExprParser.g
                 _automatic_ast_pool << new F(getRhsIToken(1))
@@ -221,6 +241,7 @@ struct ExprParser :public PrsStream, public RuleAction
               // Rule 6:  F ::= ( E )
               //
         case 6: {
+            if constexpr (probe) { *found = true; break; }
             setResult(
                 //#line 18 ExprParser.g
                 _automatic_ast_pool << new ParenExpr(getLeftIToken(), getRightIToken(),
@@ -230,7 +251,7 @@ struct ExprParser :public PrsStream, public RuleAction
             );
             break;
         }
-              //#line 322 "dtParserTemplateD.g
+              //#line 343 "dtParserTemplateD.g
 
 
         default:
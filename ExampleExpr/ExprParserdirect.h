@@ -0,0 +1,77 @@
+#pragma once
+#include "GeneratedParseTable.h"
+#include "ExprParserprs.h"
+
+//
+// Direct-coded terminal actions of ExprParserprs, written by
+// DirectCodeGenerator. Do not edit: regenerate it with the table.
+//
+struct ExprParserdirect :public GeneratedParseTable<ExprParserprs>
+{
+    constexpr static bool DIRECT_CODED = true;
+
+    static int directTAction(int state, int sym)
+    {
+        switch (state)
+        {
+            case 7:
+            case 11:
+            case 15:
+            case 18:
+                switch (sym)
+                {
+                    case 3: return 31;
+                    case 4: return 11;
+                    default: return 26;
+                }
+            case 20:
+                switch (sym)
+                {
+                    case 1: return 15;
+                    case 6: return 25;
+                    default: return 26;
+                }
+            case 22:
+                switch (sym)
+                {
+                    case 1: return 15;
+                    case 5: return 32;
+                    default: return 26;
+                }
+            case 21:
+                switch (sym)
+                {
+                    case 2: return 18;
+                    default: return 2;
+                }
+            case 23:
+                switch (sym)
+                {
+                    case 2: return 18;
+                    default: return 1;
+                }
+            default:
+            {
+                int i = _baseAction[state],
+                    k = i + sym;
+                return _termAction[_termCheck[k] == sym ? k : i];
+            }
+        }
+    }
+
+    static int directLookAhead(int la_state, int sym)
+    {
+        switch (la_state)
+        {
+            default:
+            {
+                int k = la_state + sym;
+                return _termAction[_termCheck[k] == sym ? k : la_state];
+            }
+        }
+    }
+
+    int tAction(int state, int sym) override { return directTAction(state, sym); }
+
+    int lookAhead(int la_state, int sym) override { return directLookAhead(la_state, sym); }
+};
@@ -69,7 +69,8 @@
 
     $DefaultAction
     /. $Header
-                case $rule_number: { ./
+                case $rule_number: {
+                    if constexpr (probe) { *found = true; break; } ./
 
     $BeginAction /.$DefaultAction./
 
@@ -91,6 +92,22 @@
     $BeginActions
     /.
          void ruleAction(int ruleNumber)
+        {
+            ruleAction<false>(ruleNumber, nullptr);
+        }
+
+         const unsigned char* getRuleActionMap()
+        {
+            static const std::vector<unsigned char> map = findRuleActions(this, $prs_type::NUM_RULES);
+            return map.data();
+        }
+
+        //
+        // The actions of the rules, or, with probe, whether a rule has one
+        // (see findRuleActions).
+        //
+         template <bool probe>
+         void ruleAction(int ruleNumber, bool* found)
         {
             switch(ruleNumber)
             {./
@@ -98,13 +115,14 @@
     $SplitActions
     /.
                     default:
-                        ruleAction$rule_number(ruleNumber);
+                        ruleAction$rule_number<probe>(ruleNumber, found);
                         break;
                 }
                 return;
             }
 
-             void ruleAction$rule_number(int ruleNumber)
+             template <bool probe>
+             void ruleAction$rule_number(int ruleNumber, bool* found)
             {
                 switch (ruleNumber)
                 {./
@@ -132,6 +150,7 @@
 #include <iostream>
 #include "IPrsStream.h"
 #include "Object.h"
+#include "GeneratedParseTable.h"
 #include "ParseTable.h"
 #include "RuleAction.h"
 #include "stringex.h"
@@ -139,20 +158,22 @@
 #include "$sym_type.h"
 #include "$prs_type.h"
 #include "LexParser.h"
+#include "LexParserT.h"
 #include "LpgLexStream.h"
 
      struct $action_type :public $super_stream_class ,public $exp_type, public $sym_type,public RuleAction$additional_interfaces
     {
-        inline  static ParseTable* prs = new $prs_type();
+        inline  static ParseTable* prs = new GeneratedParseTable<$prs_type>();
 
         ~$action_type(){
             delete lexParser;
         }
          ParseTable* getParseTable() { return prs; }
 
-         LexParser* lexParser = new LexParser(this, prs, this);
+         LexParser* lexParser = new LexParserT<$action_type, $prs_type, $action_type>(this, prs, this);
          LexParser* getParser() { return lexParser; }
 
+         using $super_stream_class::getToken; // the lexer is its own stream
          int getToken(int i) { return lexParser->getToken(i); }
          int getRhsFirstTokenIndex(int i) { return lexParser->getFirstToken(i); }
          int getRhsLastTokenIndex(int i) { return lexParser->getLastToken(i); }
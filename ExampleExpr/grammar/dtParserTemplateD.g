@@ -33,7 +33,8 @@
 
     $BeginAction
     /. $Header
-                case $rule_number: {./
+                case $rule_number: {
+                    if constexpr (probe) { *found = true; break; }./
 
     $EndAction
     /.          break;
@@ -53,17 +54,35 @@
     $BadAction
     /. $Header
                 case $rule_number:
+                    if constexpr (probe) { *found = true; break; }
                     throw  std::exeption("No action specified for rule " + $rule_number);./
 
     $NullAction
     /. $Header
                 case $rule_number:
+                    if constexpr (probe) { *found = true; break; }
                     setResult(nullptr);
                     break;./
 
     $BeginActions
     /.
          void ruleAction(int ruleNumber)
+        {
+            ruleAction<false>(ruleNumber, nullptr);
+        }
+
+         const unsigned char* getRuleActionMap()
+        {
+            static const std::vector<unsigned char> map = findRuleActions(this, $prs_type::NUM_RULES);
+            return map.data();
+        }
+
+        //
+        // The actions of the rules, or, with probe, whether a rule has one
+        // (see findRuleActions).
+        //
+         template <bool probe>
+         void ruleAction(int ruleNumber, bool* found)
         {
             switch (ruleNumber)
             {./
@@ -71,13 +90,14 @@
     $SplitActions
     /.
 	            default:
-	                ruleAction$rule_number(ruleNumber);
+	                ruleAction$rule_number<probe>(ruleNumber, found);
 	                break;
 	        }
 	        return;
 	    }
 	
-	     void ruleAction$rule_number(int ruleNumber)
+	     template <bool probe>
+	     void ruleAction$rule_number(int ruleNumber, bool* found)
 	    {
 	        switch (ruleNumber)
 	        {./
@@ -164,10 +184,11 @@
 #include <iostream>
 
 #include "ExprParserprs.h"
-#include "DeterministicParser.h"
+#include "DeterministicParserT.h"
 #include "diagnose.h"
 #include "ErrorToken.h"
 #include "Exception.h"
+#include "GeneratedParseTable.h"
 #include "IAbstractArrayList.h"
 #include "IAst.h"
 #include "ILexStream.h"
@@ -181,7 +202,7 @@
          bool unimplementedSymbolsWarning = $unimplemented_symbols_warning;
  
 
-        inline static ParseTable* prs = new $prs_type();
+        inline static ParseTable* prs = new GeneratedParseTable<$prs_type>();
          ParseTable* getParseTable() { return prs; }
 
          DeterministicParser* dtParser = nullptr;
@@ -254,7 +275,7 @@
             
             try
             {
-                dtParser = new DeterministicParser(this, prs, this);
+                dtParser = new DeterministicParserT<$prs_type, $action_type>(this, prs, this);
             }
             catch (NotDeterministicParseTableException& e)
             {
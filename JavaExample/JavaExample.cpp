@@ -1,14 +1,366 @@
 ﻿// JavaExample.cpp : 此文件包含 "main" 函数。程序执行将在此处开始并结束。
 //
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "BinaryParseTable.h"
+#include "DenseActionRows.h"
+#include "DirectCodeGenerator.h"
+#include "GeneratedParseTable.h"
+#include "IcuUtil.h"
 #include "JavaLexer.h"
 #include "JavaParser.h"
 #include "JavaParser_top_level_ast.h"
+#include "ParallelLexer.h"
+#include "ParseTableLayout.h"
+#include "ParseTableProfile.h"
+#include "PipelinedLexer.h"
+#include "PullLexer.h"
 
-int main()
+//
+// JavaExample -bench <file.java> [repetitions] [dense KB]
+//
+// Time the parser alone (the input is lexed again before each repetition).
+// Build the example with and without LPG_FUSED_STACKS to compare the two
+// layouts of the parse stack (see Stacks.h). With a dense KB budget, the
+// terminal actions of the parser are first expanded into dense rows of that
+// size (see DenseActionRows).
+//
+static int benchmark(const char* file, int repetitions, int dense_kb)
+{
+    if (dense_kb > 0)
+        DenseActionRows::install(JavaParser::prsTable,
+                                 DenseActionRows::fromBudget(JavaParser::prsTable, dense_kb * size_t(1024)));
+
+#ifdef LPG_FUSED_STACKS
+    const char* layout = "fused frames";
+#else
+    const char* layout = "parallel arrays";
+#endif
+    std::wstring path = IcuUtil::s2ws(file);
+    JavaLexer lexer;
+    JavaParser parser;
+    double best = 0,
+           total = 0;
+    for (int i = 0; i < repetitions; i++)
+    {
+        lexer.reset(path, 4);
+        parser.reset(lexer.getILexStream());
+        lexer.lexer(nullptr, parser.getIPrsStream());
+
+        auto start = std::chrono::steady_clock::now();
+        if (parser.parser(nullptr) == nullptr)
+        {
+            std::cout << file << ": syntax error" << std::endl;
+            return 1;
+        }
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        total += elapsed;
+        best = (i == 0 || elapsed < best ? elapsed : best);
+    }
+    std::cout << layout << (dense_kb > 0 ? ", dense rows" : "") << ": " << parser.getIPrsStream()->getSize() << " tokens, "
+              << "best " << best << " ms, mean " << total / repetitions << " ms" << std::endl;
+    return 0;
+}
+
+//
+// JavaExample -kwbench <file.java> [repetitions]
+//
+// Time the classification of the identifiers and keywords of the input by
+// the keyword automaton of JavaKWLexer and by its perfect hash table (see
+// KeywordTable). Give it identifier heavy input (generated code, long
+// declarations...), where most of the tokens go through the keyword lexer.
+//
+static int keywordBenchmark(const char* file, int repetitions)
+{
+    std::wstring path = IcuUtil::s2ws(file);
+    JavaLexer lexer;
+    JavaParser parser;
+    lexer.reset(path, 4);
+    parser.reset(lexer.getILexStream());
+    lexer.lexer(nullptr, parser.getIPrsStream());
+
+    IPrsStream* tokens = parser.getIPrsStream();
+    JavaKWLexer kwLexer(tokens->getInputChars(), JavaParsersym::TK_IDENTIFIER);
+    if (kwLexer.keywords == nullptr)
+    {
+        std::cout << "the keywords are not in a hash table" << std::endl;
+        return 1;
+    }
+
+    //
+    // The spans of the tokens that went through the keyword lexer.
+    //
+    std::vector<std::pair<int, int>> spans;
+    for (int i = 1; i < tokens->getSize(); i++)
+    {
+        int kind = tokens->getKind(i);
+        if (std::find(kwLexer.keywordKind, kwLexer.keywordKind + JavaKWLexer::keywordKindLenth, kind) !=
+            kwLexer.keywordKind + JavaKWLexer::keywordKindLenth)
+            spans.emplace_back(tokens->getStartOffset(i), tokens->getEndOffset(i));
+    }
+    const KeywordTable* keywords = kwLexer.keywords;
+    for (auto& span : spans)
+    {
+        if (kwLexer.lexer_Wchart(span.first, span.second) != kwLexer.lexer(span.first, span.second))
+        {
+            std::cout << file << ": the classifiers differ at offset " << span.first << std::endl;
+            return 1;
+        }
+    }
+
+    double best[2] = {},
+           total[2] = {};
+    long long check = 0;
+    for (int i = 0; i < repetitions; i++)
+    {
+        for (int table = 0; table < 2; table++)
+        {
+            kwLexer.keywords = (table ? keywords : nullptr);
+            auto start = std::chrono::steady_clock::now();
+            for (auto& span : spans)
+                check += kwLexer.lexer(span.first, span.second);
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            total[table] += elapsed;
+            best[table] = (i == 0 || elapsed < best[table] ? elapsed : best[table]);
+        }
+    }
+    std::cout << spans.size() << " of " << tokens->getSize() << " tokens classified (" << check << ")" << std::endl
+              << "automaton: best " << best[0] << " ms, mean " << total[0] / repetitions << " ms" << std::endl
+              << "hash table: best " << best[1] << " ms, mean " << total[1] / repetitions << " ms" << std::endl;
+    return 0;
+}
+
+//
+// JavaExample -parallel <file.java> [threads] [repetitions]
+//
+// Time the lexer on one thread and with ParallelLexer, and check that both
+// make the same tokens and adjuncts. Give it a large input (several
+// hundred KB); smaller ones are lexed on one thread anyway.
+//
+static int parallelBenchmark(const char* file, int threads, int repetitions)
+{
+    std::wstring path = IcuUtil::s2ws(file);
+    JavaLexer lexer;
+    lexer.reset(path, 4);
+    PrsStream sequential(lexer.getILexStream()),
+              parallel(lexer.getILexStream());
+
+    double best[2] = {},
+           total[2] = {};
+    for (int i = 0; i < repetitions; i++)
+    {
+        for (int mode = 0; mode < 2; mode++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            if (mode == 0)
+                lexer.lexer(nullptr, &sequential);
+            else ParallelLexer<JavaLexer>::lexer(lexer, nullptr, &parallel, threads);
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            total[mode] += elapsed;
+            best[mode] = (i == 0 || elapsed < best[mode] ? elapsed : best[mode]);
+        }
+    }
+
+    auto same = [](IToken* a, IToken* b)
+    {
+        return a->getKind() == b->getKind() && a->getStartOffset() == b->getStartOffset() &&
+               a->getEndOffset() == b->getEndOffset() && a->getTokenIndex() == b->getTokenIndex();
+    };
+    bool equal = sequential.getSize() == parallel.getSize() &&
+                 sequential.adjuncts.size() == parallel.adjuncts.size();
+    for (int i = 0; equal && i < sequential.getSize(); i++)
+        equal = same(sequential.getIToken(i), parallel.getIToken(i));
+    for (int i = 0; equal && i < sequential.adjuncts.size(); i++)
+        equal = same(sequential.adjuncts.get(i), parallel.adjuncts.get(i));
+    if (!equal)
+    {
+        std::cout << file << ": the parallel lexer made other tokens" << std::endl;
+        return 1;
+    }
+
+    std::cout << sequential.getSize() << " tokens, " << sequential.adjuncts.size() << " adjuncts, "
+              << ParallelLexer<JavaLexer>::split(static_cast<LexStream*>(lexer.getILexStream()),
+                                                 threads > 0 ? threads : std::thread::hardware_concurrency()).size()
+              << " chunks" << std::endl
+              << "one thread: best " << best[0] << " ms, mean " << total[0] / repetitions << " ms" << std::endl
+              << "parallel: best " << best[1] << " ms, mean " << total[1] / repetitions << " ms" << std::endl;
+    return 0;
+}
+
+//
+// JavaExample -pull <file.java> [repetitions]
+//
+// Time the lexer and the parser together, with the input lexed before the
+// parser starts, with the tokens lexed as the parser reads them (see
+// PullLexer) and with the input lexed on another thread (see
+// PipelinedLexer), and check that all three parse the same tokens.
+//
+static int pullBenchmark(const char* file, int repetitions)
+{
+    const char* names[] = { "lexed first", "pulled", "pipelined" };
+    std::wstring path = IcuUtil::s2ws(file);
+    JavaLexer lexer;
+    JavaParser parser;
+    double best[3] = {},
+           total[3] = {};
+    int sizes[3] = {},
+        parsed[3] = {};
+    for (int i = 0; i < repetitions; i++)
+    {
+        for (int mode = 0; mode < 3; mode++)
+        {
+            lexer.reset(path, 4);
+            parser.reset(lexer.getILexStream());
+            auto start = std::chrono::steady_clock::now();
+            if (mode == 0)
+            {
+                lexer.lexer(nullptr, parser.getIPrsStream());
+                parsed[mode] = (parser.parser(nullptr) != nullptr);
+            }
+            else if (mode == 1)
+            {
+                PullLexer<JavaLexer> pull(lexer, nullptr, parser.getIPrsStream());
+                parsed[mode] = (parser.parser(nullptr) != nullptr);
+                pull.lexAll();
+            }
+            else
+            {
+                PipelinedLexer<JavaLexer> pipeline(lexer, nullptr, parser.getIPrsStream());
+                parsed[mode] = (parser.parser(nullptr) != nullptr);
+                pipeline.lexAll();
+            }
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            total[mode] += elapsed;
+            best[mode] = (i == 0 || elapsed < best[mode] ? elapsed : best[mode]);
+            sizes[mode] = parser.getIPrsStream()->getSize();
+        }
+    }
+    if (sizes[0] != sizes[1] || sizes[0] != sizes[2] || parsed[0] != parsed[1] || parsed[0] != parsed[2])
+    {
+        std::cout << file << ": the parses differ" << std::endl;
+        return 1;
+    }
+
+    std::cout << sizes[0] << " tokens, " << (parsed[0] ? "parsed" : "syntax error") << std::endl;
+    for (int mode = 0; mode < 3; mode++)
+        std::cout << names[mode] << ": best " << best[mode] << " ms, mean " << total[mode] / repetitions << " ms" << std::endl;
+    return 0;
+}
+
+//
+// JavaExample -profile <output prefix> <file.java>...
+//
+// Lex and parse a corpus, counting the terminal actions computed in each
+// state of the tables of JavaLexer and JavaParser (see ParseTableProfile),
+// then lay out both tables for that profile (see ParseTableLayout). The
+// arrays to paste in JavaLexerprs.h and JavaParserprs.h are written to
+// <prefix>JavaLexerprs.txt and <prefix>JavaParserprs.txt, and the tables
+// themselves to <prefix>JavaLexer.lpgt and <prefix>JavaParser.lpgt (see
+// BinaryParseTable). Build the runtime and the example with
+// LPG_PROFILE_PARSE_TABLES defined: the tables record nothing otherwise.
+//
+#ifdef LPG_PROFILE_PARSE_TABLES
+static bool writeLayout(const std::string& prefix, const std::string& name, ParseTable* prs,
+                        const ParseTableProfile& profile)
+{
+    auto layout = ParseTableLayout::fromProfile(prs, profile);
+    if (layout == nullptr)
+        return false;
+
+    std::ofstream arrays(prefix + name + "prs.txt");
+    layout->writeArrays(arrays);
+    BinaryParseTable::write(layout.get(), IcuUtil::s2ws(prefix + name + ".lpgt"));
+
+    unsigned long long actions = 0;
+    for (unsigned visits : profile.stateVisits)
+        actions += visits;
+    std::cout << name << ": " << actions << " terminal actions, " << layout->rowMap.size() << " rows relocated, "
+              << layout->hotLength << " entries in the hot region" << std::endl;
+    return true;
+}
+#endif
+
+static int profileCorpus(const std::string& prefix, char* files[], int count)
+{
+#ifndef LPG_PROFILE_PARSE_TABLES
+    (void) prefix;
+    (void) files;
+    (void) count;
+    std::cout << "Build JavaExample with LPG_PROFILE_PARSE_TABLES defined to profile its tables" << std::endl;
+    return 1;
+#else
+    auto lexer_profile = std::make_shared<ParseTableProfile>(JavaLexer::prs);
+    auto parser_profile = std::make_shared<ParseTableProfile>(JavaParser::prsTable);
+    ParseTableProfile::install(JavaLexer::prs, lexer_profile);
+    ParseTableProfile::install(JavaParser::prsTable, parser_profile);
+
+    for (int i = 0; i < count; i++)
+    {
+        JavaLexer lexer;
+        JavaParser parser;
+        lexer.reset(IcuUtil::s2ws(files[i]), 4);
+        parser.reset(lexer.getILexStream());
+        lexer.lexer(nullptr, parser.getIPrsStream());
+        if (parser.parser(nullptr) == nullptr)
+            std::cout << files[i] << ": syntax error" << std::endl;
+    }
+
+    ParseTableProfile::install(JavaLexer::prs, nullptr);
+    ParseTableProfile::install(JavaParser::prsTable, nullptr);
+
+    if (!writeLayout(prefix, "JavaLexer", JavaLexer::prs, *lexer_profile) ||
+        !writeLayout(prefix, "JavaParser", JavaParser::prsTable, *parser_profile))
+    {
+        std::cout << "The tables do not report the length of their arrays" << std::endl;
+        return 1;
+    }
+    return 0;
+#endif
+}
+
+//
+// JavaExample -direct <directory>
+//
+// Write JavaLexerdirect.h, the terminal actions of the lexer coded as
+// switch blocks (see DirectCodeGenerator), to directory. Run it again
+// whenever JavaLexerprs.h is regenerated.
+//
+static int writeDirectCode(const std::string& directory)
+{
+    std::ofstream out(directory + "/JavaLexerdirect.h");
+    GeneratedParseTable<JavaLexerprs> table;
+    if (!out || !DirectCodeGenerator::generate(&table, "JavaLexerprs", "JavaLexerdirect", out))
+    {
+        std::cout << "Cannot write " << directory << "/JavaLexerdirect.h" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
 {
+    if (argc > 2 && strcmp(argv[1], "-direct") == 0)
+        return writeDirectCode(argv[2]);
+    if (argc > 2 && strcmp(argv[1], "-bench") == 0)
+        return benchmark(argv[2], argc > 3 ? std::max(atoi(argv[3]), 1) : 20, argc > 4 ? atoi(argv[4]) : 0);
+    if (argc > 2 && strcmp(argv[1], "-kwbench") == 0)
+        return keywordBenchmark(argv[2], argc > 3 ? std::max(atoi(argv[3]), 1) : 20);
+    if (argc > 2 && strcmp(argv[1], "-parallel") == 0)
+        return parallelBenchmark(argv[2], argc > 3 ? atoi(argv[3]) : 0, argc > 4 ? std::max(atoi(argv[4]), 1) : 10);
+    if (argc > 2 && strcmp(argv[1], "-pull") == 0)
+        return pullBenchmark(argv[2], argc > 3 ? std::max(atoi(argv[3]), 1) : 10);
+    if (argc > 3 && strcmp(argv[1], "-profile") == 0)
+        return profileCorpus(argv[2], argv + 3, argc - 3);
 
     JavaLexer lexer; // Create the lexer
     lexer.reset(LR"(D:\workspace\New_Parser\lpg_java\src\test\test2.java)", 8);
@@ -23,6 +23,7 @@
     //#line 63 "KeywordTemplateF.gi
 
 #include "JavaParsersym.h"
+#include "KeywordTable.h"
 #include "tuple.h"
  struct  JavaKWLexer :public JavaKWLexerprs
 {
@@ -31,6 +32,12 @@
 	 static  constexpr int  keywordKindLenth = 88 + 1;
 	 int keywordKind[keywordKindLenth]={};
 	 int* getKeywordKinds() { return keywordKind; }
+
+    //
+    // The perfect hash table of the keywords, shared by all the lexers, or
+    // nullptr if the automaton must be run (see KeywordTable).
+    //
+     const KeywordTable* keywords = nullptr;
     int lexer_Wchart(int curtok, int lasttok)
 	{
 		 int current_kind = getKind(inputChars[curtok]),
@@ -56,9 +63,13 @@
 	 }
      int lexer(int curtok, int lasttok){
         if(inputBytes.size()){
+            if (keywords)
+                return keywordKind[keywords->find(inputBytes.data() + curtok, lasttok - curtok + 1)];
             return lexerBytes(curtok,lasttok);
         }
         else if(inputChars.size()){
+             if (keywords)
+                 return keywordKind[keywords->find(inputChars.data() + curtok, lasttok - curtok + 1)];
              return lexer_Wchart(curtok,lasttok);
         }
         else{
@@ -172,7 +183,7 @@
     }
 
 
-    //#line 144 "KeywordTemplateF.gi
+    //#line 155 "KeywordTemplateF.gi
 
 
     void initialize(int identifierKind)
@@ -600,13 +611,16 @@
         keywordKind[60] = (JavaParsersym::TK_BadAction);
       
     
-    //#line 154 "KeywordTemplateF.gi
+    //#line 165 "KeywordTemplateF.gi
 
         for (int i = 0; i < keywordKindLenth; i++)
         {
             if (keywordKind[i] == 0)
                 keywordKind[i] = identifierKind;
         }
+
+        static const KeywordTable table(*this);
+        keywords = (table.enabled ? &table : nullptr);
     }
 };
 
@@ -12,23 +12,25 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
-    //#line 123 "LexerTemplateF.gi
+    //#line 141 "LexerTemplateF.gi
 
 
-    //#line 128 "LexerTemplateF.gi
+    //#line 146 "LexerTemplateF.gi
 
 #pragma once  
 #include <iostream>
 #include "IPrsStream.h"
 #include "Object.h"
+#include "GeneratedParseTable.h"
 #include "ParseTable.h"
 #include "RuleAction.h"
 #include "stringex.h"
 #include "Token.h"
 #include "JavaLexersym.h"
-#include "JavaLexerprs.h"
+#include "JavaLexerdirect.h"
 #include "JavaKWLexer.h"
 #include "LexParser.h"
+#include "LexParserT.h"
 #include "LpgLexStream.h"
  struct JavaLexer :public Object ,public RuleAction
 {
@@ -40,10 +42,10 @@
         delete lexParser;
     }
 
-     inline  static ParseTable* prs = new JavaLexerprs();
+     inline  static ParseTable* prs = new GeneratedParseTable<JavaLexerdirect>();
      ParseTable* getParseTable() { return prs; }
 
-     LexParser* lexParser = new LexParser();
+     LexParser* lexParser = new LexParserT<JavaLexerLpgLexStream, JavaLexerdirect, JavaLexer>();
      LexParser* getParser() { return lexParser; }
 
      int getToken(int i) { return lexParser->getToken(i); }
@@ -209,7 +211,7 @@
         lexStream->setStreamLength(input_chars.size());
         lexStream->computeLineOffsets(repair_offset);
 
-        int first_new_token_index = lexStream->getIPrsStream()->getTokens().size(),
+        int first_new_token_index = lexStream->getIPrsStream()->getSize(),
             first_new_adjunct_index = lexStream->getIPrsStream()->getAdjuncts().size();
         
         resetKeywordLexer();
@@ -238,9 +240,9 @@
         //
         IToken* first_new_token = nullptr;
           IToken*      last_new_token = nullptr;
-        if (first_new_token_index < lexStream->getIPrsStream()->getTokens().size()) {
+        if (first_new_token_index < lexStream->getIPrsStream()->getSize()) {
             first_new_token = lexStream->getIPrsStream()->getTokenAt(first_new_token_index);
-            last_new_token = lexStream->getIPrsStream()->getTokenAt(lexStream->getIPrsStream()->getTokens().size() - 1);
+            last_new_token = lexStream->getIPrsStream()->getTokenAt(lexStream->getIPrsStream()->getSize() - 1);
         }
         //
         // If an adjunct was added prior to the first real token, chose it instead as the first token.
@@ -297,6 +299,45 @@
         }        
     }
 
+    //#line 158 "GJavaLexer.gi
+
+    //
+    // White space and comments are scanned here a vector of characters at
+    // a time, rather than by the automaton (see RuleAction::scanSkippedTokens).
+    // A block comment that is not terminated, or that contains a control
+    // character other than white space, is left to the automaton.
+    //
+     int scanSkippedTokens(int offset)
+    {
+        int length = lexStream->getStreamLength();
+        for (;;)
+        {
+            int c = (offset < length ? lexStream->getCharValue(offset) : 0xffff),
+                next = (offset + 1 < length ? lexStream->getCharValue(offset + 1) : 0xffff),
+                end;
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f') // Token ::= WS
+                end = lexStream->skipWhitespace(offset + 1);
+            else if (c == '/' && next == '/') // Token ::= SLC
+            {
+                end = lexStream->findLineEnd(offset + 2);
+                while (end < length && (c = lexStream->getCharValue(end)) != '\n' && c != '\r' && c != 0xffff)
+                    end = lexStream->findLineEnd(end + 1); // the other control characters are NotEol
+            }
+            else if (c == '/' && next == '*') // Token ::= '/' '*' Inside Stars '/'
+            {
+                end = lexStream->findBlockCommentEnd(offset + 2);
+                if (end + 1 >= length || lexStream->getCharValue(end) != '*')
+                    break;
+                end += 2;
+            }
+            else break;
+
+            if (printTokens) printValue(offset, end - 1);
+            offset = end;
+        }
+        return offset;
+    }
+
     //#line 5 "LexerBasicMapF.gi
 
     //
@@ -548,9 +589,25 @@
     }
     };
 
-    //#line 412 "LexerTemplateF.gi
+    //#line 432 "LexerTemplateF.gi
 
      void ruleAction(int ruleNumber)
+    {
+        ruleAction<false>(ruleNumber, nullptr);
+    }
+
+     const unsigned char* getRuleActionMap()
+    {
+        static const std::vector<unsigned char> map = findRuleActions(this, JavaLexerprs::NUM_RULES);
+        return map.data();
+    }
+
+    //
+    // The actions of the rules, or, with probe, whether a rule has one
+    // (see findRuleActions).
+    //
+     template <bool probe>
+     void ruleAction(int ruleNumber, bool* found)
     {
         switch(ruleNumber)
         {
@@ -558,7 +615,8 @@
             //
             // Rule 1:  Token ::= Identifier
             //
-            case 1: { 
+            case 1: {
+                if constexpr (probe) { *found = true; break; }
                 checkForKeyWord();
                   break;
             }
@@ -566,7 +624,8 @@
             //
             // Rule 2:  Token ::= " SLBody "
             //
-            case 2: { 
+            case 2: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_StringLiteral);
                   break;
             }
@@ -574,7 +633,8 @@
             //
             // Rule 3:  Token ::= ' NotSQ '
             //
-            case 3: { 
+            case 3: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_CharacterLiteral);
                   break;
             }
@@ -582,7 +642,8 @@
             //
             // Rule 4:  Token ::= IntegerLiteral
             //
-            case 4: { 
+            case 4: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_IntegerLiteral);
                   break;
             }
@@ -590,7 +651,8 @@
             //
             // Rule 5:  Token ::= FloatingPointLiteral
             //
-            case 5: { 
+            case 5: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_FloatingPointLiteral);
                   break;
             }
@@ -598,7 +660,8 @@
             //
             // Rule 6:  Token ::= DoubleLiteral
             //
-            case 6: { 
+            case 6: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_DoubleLiteral);
                   break;
             }
@@ -606,7 +669,8 @@
             //
             // Rule 7:  Token ::= / * Inside Stars /
             //
-            case 7: { 
+            case 7: {
+                if constexpr (probe) { *found = true; break; }
                 skipToken();
                   break;
             }
@@ -614,7 +678,8 @@
             //
             // Rule 8:  Token ::= SLC
             //
-            case 8: { 
+            case 8: {
+                if constexpr (probe) { *found = true; break; }
                 skipToken();
                   break;
             }
@@ -622,7 +687,8 @@
             //
             // Rule 9:  Token ::= WS
             //
-            case 9: { 
+            case 9: {
+                if constexpr (probe) { *found = true; break; }
                 skipToken();
                   break;
             }
@@ -630,7 +696,8 @@
             //
             // Rule 10:  Token ::= +
             //
-            case 10: { 
+            case 10: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_PLUS);
                   break;
             }
@@ -638,7 +705,8 @@
             //
             // Rule 11:  Token ::= -
             //
-            case 11: { 
+            case 11: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_MINUS);
                   break;
             }
@@ -646,7 +714,8 @@
             //
             // Rule 12:  Token ::= *
             //
-            case 12: { 
+            case 12: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_MULTIPLY);
                   break;
             }
@@ -654,7 +723,8 @@
             //
             // Rule 13:  Token ::= /
             //
-            case 13: { 
+            case 13: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_DIVIDE);
                   break;
             }
@@ -662,7 +732,8 @@
             //
             // Rule 14:  Token ::= (
             //
-            case 14: { 
+            case 14: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LPAREN);
                   break;
             }
@@ -670,7 +741,8 @@
             //
             // Rule 15:  Token ::= )
             //
-            case 15: { 
+            case 15: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_RPAREN);
                   break;
             }
@@ -678,7 +750,8 @@
             //
             // Rule 16:  Token ::= =
             //
-            case 16: { 
+            case 16: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_EQUAL);
                   break;
             }
@@ -686,7 +759,8 @@
             //
             // Rule 17:  Token ::= ,
             //
-            case 17: { 
+            case 17: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_COMMA);
                   break;
             }
@@ -694,7 +768,8 @@
             //
             // Rule 18:  Token ::= :
             //
-            case 18: { 
+            case 18: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_COLON);
                   break;
             }
@@ -702,7 +777,8 @@
             //
             // Rule 19:  Token ::= ;
             //
-            case 19: { 
+            case 19: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_SEMICOLON);
                   break;
             }
@@ -710,7 +786,8 @@
             //
             // Rule 20:  Token ::= ^
             //
-            case 20: { 
+            case 20: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_XOR);
                   break;
             }
@@ -718,7 +795,8 @@
             //
             // Rule 21:  Token ::= %
             //
-            case 21: { 
+            case 21: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_REMAINDER);
                   break;
             }
@@ -726,7 +804,8 @@
             //
             // Rule 22:  Token ::= ~
             //
-            case 22: { 
+            case 22: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_TWIDDLE);
                   break;
             }
@@ -734,7 +813,8 @@
             //
             // Rule 23:  Token ::= |
             //
-            case 23: { 
+            case 23: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_OR);
                   break;
             }
@@ -742,7 +822,8 @@
             //
             // Rule 24:  Token ::= &
             //
-            case 24: { 
+            case 24: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_AND);
                   break;
             }
@@ -750,7 +831,8 @@
             //
             // Rule 25:  Token ::= <
             //
-            case 25: { 
+            case 25: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LESS);
                   break;
             }
@@ -758,7 +840,8 @@
             //
             // Rule 26:  Token ::= >
             //
-            case 26: { 
+            case 26: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_GREATER);
                   break;
             }
@@ -766,7 +849,8 @@
             //
             // Rule 27:  Token ::= .
             //
-            case 27: { 
+            case 27: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_DOT);
                   break;
             }
@@ -774,7 +858,8 @@
             //
             // Rule 28:  Token ::= !
             //
-            case 28: { 
+            case 28: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_NOT);
                   break;
             }
@@ -782,7 +867,8 @@
             //
             // Rule 29:  Token ::= [
             //
-            case 29: { 
+            case 29: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LBRACKET);
                   break;
             }
@@ -790,7 +876,8 @@
             //
             // Rule 30:  Token ::= ]
             //
-            case 30: { 
+            case 30: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_RBRACKET);
                   break;
             }
@@ -798,7 +885,8 @@
             //
             // Rule 31:  Token ::= {
             //
-            case 31: { 
+            case 31: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LBRACE);
                   break;
             }
@@ -806,7 +894,8 @@
             //
             // Rule 32:  Token ::= }
             //
-            case 32: { 
+            case 32: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_RBRACE);
                   break;
             }
@@ -814,7 +903,8 @@
             //
             // Rule 33:  Token ::= ?
             //
-            case 33: { 
+            case 33: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_QUESTION);
                   break;
             }
@@ -822,7 +912,8 @@
             //
             // Rule 34:  Token ::= @
             //
-            case 34: { 
+            case 34: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_AT);
                   break;
             }
@@ -830,7 +921,8 @@
             //
             // Rule 35:  Token ::= + +
             //
-            case 35: { 
+            case 35: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_PLUS_PLUS);
                   break;
             }
@@ -838,7 +930,8 @@
             //
             // Rule 36:  Token ::= - -
             //
-            case 36: { 
+            case 36: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_MINUS_MINUS);
                   break;
             }
@@ -846,7 +939,8 @@
             //
             // Rule 37:  Token ::= = =
             //
-            case 37: { 
+            case 37: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_EQUAL_EQUAL);
                   break;
             }
@@ -854,7 +948,8 @@
             //
             // Rule 38:  Token ::= < =
             //
-            case 38: { 
+            case 38: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LESS_EQUAL);
                   break;
             }
@@ -862,7 +957,8 @@
             //
             // Rule 39:  Token ::= ! =
             //
-            case 39: { 
+            case 39: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_NOT_EQUAL);
                   break;
             }
@@ -870,7 +966,8 @@
             //
             // Rule 40:  Token ::= < <
             //
-            case 40: { 
+            case 40: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LEFT_SHIFT);
                   break;
             }
@@ -878,7 +975,8 @@
             //
             // Rule 41:  Token ::= + =
             //
-            case 41: { 
+            case 41: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_PLUS_EQUAL);
                   break;
             }
@@ -886,7 +984,8 @@
             //
             // Rule 42:  Token ::= - =
             //
-            case 42: { 
+            case 42: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_MINUS_EQUAL);
                   break;
             }
@@ -894,7 +993,8 @@
             //
             // Rule 43:  Token ::= * =
             //
-            case 43: { 
+            case 43: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_MULTIPLY_EQUAL);
                   break;
             }
@@ -902,7 +1002,8 @@
             //
             // Rule 44:  Token ::= / =
             //
-            case 44: { 
+            case 44: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_DIVIDE_EQUAL);
                   break;
             }
@@ -910,7 +1011,8 @@
             //
             // Rule 45:  Token ::= & =
             //
-            case 45: { 
+            case 45: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_AND_EQUAL);
                   break;
             }
@@ -918,7 +1020,8 @@
             //
             // Rule 46:  Token ::= | =
             //
-            case 46: { 
+            case 46: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_OR_EQUAL);
                   break;
             }
@@ -926,7 +1029,8 @@
             //
             // Rule 47:  Token ::= ^ =
             //
-            case 47: { 
+            case 47: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_XOR_EQUAL);
                   break;
             }
@@ -934,7 +1038,8 @@
             //
             // Rule 48:  Token ::= % =
             //
-            case 48: { 
+            case 48: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_REMAINDER_EQUAL);
                   break;
             }
@@ -942,7 +1047,8 @@
             //
             // Rule 49:  Token ::= < < =
             //
-            case 49: { 
+            case 49: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_LEFT_SHIFT_EQUAL);
                   break;
             }
@@ -950,7 +1056,8 @@
             //
             // Rule 50:  Token ::= | |
             //
-            case 50: { 
+            case 50: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_OR_OR);
                   break;
             }
@@ -958,7 +1065,8 @@
             //
             // Rule 51:  Token ::= & &
             //
-            case 51: { 
+            case 51: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_AND_AND);
                   break;
             }
@@ -966,12 +1074,13 @@
             //
             // Rule 52:  Token ::= . . .
             //
-            case 52: { 
+            case 52: {
+                if constexpr (probe) { *found = true; break; }
                 makeToken(JavaParsersym::TK_ELLIPSIS);
                   break;
             }
     
-    //#line 416 "LexerTemplateF.gi
+    //#line 436 "LexerTemplateF.gi
 
     
             default:
@@ -0,0 +1,612 @@
+#pragma once
+#include "GeneratedParseTable.h"
+#include "JavaLexerprs.h"
+
+//
+// Direct-coded terminal actions of JavaLexerprs, written by
+// DirectCodeGenerator. Do not edit: regenerate it with the table.
+//
+struct JavaLexerdirect :public GeneratedParseTable<JavaLexerprs>
+{
+    constexpr static bool DIRECT_CODED = true;
+
+    static int directTAction(int state, int sym)
+    {
+        switch (state)
+        {
+            case 382:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 100: case 101: return 613;
+                    case 79: return 612;
+                    case 80: return 413;
+                    default: return 543;
+                }
+            case 447:
+                return 76;
+            case 413:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 100: case 101: return 611;
+                    case 79: return 550;
+                    case 80: return 616;
+                    default: return 543;
+                }
+            case 411:
+                return 71;
+            case 433:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 96:
+                    case 97: case 98: case 102: return 618;
+                    default: return 8;
+                }
+            case 399:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+                    case 42: case 43: case 44: case 45: case 46: case 47: case 48: case 49:
+                    case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73:
+                    case 74: case 75: case 76: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: return 620;
+                    case 34: return 545;
+                    case 77: return 458;
+                    default: return 543;
+                }
+            case 509:
+                return 620;
+            case 353:
+                switch (sym)
+                {
+                    case 1: return 368;
+                    case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9:
+                    case 10: return 531;
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 19:
+                    case 20: case 21: case 22: case 23: case 25: case 26: case 27: case 28:
+                    case 29: case 30: case 32: case 33: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 75: return 530;
+                    case 18: return 446;
+                    case 24: return 389;
+                    case 31: return 378;
+                    case 34: return 447;
+                    case 35: return 518;
+                    case 36: return 462;
+                    case 37: case 38: case 73: case 100: case 101: return 532;
+                    case 74: return 415;
+                    case 76: return 409;
+                    case 78: return 407;
+                    case 79: return 520;
+                    case 80: return 454;
+                    case 81: return 424;
+                    case 82: return 401;
+                    case 83: return 577;
+                    case 84: return 565;
+                    case 85: return 428;
+                    case 86: return 561;
+                    case 87: return 562;
+                    case 88: return 574;
+                    case 89: return 575;
+                    case 90: return 572;
+                    case 91: return 573;
+                    case 92: return 576;
+                    case 93: return 560;
+                    case 94: return 569;
+                    case 95: return 557;
+                    case 96: return 558;
+                    default: return 543;
+                }
+            case 389:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 25:
+                    case 26: case 27: case 28: case 29: case 30: case 31: case 32: case 33:
+                    case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+                    case 42: case 43: case 44: case 45: case 46: case 47: case 48: case 49:
+                    case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73:
+                    case 74: case 75: case 76: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: return 528;
+                    case 77: return 391;
+                    default: return 543;
+                }
+            case 361:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 742;
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 19:
+                    case 20: case 21: case 22: case 23: case 25: case 26: case 27: case 28:
+                    case 29: case 30: case 32: case 33: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 75: return 741;
+                    default: return 1;
+                }
+            case 412:
+                switch (sym)
+                {
+                    case 11: case 14: return 608;
+                    case 12: case 13: return 603;
+                    default: return 59;
+                }
+            case 529:
+                switch (sym)
+                {
+                    case 31: return 595;
+                    default: return 543;
+                }
+            case 373:
+                switch (sym)
+                {
+                    case 99: return 542;
+                    default: return 543;
+                }
+            case 473:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 624;
+                    case 25: case 30: return 599;
+                    default: return 55;
+                }
+            case 442:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 473;
+                    default: return 543;
+                }
+            case 528:
+                switch (sym)
+                {
+                    case 24: return 546;
+                    default: return 543;
+                }
+            case 477:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 481;
+                    default: return 543;
+                }
+            case 481:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 490;
+                    default: return 543;
+                }
+            case 486:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 494;
+                    default: return 543;
+                }
+            case 533:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 160;
+                }
+            case 490:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 498;
+                    default: return 543;
+                }
+            case 494:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 502;
+                    default: return 543;
+                }
+            case 530:
+                switch (sym)
+                {
+                    case 99: return 1;
+                    default: return 197;
+                }
+            case 498:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 886;
+                    default: return 543;
+                }
+            case 534:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 161;
+                }
+            case 502:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 506;
+                    default: return 543;
+                }
+            case 506:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 19: case 20: case 21: case 22: case 23: return 877;
+                    default: return 543;
+                }
+            case 535:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 162;
+                }
+            case 440:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 622;
+                    case 11: case 14: return 610;
+                    case 12: case 13: return 606;
+                    case 16: case 17: return 456;
+                    case 25: case 30: return 597;
+                    case 31: return 510;
+                    default: return 4;
+                }
+            case 422:
+                switch (sym)
+                {
+                    case 11: case 14: return 609;
+                    case 12: case 13: return 605;
+                    default: return 61;
+                }
+            case 401:
+                switch (sym)
+                {
+                    case 18: return 582;
+                    default: return 28;
+                }
+            case 424:
+                switch (sym)
+                {
+                    case 18: return 591;
+                    default: return 21;
+                }
+            case 391:
+                switch (sym)
+                {
+                    case 1: return 533;
+                    case 2: return 534;
+                    case 3: return 535;
+                    case 4: return 536;
+                    case 5: return 537;
+                    case 6: return 538;
+                    case 7: return 539;
+                    case 8: return 540;
+                    case 11: return 891;
+                    case 15: return 888;
+                    case 24: return 894;
+                    case 26: return 890;
+                    case 27: return 892;
+                    case 28: return 889;
+                    case 29: return 477;
+                    case 34: return 893;
+                    case 77: return 895;
+                    default: return 543;
+                }
+            case 368:
+                switch (sym)
+                {
+                    case 32: case 33: return 442;
+                    case 99: return 4;
+                    default: return 78;
+                }
+            case 462:
+                switch (sym)
+                {
+                    case 18: return 585;
+                    case 36: return 579;
+                    default: return 11;
+                }
+            case 428:
+                switch (sym)
+                {
+                    case 18: return 590;
+                    default: return 20;
+                }
+            case 531:
+                switch (sym)
+                {
+                    case 99: return 4;
+                    default: return 78;
+                }
+            case 532:
+                switch (sym)
+                {
+                    case 99: return 9;
+                    default: return 195;
+                }
+            case 536:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 163;
+                }
+            case 446:
+                switch (sym)
+                {
+                    case 18: return 580;
+                    default: return 16;
+                }
+            case 454:
+                switch (sym)
+                {
+                    case 18: return 586;
+                    default: return 12;
+                }
+            case 458:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: return 878;
+                    case 11: return 891;
+                    case 15: return 888;
+                    case 24: return 894;
+                    case 26: return 890;
+                    case 27: return 892;
+                    case 28: return 889;
+                    case 29: return 486;
+                    case 34: return 893;
+                    case 77: return 895;
+                    default: return 543;
+                }
+            case 537:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 164;
+                }
+            case 451:
+                switch (sym)
+                {
+                    case 11: case 14: return 607;
+                    case 12: case 13: return 601;
+                    case 16: case 17: return 456;
+                    default: return 6;
+                }
+            case 526:
+                switch (sym)
+                {
+                    case 18: return 592;
+                    default: return 40;
+                }
+            case 456:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 369;
+                    case 35: return 514;
+                    case 36: return 512;
+                    default: return 543;
+                }
+            case 378:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 355;
+                    case 31: return 529;
+                    default: return 27;
+                }
+            case 355:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 622;
+                    default: return 82;
+                }
+            case 510:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 470;
+                    default: return 83;
+                }
+            case 512:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 522;
+                    default: return 543;
+                }
+            case 514:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 524;
+                    default: return 543;
+                }
+            case 369:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 622;
+                    default: return 85;
+                }
+            case 470:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 622;
+                    default: return 84;
+                }
+            case 522:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 622;
+                    default: return 87;
+                }
+            case 524:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: return 622;
+                    default: return 86;
+                }
+            case 450:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: return 516;
+                    default: return 182;
+                }
+            case 516:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: return 727;
+                    default: return 183;
+                }
+            case 364:
+                switch (sym)
+                {
+                    case 37: case 38: case 73: case 100: case 101: return 739;
+                    default: return 9;
+                }
+            case 520:
+                switch (sym)
+                {
+                    case 18: return 587;
+                    case 79: return 617;
+                    case 80: return 411;
+                    default: return 13;
+                }
+            case 409:
+                switch (sym)
+                {
+                    case 18: return 588;
+                    case 76: return 594;
+                    default: return 24;
+                }
+            case 415:
+                switch (sym)
+                {
+                    case 18: return 589;
+                    case 74: return 593;
+                    default: return 23;
+                }
+            case 407:
+                switch (sym)
+                {
+                    case 18: return 581;
+                    case 78: return 526;
+                    default: return 25;
+                }
+            case 518:
+                switch (sym)
+                {
+                    case 18: return 584;
+                    case 35: return 578;
+                    default: return 10;
+                }
+            case 538:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 165;
+                }
+            case 539:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 166;
+                }
+            case 540:
+                switch (sym)
+                {
+                    case 24: return 182;
+                    default: return 167;
+                }
+            default:
+            {
+                int i = _baseAction[state],
+                    k = i + sym;
+                return _termAction[_termCheck[k] == sym ? k : i];
+            }
+        }
+    }
+
+    static int directLookAhead(int la_state, int sym)
+    {
+        switch (la_state)
+        {
+            default:
+            {
+                int k = la_state + sym;
+                return _termAction[_termCheck[k] == sym ? k : la_state];
+            }
+        }
+    }
+
+    int tAction(int state, int sym) override { return directTAction(state, sym); }
+
+    int lookAhead(int la_state, int sym) override { return directLookAhead(la_state, sym); }
+};
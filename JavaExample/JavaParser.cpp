@@ -14,13 +14,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
-    //#line 360 "btParserTemplateF.gi
+    //#line 385 "btParserTemplateF.gi
 
      #include "JavaParser.h"
 
 #include "JavaParser_top_level_ast.h"
 
-void JavaParser::ruleAction(int ruleNumber)
+template <bool probe>
+void JavaParser::ruleAction(int ruleNumber, bool* found)
     {
         switch (ruleNumber)
         {
@@ -30,6 +31,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 3:  identifier ::= IDENTIFIER
             //
             case 3: {
+               if constexpr (probe) { *found = true; break; }
                //#line 184 "GJavaParser.g"
                 setResult(
                     //#line 184 GJavaParser.g
@@ -47,6 +49,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 5:  LPGUserAction ::= $BeginAction BlockStatementsopt $EndAction
             //
             case 5: {
+               if constexpr (probe) { *found = true; break; }
                //#line 194 "GJavaParser.g"
                 setResult(
                     //#line 194 GJavaParser.g
@@ -65,6 +68,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 6:  LPGUserAction ::= $BeginJava BlockStatementsopt $EndJava
             //
             case 6: {
+               if constexpr (probe) { *found = true; break; }
                //#line 195 "GJavaParser.g"
                 setResult(
                     //#line 195 GJavaParser.g
@@ -83,6 +87,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 7:  LPGUserAction ::= $NoAction
             //
             case 7: {
+               if constexpr (probe) { *found = true; break; }
                //#line 196 "GJavaParser.g"
                 setResult(
                     //#line 196 GJavaParser.g
@@ -95,6 +100,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 8:  LPGUserAction ::= $NullAction
             //
             case 8: {
+               if constexpr (probe) { *found = true; break; }
                //#line 197 "GJavaParser.g"
                 setResult(
                     //#line 197 GJavaParser.g
@@ -107,6 +113,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 9:  LPGUserAction ::= $BadAction
             //
             case 9: {
+               if constexpr (probe) { *found = true; break; }
                //#line 198 "GJavaParser.g"
                 setResult(
                     //#line 198 GJavaParser.g
@@ -134,6 +141,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 13:  PrimitiveType ::= boolean
             //
             case 13: {
+               if constexpr (probe) { *found = true; break; }
                //#line 207 "GJavaParser.g"
                 setResult(
                     //#line 207 GJavaParser.g
@@ -156,6 +164,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 16:  IntegralType ::= byte
             //
             case 16: {
+               if constexpr (probe) { *found = true; break; }
                //#line 212 "GJavaParser.g"
                 setResult(
                     //#line 212 GJavaParser.g
@@ -168,6 +177,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 17:  IntegralType ::= short
             //
             case 17: {
+               if constexpr (probe) { *found = true; break; }
                //#line 213 "GJavaParser.g"
                 setResult(
                     //#line 213 GJavaParser.g
@@ -180,6 +190,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 18:  IntegralType ::= int
             //
             case 18: {
+               if constexpr (probe) { *found = true; break; }
                //#line 214 "GJavaParser.g"
                 setResult(
                     //#line 214 GJavaParser.g
@@ -192,6 +203,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 19:  IntegralType ::= long
             //
             case 19: {
+               if constexpr (probe) { *found = true; break; }
                //#line 215 "GJavaParser.g"
                 setResult(
                     //#line 215 GJavaParser.g
@@ -204,6 +216,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 20:  IntegralType ::= char
             //
             case 20: {
+               if constexpr (probe) { *found = true; break; }
                //#line 216 "GJavaParser.g"
                 setResult(
                     //#line 216 GJavaParser.g
@@ -216,6 +229,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 21:  FloatingPointType ::= float
             //
             case 21: {
+               if constexpr (probe) { *found = true; break; }
                //#line 218 "GJavaParser.g"
                 setResult(
                     //#line 218 GJavaParser.g
@@ -228,6 +242,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 22:  FloatingPointType ::= double
             //
             case 22: {
+               if constexpr (probe) { *found = true; break; }
                //#line 219 "GJavaParser.g"
                 setResult(
                     //#line 219 GJavaParser.g
@@ -260,6 +275,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 27:  ClassType ::= TypeName TypeArgumentsopt
             //
             case 27: {
+               if constexpr (probe) { *found = true; break; }
                //#line 231 "GJavaParser.g"
                 setResult(
                     //#line 231 GJavaParser.g
@@ -276,6 +292,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 28:  InterfaceType ::= TypeName TypeArgumentsopt
             //
             case 28: {
+               if constexpr (probe) { *found = true; break; }
                //#line 233 "GJavaParser.g"
                 setResult(
                     //#line 233 GJavaParser.g
@@ -297,6 +314,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 30:  TypeName ::= TypeName . identifier
             //
             case 30: {
+               if constexpr (probe) { *found = true; break; }
                //#line 236 "GJavaParser.g"
                 setResult(
                     //#line 236 GJavaParser.g
@@ -325,6 +343,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 33:  ArrayType ::= Type [ ]
             //
             case 33: {
+               if constexpr (probe) { *found = true; break; }
                //#line 242 "GJavaParser.g"
                 setResult(
                     //#line 242 GJavaParser.g
@@ -343,6 +362,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 34:  TypeParameter ::= TypeVariable TypeBoundopt
             //
             case 34: {
+               if constexpr (probe) { *found = true; break; }
                //#line 244 "GJavaParser.g"
                 setResult(
                     //#line 244 GJavaParser.g
@@ -359,6 +379,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 35:  TypeBound ::= extends ClassOrInterfaceType AdditionalBoundListopt
             //
             case 35: {
+               if constexpr (probe) { *found = true; break; }
                //#line 246 "GJavaParser.g"
                 setResult(
                     //#line 246 GJavaParser.g
@@ -382,6 +403,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 37:  AdditionalBoundList ::= AdditionalBoundList AdditionalBound
             //
             case 37: {
+               if constexpr (probe) { *found = true; break; }
                //#line 249 "GJavaParser.g"
                 setResult(
                     //#line 249 GJavaParser.g
@@ -398,6 +420,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 38:  AdditionalBound ::= & InterfaceType
             //
             case 38: {
+               if constexpr (probe) { *found = true; break; }
                //#line 251 "GJavaParser.g"
                 setResult(
                     //#line 251 GJavaParser.g
@@ -414,6 +437,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 39:  TypeArguments ::= < ActualTypeArgumentList >
             //
             case 39: {
+               if constexpr (probe) { *found = true; break; }
                //#line 253 "GJavaParser.g"
                 setResult(
                     //#line 253 GJavaParser.g
@@ -437,6 +461,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 41:  ActualTypeArgumentList ::= ActualTypeArgumentList , ActualTypeArgument
             //
             case 41: {
+               if constexpr (probe) { *found = true; break; }
                //#line 256 "GJavaParser.g"
                 setResult(
                     //#line 256 GJavaParser.g
@@ -465,6 +490,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 44:  Wildcard ::= ? WildcardBoundsOpt
             //
             case 44: {
+               if constexpr (probe) { *found = true; break; }
                //#line 261 "GJavaParser.g"
                 setResult(
                     //#line 261 GJavaParser.g
@@ -481,6 +507,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 45:  WildcardBounds ::= extends ReferenceType
             //
             case 45: {
+               if constexpr (probe) { *found = true; break; }
                //#line 263 "GJavaParser.g"
                 setResult(
                     //#line 263 GJavaParser.g
@@ -497,6 +524,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 46:  WildcardBounds ::= super ReferenceType
             //
             case 46: {
+               if constexpr (probe) { *found = true; break; }
                //#line 264 "GJavaParser.g"
                 setResult(
                     //#line 264 GJavaParser.g
@@ -518,6 +546,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 48:  PackageName ::= PackageName . identifier
             //
             case 48: {
+               if constexpr (probe) { *found = true; break; }
                //#line 271 "GJavaParser.g"
                 setResult(
                     //#line 271 GJavaParser.g
@@ -541,6 +570,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 50:  ExpressionName ::= AmbiguousName . identifier
             //
             case 50: {
+               if constexpr (probe) { *found = true; break; }
                //#line 280 "GJavaParser.g"
                 setResult(
                     //#line 280 GJavaParser.g
@@ -564,6 +594,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 52:  MethodName ::= AmbiguousName . identifier
             //
             case 52: {
+               if constexpr (probe) { *found = true; break; }
                //#line 283 "GJavaParser.g"
                 setResult(
                     //#line 283 GJavaParser.g
@@ -587,6 +618,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 54:  PackageOrTypeName ::= PackageOrTypeName . identifier
             //
             case 54: {
+               if constexpr (probe) { *found = true; break; }
                //#line 286 "GJavaParser.g"
                 setResult(
                     //#line 286 GJavaParser.g
@@ -610,6 +642,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 56:  AmbiguousName ::= AmbiguousName . identifier
             //
             case 56: {
+               if constexpr (probe) { *found = true; break; }
                //#line 289 "GJavaParser.g"
                 setResult(
                     //#line 289 GJavaParser.g
@@ -628,6 +661,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 57:  CompilationUnit ::= PackageDeclarationopt ImportDeclarationsopt TypeDeclarationsopt
             //
             case 57: {
+               if constexpr (probe) { *found = true; break; }
                //#line 293 "GJavaParser.g"
                 setResult(
                     //#line 293 GJavaParser.g
@@ -651,6 +685,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 59:  ImportDeclarations ::= ImportDeclarations ImportDeclaration
             //
             case 59: {
+               if constexpr (probe) { *found = true; break; }
                //#line 296 "GJavaParser.g"
                 setResult(
                     //#line 296 GJavaParser.g
@@ -672,6 +707,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 61:  TypeDeclarations ::= TypeDeclarations TypeDeclaration
             //
             case 61: {
+               if constexpr (probe) { *found = true; break; }
                //#line 299 "GJavaParser.g"
                 setResult(
                     //#line 299 GJavaParser.g
@@ -688,6 +724,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 62:  PackageDeclaration ::= Annotationsopt package PackageName ;
             //
             case 62: {
+               if constexpr (probe) { *found = true; break; }
                //#line 301 "GJavaParser.g"
                 setResult(
                     //#line 301 GJavaParser.g
@@ -728,6 +765,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 67:  SingleTypeImportDeclaration ::= import TypeName ;
             //
             case 67: {
+               if constexpr (probe) { *found = true; break; }
                //#line 308 "GJavaParser.g"
                 setResult(
                     //#line 308 GJavaParser.g
@@ -746,6 +784,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 68:  TypeImportOnDemandDeclaration ::= import PackageOrTypeName . * ;
             //
             case 68: {
+               if constexpr (probe) { *found = true; break; }
                //#line 310 "GJavaParser.g"
                 setResult(
                     //#line 310 GJavaParser.g
@@ -768,6 +807,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 69:  SingleStaticImportDeclaration ::= import static TypeName . identifier ;
             //
             case 69: {
+               if constexpr (probe) { *found = true; break; }
                //#line 312 "GJavaParser.g"
                 setResult(
                     //#line 312 GJavaParser.g
@@ -792,6 +832,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 70:  StaticImportOnDemandDeclaration ::= import static TypeName . * ;
             //
             case 70: {
+               if constexpr (probe) { *found = true; break; }
                //#line 314 "GJavaParser.g"
                 setResult(
                     //#line 314 GJavaParser.g
@@ -826,6 +867,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 73:  TypeDeclaration ::= ;
             //
             case 73: {
+               if constexpr (probe) { *found = true; break; }
                //#line 318 "GJavaParser.g"
                 setResult(
                     //#line 318 GJavaParser.g
@@ -848,6 +890,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 76:  NormalClassDeclaration ::= ClassModifiersopt class identifier TypeParametersopt Superopt Interfacesopt ClassBody
             //
             case 76: {
+               if constexpr (probe) { *found = true; break; }
                //#line 325 "GJavaParser.g"
                 setResult(
                     //#line 325 GJavaParser.g
@@ -879,6 +922,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 78:  ClassModifiers ::= ClassModifiers ClassModifier
             //
             case 78: {
+               if constexpr (probe) { *found = true; break; }
                //#line 328 "GJavaParser.g"
                 setResult(
                     //#line 328 GJavaParser.g
@@ -900,6 +944,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 80:  ClassModifier ::= public
             //
             case 80: {
+               if constexpr (probe) { *found = true; break; }
                //#line 331 "GJavaParser.g"
                 setResult(
                     //#line 331 GJavaParser.g
@@ -912,6 +957,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 81:  ClassModifier ::= protected
             //
             case 81: {
+               if constexpr (probe) { *found = true; break; }
                //#line 332 "GJavaParser.g"
                 setResult(
                     //#line 332 GJavaParser.g
@@ -924,6 +970,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 82:  ClassModifier ::= private
             //
             case 82: {
+               if constexpr (probe) { *found = true; break; }
                //#line 333 "GJavaParser.g"
                 setResult(
                     //#line 333 GJavaParser.g
@@ -936,6 +983,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 83:  ClassModifier ::= abstract
             //
             case 83: {
+               if constexpr (probe) { *found = true; break; }
                //#line 334 "GJavaParser.g"
                 setResult(
                     //#line 334 GJavaParser.g
@@ -948,6 +996,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 84:  ClassModifier ::= static
             //
             case 84: {
+               if constexpr (probe) { *found = true; break; }
                //#line 335 "GJavaParser.g"
                 setResult(
                     //#line 335 GJavaParser.g
@@ -960,6 +1009,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 85:  ClassModifier ::= final
             //
             case 85: {
+               if constexpr (probe) { *found = true; break; }
                //#line 336 "GJavaParser.g"
                 setResult(
                     //#line 336 GJavaParser.g
@@ -972,6 +1022,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 86:  ClassModifier ::= strictfp
             //
             case 86: {
+               if constexpr (probe) { *found = true; break; }
                //#line 337 "GJavaParser.g"
                 setResult(
                     //#line 337 GJavaParser.g
@@ -984,6 +1035,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 87:  TypeParameters ::= < TypeParameterList >
             //
             case 87: {
+               if constexpr (probe) { *found = true; break; }
                //#line 339 "GJavaParser.g"
                 setResult(
                     //#line 339 GJavaParser.g
@@ -1007,6 +1059,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 89:  TypeParameterList ::= TypeParameterList , TypeParameter
             //
             case 89: {
+               if constexpr (probe) { *found = true; break; }
                //#line 342 "GJavaParser.g"
                 setResult(
                     //#line 342 GJavaParser.g
@@ -1025,6 +1078,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 90:  Super ::= extends ClassType
             //
             case 90: {
+               if constexpr (probe) { *found = true; break; }
                //#line 344 "GJavaParser.g"
                 setResult(
                     //#line 344 GJavaParser.g
@@ -1041,6 +1095,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 91:  Interfaces ::= implements InterfaceTypeList
             //
             case 91: {
+               if constexpr (probe) { *found = true; break; }
                //#line 351 "GJavaParser.g"
                 setResult(
                     //#line 351 GJavaParser.g
@@ -1062,6 +1117,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 93:  InterfaceTypeList ::= InterfaceTypeList , InterfaceType
             //
             case 93: {
+               if constexpr (probe) { *found = true; break; }
                //#line 354 "GJavaParser.g"
                 setResult(
                     //#line 354 GJavaParser.g
@@ -1080,6 +1136,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 94:  ClassBody ::= { ClassBodyDeclarationsopt }
             //
             case 94: {
+               if constexpr (probe) { *found = true; break; }
                //#line 361 "GJavaParser.g"
                 setResult(
                     //#line 361 GJavaParser.g
@@ -1103,6 +1160,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 96:  ClassBodyDeclarations ::= ClassBodyDeclarations ClassBodyDeclaration
             //
             case 96: {
+               if constexpr (probe) { *found = true; break; }
                //#line 364 "GJavaParser.g"
                 setResult(
                     //#line 364 GJavaParser.g
@@ -1159,6 +1217,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 105:  ClassMemberDeclaration ::= ;
             //
             case 105: {
+               if constexpr (probe) { *found = true; break; }
                //#line 375 "GJavaParser.g"
                 setResult(
                     //#line 375 GJavaParser.g
@@ -1171,6 +1230,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 106:  FieldDeclaration ::= FieldModifiersopt Type VariableDeclarators ;
             //
             case 106: {
+               if constexpr (probe) { *found = true; break; }
                //#line 377 "GJavaParser.g"
                 setResult(
                     //#line 377 GJavaParser.g
@@ -1196,6 +1256,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 108:  VariableDeclarators ::= VariableDeclarators , VariableDeclarator
             //
             case 108: {
+               if constexpr (probe) { *found = true; break; }
                //#line 380 "GJavaParser.g"
                 setResult(
                     //#line 380 GJavaParser.g
@@ -1219,6 +1280,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 110:  VariableDeclarator ::= VariableDeclaratorId = VariableInitializer
             //
             case 110: {
+               if constexpr (probe) { *found = true; break; }
                //#line 383 "GJavaParser.g"
                 setResult(
                     //#line 383 GJavaParser.g
@@ -1242,6 +1304,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 112:  VariableDeclaratorId ::= VariableDeclaratorId [ ]
             //
             case 112: {
+               if constexpr (probe) { *found = true; break; }
                //#line 386 "GJavaParser.g"
                 setResult(
                     //#line 386 GJavaParser.g
@@ -1275,6 +1338,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 116:  FieldModifiers ::= FieldModifiers FieldModifier
             //
             case 116: {
+               if constexpr (probe) { *found = true; break; }
                //#line 392 "GJavaParser.g"
                 setResult(
                     //#line 392 GJavaParser.g
@@ -1296,6 +1360,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 118:  FieldModifier ::= public
             //
             case 118: {
+               if constexpr (probe) { *found = true; break; }
                //#line 395 "GJavaParser.g"
                 setResult(
                     //#line 395 GJavaParser.g
@@ -1308,6 +1373,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 119:  FieldModifier ::= protected
             //
             case 119: {
+               if constexpr (probe) { *found = true; break; }
                //#line 396 "GJavaParser.g"
                 setResult(
                     //#line 396 GJavaParser.g
@@ -1320,6 +1386,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 120:  FieldModifier ::= private
             //
             case 120: {
+               if constexpr (probe) { *found = true; break; }
                //#line 397 "GJavaParser.g"
                 setResult(
                     //#line 397 GJavaParser.g
@@ -1332,6 +1399,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 121:  FieldModifier ::= static
             //
             case 121: {
+               if constexpr (probe) { *found = true; break; }
                //#line 398 "GJavaParser.g"
                 setResult(
                     //#line 398 GJavaParser.g
@@ -1344,6 +1412,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 122:  FieldModifier ::= final
             //
             case 122: {
+               if constexpr (probe) { *found = true; break; }
                //#line 399 "GJavaParser.g"
                 setResult(
                     //#line 399 GJavaParser.g
@@ -1356,6 +1425,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 123:  FieldModifier ::= transient
             //
             case 123: {
+               if constexpr (probe) { *found = true; break; }
                //#line 400 "GJavaParser.g"
                 setResult(
                     //#line 400 GJavaParser.g
@@ -1368,6 +1438,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 124:  FieldModifier ::= volatile
             //
             case 124: {
+               if constexpr (probe) { *found = true; break; }
                //#line 401 "GJavaParser.g"
                 setResult(
                     //#line 401 GJavaParser.g
@@ -1380,6 +1451,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 125:  MethodDeclaration ::= MethodHeader MethodBody
             //
             case 125: {
+               if constexpr (probe) { *found = true; break; }
                //#line 403 "GJavaParser.g"
                 setResult(
                     //#line 403 GJavaParser.g
@@ -1396,6 +1468,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 126:  MethodHeader ::= MethodModifiersopt TypeParametersopt ResultType MethodDeclarator Throwsopt
             //
             case 126: {
+               if constexpr (probe) { *found = true; break; }
                //#line 405 "GJavaParser.g"
                 setResult(
                     //#line 405 GJavaParser.g
@@ -1423,6 +1496,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 128:  ResultType ::= void
             //
             case 128: {
+               if constexpr (probe) { *found = true; break; }
                //#line 408 "GJavaParser.g"
                 setResult(
                     //#line 408 GJavaParser.g
@@ -1435,6 +1509,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 129:  MethodDeclarator ::= identifier ( FormalParameterListopt )
             //
             case 129: {
+               if constexpr (probe) { *found = true; break; }
                //#line 410 "GJavaParser.g"
                 setResult(
                     //#line 410 GJavaParser.g
@@ -1455,6 +1530,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 130:  MethodDeclarator ::= MethodDeclarator [ ]
             //
             case 130: {
+               if constexpr (probe) { *found = true; break; }
                //#line 412 "GJavaParser.g"
                 setResult(
                     //#line 412 GJavaParser.g
@@ -1478,6 +1554,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 132:  FormalParameterList ::= FormalParameters , LastFormalParameter
             //
             case 132: {
+               if constexpr (probe) { *found = true; break; }
                //#line 415 "GJavaParser.g"
                 setResult(
                     //#line 415 GJavaParser.g
@@ -1501,6 +1578,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 134:  FormalParameters ::= FormalParameters , FormalParameter
             //
             case 134: {
+               if constexpr (probe) { *found = true; break; }
                //#line 418 "GJavaParser.g"
                 setResult(
                     //#line 418 GJavaParser.g
@@ -1519,6 +1597,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 135:  FormalParameter ::= VariableModifiersopt Type VariableDeclaratorId
             //
             case 135: {
+               if constexpr (probe) { *found = true; break; }
                //#line 420 "GJavaParser.g"
                 setResult(
                     //#line 420 GJavaParser.g
@@ -1542,6 +1621,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 137:  VariableModifiers ::= VariableModifiers VariableModifier
             //
             case 137: {
+               if constexpr (probe) { *found = true; break; }
                //#line 423 "GJavaParser.g"
                 setResult(
                     //#line 423 GJavaParser.g
@@ -1558,6 +1638,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 138:  VariableModifier ::= final
             //
             case 138: {
+               if constexpr (probe) { *found = true; break; }
                //#line 425 "GJavaParser.g"
                 setResult(
                     //#line 425 GJavaParser.g
@@ -1575,6 +1656,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 140:  LastFormalParameter ::= VariableModifiersopt Type ...opt VariableDeclaratorId
             //
             case 140: {
+               if constexpr (probe) { *found = true; break; }
                //#line 428 "GJavaParser.g"
                 setResult(
                     //#line 428 GJavaParser.g
@@ -1600,6 +1682,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 142:  MethodModifiers ::= MethodModifiers MethodModifier
             //
             case 142: {
+               if constexpr (probe) { *found = true; break; }
                //#line 437 "GJavaParser.g"
                 setResult(
                     //#line 437 GJavaParser.g
@@ -1621,6 +1704,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 144:  MethodModifier ::= public
             //
             case 144: {
+               if constexpr (probe) { *found = true; break; }
                //#line 440 "GJavaParser.g"
                 setResult(
                     //#line 440 GJavaParser.g
@@ -1633,6 +1717,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 145:  MethodModifier ::= protected
             //
             case 145: {
+               if constexpr (probe) { *found = true; break; }
                //#line 441 "GJavaParser.g"
                 setResult(
                     //#line 441 GJavaParser.g
@@ -1645,6 +1730,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 146:  MethodModifier ::= private
             //
             case 146: {
+               if constexpr (probe) { *found = true; break; }
                //#line 442 "GJavaParser.g"
                 setResult(
                     //#line 442 GJavaParser.g
@@ -1657,6 +1743,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 147:  MethodModifier ::= abstract
             //
             case 147: {
+               if constexpr (probe) { *found = true; break; }
                //#line 443 "GJavaParser.g"
                 setResult(
                     //#line 443 GJavaParser.g
@@ -1669,6 +1756,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 148:  MethodModifier ::= static
             //
             case 148: {
+               if constexpr (probe) { *found = true; break; }
                //#line 444 "GJavaParser.g"
                 setResult(
                     //#line 444 GJavaParser.g
@@ -1681,6 +1769,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 149:  MethodModifier ::= final
             //
             case 149: {
+               if constexpr (probe) { *found = true; break; }
                //#line 445 "GJavaParser.g"
                 setResult(
                     //#line 445 GJavaParser.g
@@ -1693,6 +1782,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 150:  MethodModifier ::= synchronized
             //
             case 150: {
+               if constexpr (probe) { *found = true; break; }
                //#line 446 "GJavaParser.g"
                 setResult(
                     //#line 446 GJavaParser.g
@@ -1705,6 +1795,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 151:  MethodModifier ::= native
             //
             case 151: {
+               if constexpr (probe) { *found = true; break; }
                //#line 447 "GJavaParser.g"
                 setResult(
                     //#line 447 GJavaParser.g
@@ -1717,6 +1808,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 152:  MethodModifier ::= strictfp
             //
             case 152: {
+               if constexpr (probe) { *found = true; break; }
                //#line 448 "GJavaParser.g"
                 setResult(
                     //#line 448 GJavaParser.g
@@ -1729,6 +1821,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 153:  Throws ::= throws ExceptionTypeList
             //
             case 153: {
+               if constexpr (probe) { *found = true; break; }
                //#line 450 "GJavaParser.g"
                 setResult(
                     //#line 450 GJavaParser.g
@@ -1750,6 +1843,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 155:  ExceptionTypeList ::= ExceptionTypeList , ExceptionType
             //
             case 155: {
+               if constexpr (probe) { *found = true; break; }
                //#line 453 "GJavaParser.g"
                 setResult(
                     //#line 453 GJavaParser.g
@@ -1783,6 +1877,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 159:  MethodBody ::= ;
             //
             case 159: {
+               if constexpr (probe) { *found = true; break; }
                //#line 459 "GJavaParser.g"
                 setResult(
                     //#line 459 GJavaParser.g
@@ -1800,6 +1895,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 161:  StaticInitializer ::= static Block
             //
             case 161: {
+               if constexpr (probe) { *found = true; break; }
                //#line 463 "GJavaParser.g"
                 setResult(
                     //#line 463 GJavaParser.g
@@ -1816,6 +1912,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 162:  ConstructorDeclaration ::= ConstructorModifiersopt ConstructorDeclarator Throwsopt ConstructorBody
             //
             case 162: {
+               if constexpr (probe) { *found = true; break; }
                //#line 465 "GJavaParser.g"
                 setResult(
                     //#line 465 GJavaParser.g
@@ -1836,6 +1933,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 163:  ConstructorDeclarator ::= TypeParametersopt SimpleTypeName ( FormalParameterListopt )
             //
             case 163: {
+               if constexpr (probe) { *found = true; break; }
                //#line 467 "GJavaParser.g"
                 setResult(
                     //#line 467 GJavaParser.g
@@ -1868,6 +1966,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 166:  ConstructorModifiers ::= ConstructorModifiers ConstructorModifier
             //
             case 166: {
+               if constexpr (probe) { *found = true; break; }
                //#line 472 "GJavaParser.g"
                 setResult(
                     //#line 472 GJavaParser.g
@@ -1889,6 +1988,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 168:  ConstructorModifier ::= public
             //
             case 168: {
+               if constexpr (probe) { *found = true; break; }
                //#line 475 "GJavaParser.g"
                 setResult(
                     //#line 475 GJavaParser.g
@@ -1901,6 +2001,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 169:  ConstructorModifier ::= protected
             //
             case 169: {
+               if constexpr (probe) { *found = true; break; }
                //#line 476 "GJavaParser.g"
                 setResult(
                     //#line 476 GJavaParser.g
@@ -1913,6 +2014,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 170:  ConstructorModifier ::= private
             //
             case 170: {
+               if constexpr (probe) { *found = true; break; }
                //#line 477 "GJavaParser.g"
                 setResult(
                     //#line 477 GJavaParser.g
@@ -1925,6 +2027,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 171:  ConstructorBody ::= { ExplicitConstructorInvocationopt BlockStatementsopt }
             //
             case 171: {
+               if constexpr (probe) { *found = true; break; }
                //#line 479 "GJavaParser.g"
                 setResult(
                     //#line 479 GJavaParser.g
@@ -1945,6 +2048,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 172:  ExplicitConstructorInvocation ::= TypeArgumentsopt this ( ArgumentListopt ) ;
             //
             case 172: {
+               if constexpr (probe) { *found = true; break; }
                //#line 481 "GJavaParser.g"
                 setResult(
                     //#line 481 GJavaParser.g
@@ -1969,6 +2073,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 173:  ExplicitConstructorInvocation ::= TypeArgumentsopt super ( ArgumentListopt ) ;
             //
             case 173: {
+               if constexpr (probe) { *found = true; break; }
                //#line 482 "GJavaParser.g"
                 setResult(
                     //#line 482 GJavaParser.g
@@ -1993,6 +2098,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 174:  ExplicitConstructorInvocation ::= Primary . TypeArgumentsopt super ( ArgumentListopt ) ;
             //
             case 174: {
+               if constexpr (probe) { *found = true; break; }
                //#line 483 "GJavaParser.g"
                 setResult(
                     //#line 483 GJavaParser.g
@@ -2021,6 +2127,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 175:  EnumDeclaration ::= ClassModifiersopt enum identifier Interfacesopt EnumBody
             //
             case 175: {
+               if constexpr (probe) { *found = true; break; }
                //#line 485 "GJavaParser.g"
                 setResult(
                     //#line 485 GJavaParser.g
@@ -2043,6 +2150,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 176:  EnumBody ::= { EnumConstantsopt ,opt EnumBodyDeclarationsopt }
             //
             case 176: {
+               if constexpr (probe) { *found = true; break; }
                //#line 487 "GJavaParser.g"
                 setResult(
                     //#line 487 GJavaParser.g
@@ -2070,6 +2178,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 178:  EnumConstants ::= EnumConstants , EnumConstant
             //
             case 178: {
+               if constexpr (probe) { *found = true; break; }
                //#line 490 "GJavaParser.g"
                 setResult(
                     //#line 490 GJavaParser.g
@@ -2088,6 +2197,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 179:  EnumConstant ::= Annotationsopt identifier Argumentsopt ClassBodyopt
             //
             case 179: {
+               if constexpr (probe) { *found = true; break; }
                //#line 492 "GJavaParser.g"
                 setResult(
                     //#line 492 GJavaParser.g
@@ -2108,6 +2218,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 180:  Arguments ::= ( ArgumentListopt )
             //
             case 180: {
+               if constexpr (probe) { *found = true; break; }
                //#line 494 "GJavaParser.g"
                 setResult(
                     //#line 494 GJavaParser.g
@@ -2126,6 +2237,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 181:  EnumBodyDeclarations ::= ; ClassBodyDeclarationsopt
             //
             case 181: {
+               if constexpr (probe) { *found = true; break; }
                //#line 496 "GJavaParser.g"
                 setResult(
                     //#line 496 GJavaParser.g
@@ -2152,6 +2264,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 184:  NormalInterfaceDeclaration ::= InterfaceModifiersopt interface identifier TypeParametersopt ExtendsInterfacesopt InterfaceBody
             //
             case 184: {
+               if constexpr (probe) { *found = true; break; }
                //#line 503 "GJavaParser.g"
                 setResult(
                     //#line 503 GJavaParser.g
@@ -2181,6 +2294,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 186:  InterfaceModifiers ::= InterfaceModifiers InterfaceModifier
             //
             case 186: {
+               if constexpr (probe) { *found = true; break; }
                //#line 506 "GJavaParser.g"
                 setResult(
                     //#line 506 GJavaParser.g
@@ -2202,6 +2316,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 188:  InterfaceModifier ::= public
             //
             case 188: {
+               if constexpr (probe) { *found = true; break; }
                //#line 509 "GJavaParser.g"
                 setResult(
                     //#line 509 GJavaParser.g
@@ -2214,6 +2329,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 189:  InterfaceModifier ::= protected
             //
             case 189: {
+               if constexpr (probe) { *found = true; break; }
                //#line 510 "GJavaParser.g"
                 setResult(
                     //#line 510 GJavaParser.g
@@ -2226,6 +2342,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 190:  InterfaceModifier ::= private
             //
             case 190: {
+               if constexpr (probe) { *found = true; break; }
                //#line 511 "GJavaParser.g"
                 setResult(
                     //#line 511 GJavaParser.g
@@ -2238,6 +2355,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 191:  InterfaceModifier ::= abstract
             //
             case 191: {
+               if constexpr (probe) { *found = true; break; }
                //#line 512 "GJavaParser.g"
                 setResult(
                     //#line 512 GJavaParser.g
@@ -2250,6 +2368,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 192:  InterfaceModifier ::= static
             //
             case 192: {
+               if constexpr (probe) { *found = true; break; }
                //#line 513 "GJavaParser.g"
                 setResult(
                     //#line 513 GJavaParser.g
@@ -2262,6 +2381,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 193:  InterfaceModifier ::= strictfp
             //
             case 193: {
+               if constexpr (probe) { *found = true; break; }
                //#line 514 "GJavaParser.g"
                 setResult(
                     //#line 514 GJavaParser.g
@@ -2274,6 +2394,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 194:  ExtendsInterfaces ::= extends InterfaceType
             //
             case 194: {
+               if constexpr (probe) { *found = true; break; }
                //#line 516 "GJavaParser.g"
                 setResult(
                     //#line 516 GJavaParser.g
@@ -2290,6 +2411,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 195:  ExtendsInterfaces ::= ExtendsInterfaces , InterfaceType
             //
             case 195: {
+               if constexpr (probe) { *found = true; break; }
                //#line 517 "GJavaParser.g"
                 setResult(
                     //#line 517 GJavaParser.g
@@ -2308,6 +2430,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 196:  InterfaceBody ::= { InterfaceMemberDeclarationsopt }
             //
             case 196: {
+               if constexpr (probe) { *found = true; break; }
                //#line 524 "GJavaParser.g"
                 setResult(
                     //#line 524 GJavaParser.g
@@ -2331,6 +2454,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 198:  InterfaceMemberDeclarations ::= InterfaceMemberDeclarations InterfaceMemberDeclaration
             //
             case 198: {
+               if constexpr (probe) { *found = true; break; }
                //#line 527 "GJavaParser.g"
                 setResult(
                     //#line 527 GJavaParser.g
@@ -2367,6 +2491,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 203:  InterfaceMemberDeclaration ::= ;
             //
             case 203: {
+               if constexpr (probe) { *found = true; break; }
                //#line 533 "GJavaParser.g"
                 setResult(
                     //#line 533 GJavaParser.g
@@ -2379,6 +2504,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 204:  ConstantDeclaration ::= ConstantModifiersopt Type VariableDeclarators
             //
             case 204: {
+               if constexpr (probe) { *found = true; break; }
                //#line 535 "GJavaParser.g"
                 setResult(
                     //#line 535 GJavaParser.g
@@ -2402,6 +2528,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 206:  ConstantModifiers ::= ConstantModifiers ConstantModifier
             //
             case 206: {
+               if constexpr (probe) { *found = true; break; }
                //#line 538 "GJavaParser.g"
                 setResult(
                     //#line 538 GJavaParser.g
@@ -2423,6 +2550,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 208:  ConstantModifier ::= public
             //
             case 208: {
+               if constexpr (probe) { *found = true; break; }
                //#line 541 "GJavaParser.g"
                 setResult(
                     //#line 541 GJavaParser.g
@@ -2435,6 +2563,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 209:  ConstantModifier ::= static
             //
             case 209: {
+               if constexpr (probe) { *found = true; break; }
                //#line 542 "GJavaParser.g"
                 setResult(
                     //#line 542 GJavaParser.g
@@ -2447,6 +2576,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 210:  ConstantModifier ::= final
             //
             case 210: {
+               if constexpr (probe) { *found = true; break; }
                //#line 543 "GJavaParser.g"
                 setResult(
                     //#line 543 GJavaParser.g
@@ -2459,6 +2589,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 211:  AbstractMethodDeclaration ::= AbstractMethodModifiersopt TypeParametersopt ResultType MethodDeclarator Throwsopt ;
             //
             case 211: {
+               if constexpr (probe) { *found = true; break; }
                //#line 545 "GJavaParser.g"
                 setResult(
                     //#line 545 GJavaParser.g
@@ -2488,6 +2619,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 213:  AbstractMethodModifiers ::= AbstractMethodModifiers AbstractMethodModifier
             //
             case 213: {
+               if constexpr (probe) { *found = true; break; }
                //#line 548 "GJavaParser.g"
                 setResult(
                     //#line 548 GJavaParser.g
@@ -2509,6 +2641,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 215:  AbstractMethodModifier ::= public
             //
             case 215: {
+               if constexpr (probe) { *found = true; break; }
                //#line 551 "GJavaParser.g"
                 setResult(
                     //#line 551 GJavaParser.g
@@ -2521,6 +2654,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 216:  AbstractMethodModifier ::= abstract
             //
             case 216: {
+               if constexpr (probe) { *found = true; break; }
                //#line 552 "GJavaParser.g"
                 setResult(
                     //#line 552 GJavaParser.g
@@ -2533,6 +2667,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 217:  AnnotationTypeDeclaration ::= InterfaceModifiersopt @ interface identifier AnnotationTypeBody
             //
             case 217: {
+               if constexpr (probe) { *found = true; break; }
                //#line 554 "GJavaParser.g"
                 setResult(
                     //#line 554 GJavaParser.g
@@ -2555,6 +2690,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 218:  AnnotationTypeBody ::= { AnnotationTypeElementDeclarationsopt }
             //
             case 218: {
+               if constexpr (probe) { *found = true; break; }
                //#line 556 "GJavaParser.g"
                 setResult(
                     //#line 556 GJavaParser.g
@@ -2578,6 +2714,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 220:  AnnotationTypeElementDeclarations ::= AnnotationTypeElementDeclarations AnnotationTypeElementDeclaration
             //
             case 220: {
+               if constexpr (probe) { *found = true; break; }
                //#line 559 "GJavaParser.g"
                 setResult(
                     //#line 559 GJavaParser.g
@@ -2594,6 +2731,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 221:  AnnotationTypeElementDeclaration ::= AbstractMethodModifiersopt Type identifier ( ) DefaultValueopt ;
             //
             case 221: {
+               if constexpr (probe) { *found = true; break; }
                //#line 561 "GJavaParser.g"
                 setResult(
                     //#line 561 GJavaParser.g
@@ -2645,6 +2783,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 227:  AnnotationTypeElementDeclaration ::= ;
             //
             case 227: {
+               if constexpr (probe) { *found = true; break; }
                //#line 567 "GJavaParser.g"
                 setResult(
                     //#line 567 GJavaParser.g
@@ -2657,6 +2796,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 228:  DefaultValue ::= default ElementValue
             //
             case 228: {
+               if constexpr (probe) { *found = true; break; }
                //#line 569 "GJavaParser.g"
                 setResult(
                     //#line 569 GJavaParser.g
@@ -2678,6 +2818,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 230:  Annotations ::= Annotations Annotation
             //
             case 230: {
+               if constexpr (probe) { *found = true; break; }
                //#line 572 "GJavaParser.g"
                 setResult(
                     //#line 572 GJavaParser.g
@@ -2709,6 +2850,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 234:  NormalAnnotation ::= @ TypeName ( ElementValuePairsopt )
             //
             case 234: {
+               if constexpr (probe) { *found = true; break; }
                //#line 578 "GJavaParser.g"
                 setResult(
                     //#line 578 GJavaParser.g
@@ -2736,6 +2878,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 236:  ElementValuePairs ::= ElementValuePairs , ElementValuePair
             //
             case 236: {
+               if constexpr (probe) { *found = true; break; }
                //#line 581 "GJavaParser.g"
                 setResult(
                     //#line 581 GJavaParser.g
@@ -2754,6 +2897,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 237:  ElementValuePair ::= SimpleName = ElementValue
             //
             case 237: {
+               if constexpr (probe) { *found = true; break; }
                //#line 583 "GJavaParser.g"
                 setResult(
                     //#line 583 GJavaParser.g
@@ -2792,6 +2936,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 242:  ElementValueArrayInitializer ::= { ElementValuesopt ,opt }
             //
             case 242: {
+               if constexpr (probe) { *found = true; break; }
                //#line 591 "GJavaParser.g"
                 setResult(
                     //#line 591 GJavaParser.g
@@ -2817,6 +2962,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 244:  ElementValues ::= ElementValues , ElementValue
             //
             case 244: {
+               if constexpr (probe) { *found = true; break; }
                //#line 594 "GJavaParser.g"
                 setResult(
                     //#line 594 GJavaParser.g
@@ -2835,6 +2981,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 245:  MarkerAnnotation ::= @ TypeName
             //
             case 245: {
+               if constexpr (probe) { *found = true; break; }
                //#line 596 "GJavaParser.g"
                 setResult(
                     //#line 596 GJavaParser.g
@@ -2851,6 +2998,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 246:  SingleElementAnnotation ::= @ TypeName ( ElementValue )
             //
             case 246: {
+               if constexpr (probe) { *found = true; break; }
                //#line 598 "GJavaParser.g"
                 setResult(
                     //#line 598 GJavaParser.g
@@ -2873,6 +3021,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 247:  ArrayInitializer ::= { VariableInitializersopt ,opt }
             //
             case 247: {
+               if constexpr (probe) { *found = true; break; }
                //#line 602 "GJavaParser.g"
                 setResult(
                     //#line 602 GJavaParser.g
@@ -2898,6 +3047,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 249:  VariableInitializers ::= VariableInitializers , VariableInitializer
             //
             case 249: {
+               if constexpr (probe) { *found = true; break; }
                //#line 605 "GJavaParser.g"
                 setResult(
                     //#line 605 GJavaParser.g
@@ -2916,6 +3066,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 250:  Block ::= { BlockStatementsopt }
             //
             case 250: {
+               if constexpr (probe) { *found = true; break; }
                //#line 621 "GJavaParser.g"
                 setResult(
                     //#line 621 GJavaParser.g
@@ -2939,6 +3090,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 252:  BlockStatements ::= BlockStatements BlockStatement
             //
             case 252: {
+               if constexpr (probe) { *found = true; break; }
                //#line 624 "GJavaParser.g"
                 setResult(
                     //#line 624 GJavaParser.g
@@ -2970,6 +3122,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 256:  LocalVariableDeclarationStatement ::= LocalVariableDeclaration ;
             //
             case 256: {
+               if constexpr (probe) { *found = true; break; }
                //#line 630 "GJavaParser.g"
                 setResult(
                     //#line 630 GJavaParser.g
@@ -2986,6 +3139,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 257:  LocalVariableDeclaration ::= VariableModifiersopt Type VariableDeclarators
             //
             case 257: {
+               if constexpr (probe) { *found = true; break; }
                //#line 632 "GJavaParser.g"
                 setResult(
                     //#line 632 GJavaParser.g
@@ -3119,6 +3273,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 281:  IfThenStatement ::= if ( Expression ) Statement
             //
             case 281: {
+               if constexpr (probe) { *found = true; break; }
                //#line 675 "GJavaParser.g"
                 setResult(
                     //#line 675 GJavaParser.g
@@ -3141,6 +3296,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 282:  IfThenElseStatement ::= if ( Expression ) StatementNoShortIf else Statement
             //
             case 282: {
+               if constexpr (probe) { *found = true; break; }
                //#line 677 "GJavaParser.g"
                 setResult(
                     //#line 677 GJavaParser.g
@@ -3167,6 +3323,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 283:  IfThenElseStatementNoShortIf ::= if ( Expression ) StatementNoShortIf else StatementNoShortIf
             //
             case 283: {
+               if constexpr (probe) { *found = true; break; }
                //#line 679 "GJavaParser.g"
                 setResult(
                     //#line 679 GJavaParser.g
@@ -3193,6 +3350,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 284:  EmptyStatement ::= ;
             //
             case 284: {
+               if constexpr (probe) { *found = true; break; }
                //#line 681 "GJavaParser.g"
                 setResult(
                     //#line 681 GJavaParser.g
@@ -3205,6 +3363,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 285:  LabeledStatement ::= identifier : Statement
             //
             case 285: {
+               if constexpr (probe) { *found = true; break; }
                //#line 683 "GJavaParser.g"
                 setResult(
                     //#line 683 GJavaParser.g
@@ -3223,6 +3382,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 286:  LabeledStatementNoShortIf ::= identifier : StatementNoShortIf
             //
             case 286: {
+               if constexpr (probe) { *found = true; break; }
                //#line 685 "GJavaParser.g"
                 setResult(
                     //#line 685 GJavaParser.g
@@ -3241,6 +3401,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 287:  ExpressionStatement ::= StatementExpression ;
             //
             case 287: {
+               if constexpr (probe) { *found = true; break; }
                //#line 687 "GJavaParser.g"
                 setResult(
                     //#line 687 GJavaParser.g
@@ -3292,6 +3453,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 295:  AssertStatement ::= assert Expression ;
             //
             case 295: {
+               if constexpr (probe) { *found = true; break; }
                //#line 706 "GJavaParser.g"
                 setResult(
                     //#line 706 GJavaParser.g
@@ -3310,6 +3472,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 296:  AssertStatement ::= assert Expression : Expression ;
             //
             case 296: {
+               if constexpr (probe) { *found = true; break; }
                //#line 707 "GJavaParser.g"
                 setResult(
                     //#line 707 GJavaParser.g
@@ -3332,6 +3495,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 297:  SwitchStatement ::= switch ( Expression ) SwitchBlock
             //
             case 297: {
+               if constexpr (probe) { *found = true; break; }
                //#line 709 "GJavaParser.g"
                 setResult(
                     //#line 709 GJavaParser.g
@@ -3354,6 +3518,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 298:  SwitchBlock ::= { SwitchBlockStatementGroupsopt SwitchLabelsopt }
             //
             case 298: {
+               if constexpr (probe) { *found = true; break; }
                //#line 711 "GJavaParser.g"
                 setResult(
                     //#line 711 GJavaParser.g
@@ -3379,6 +3544,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 300:  SwitchBlockStatementGroups ::= SwitchBlockStatementGroups SwitchBlockStatementGroup
             //
             case 300: {
+               if constexpr (probe) { *found = true; break; }
                //#line 714 "GJavaParser.g"
                 setResult(
                     //#line 714 GJavaParser.g
@@ -3395,6 +3561,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 301:  SwitchBlockStatementGroup ::= SwitchLabels BlockStatements
             //
             case 301: {
+               if constexpr (probe) { *found = true; break; }
                //#line 716 "GJavaParser.g"
                 setResult(
                     //#line 716 GJavaParser.g
@@ -3416,6 +3583,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 303:  SwitchLabels ::= SwitchLabels SwitchLabel
             //
             case 303: {
+               if constexpr (probe) { *found = true; break; }
                //#line 719 "GJavaParser.g"
                 setResult(
                     //#line 719 GJavaParser.g
@@ -3432,6 +3600,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 304:  SwitchLabel ::= case ConstantExpression :
             //
             case 304: {
+               if constexpr (probe) { *found = true; break; }
                //#line 721 "GJavaParser.g"
                 setResult(
                     //#line 721 GJavaParser.g
@@ -3450,6 +3619,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 305:  SwitchLabel ::= case EnumConstant :
             //
             case 305: {
+               if constexpr (probe) { *found = true; break; }
                //#line 722 "GJavaParser.g"
                 setResult(
                     //#line 722 GJavaParser.g
@@ -3468,6 +3638,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 306:  SwitchLabel ::= default :
             //
             case 306: {
+               if constexpr (probe) { *found = true; break; }
                //#line 723 "GJavaParser.g"
                 setResult(
                     //#line 723 GJavaParser.g
@@ -3489,6 +3660,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 308:  WhileStatement ::= while ( Expression ) Statement
             //
             case 308: {
+               if constexpr (probe) { *found = true; break; }
                //#line 727 "GJavaParser.g"
                 setResult(
                     //#line 727 GJavaParser.g
@@ -3511,6 +3683,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 309:  WhileStatementNoShortIf ::= while ( Expression ) StatementNoShortIf
             //
             case 309: {
+               if constexpr (probe) { *found = true; break; }
                //#line 729 "GJavaParser.g"
                 setResult(
                     //#line 729 GJavaParser.g
@@ -3533,6 +3706,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 310:  DoStatement ::= do Statement while ( Expression ) ;
             //
             case 310: {
+               if constexpr (probe) { *found = true; break; }
                //#line 731 "GJavaParser.g"
                 setResult(
                     //#line 731 GJavaParser.g
@@ -3569,6 +3743,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 313:  BasicForStatement ::= for ( ForInitopt ; Expressionopt ; ForUpdateopt ) Statement
             //
             case 313: {
+               if constexpr (probe) { *found = true; break; }
                //#line 736 "GJavaParser.g"
                 setResult(
                     //#line 736 GJavaParser.g
@@ -3599,6 +3774,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 314:  ForStatementNoShortIf ::= for ( ForInitopt ; Expressionopt ; ForUpdateopt ) StatementNoShortIf
             //
             case 314: {
+               if constexpr (probe) { *found = true; break; }
                //#line 738 "GJavaParser.g"
                 setResult(
                     //#line 738 GJavaParser.g
@@ -3649,6 +3825,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 319:  StatementExpressionList ::= StatementExpressionList , StatementExpression
             //
             case 319: {
+               if constexpr (probe) { *found = true; break; }
                //#line 746 "GJavaParser.g"
                 setResult(
                     //#line 746 GJavaParser.g
@@ -3667,6 +3844,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 320:  EnhancedForStatement ::= for ( FormalParameter : Expression ) Statement
             //
             case 320: {
+               if constexpr (probe) { *found = true; break; }
                //#line 748 "GJavaParser.g"
                 setResult(
                     //#line 748 GJavaParser.g
@@ -3693,6 +3871,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 321:  BreakStatement ::= break identifieropt ;
             //
             case 321: {
+               if constexpr (probe) { *found = true; break; }
                //#line 750 "GJavaParser.g"
                 setResult(
                     //#line 750 GJavaParser.g
@@ -3711,6 +3890,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 322:  ContinueStatement ::= continue identifieropt ;
             //
             case 322: {
+               if constexpr (probe) { *found = true; break; }
                //#line 752 "GJavaParser.g"
                 setResult(
                     //#line 752 GJavaParser.g
@@ -3729,6 +3909,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 323:  ReturnStatement ::= return Expressionopt ;
             //
             case 323: {
+               if constexpr (probe) { *found = true; break; }
                //#line 754 "GJavaParser.g"
                 setResult(
                     //#line 754 GJavaParser.g
@@ -3747,6 +3928,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 324:  ThrowStatement ::= throw Expression ;
             //
             case 324: {
+               if constexpr (probe) { *found = true; break; }
                //#line 756 "GJavaParser.g"
                 setResult(
                     //#line 756 GJavaParser.g
@@ -3765,6 +3947,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 325:  SynchronizedStatement ::= synchronized ( Expression ) Block
             //
             case 325: {
+               if constexpr (probe) { *found = true; break; }
                //#line 758 "GJavaParser.g"
                 setResult(
                     //#line 758 GJavaParser.g
@@ -3787,6 +3970,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 326:  TryStatement ::= try Block Catches
             //
             case 326: {
+               if constexpr (probe) { *found = true; break; }
                //#line 760 "GJavaParser.g"
                 setResult(
                     //#line 760 GJavaParser.g
@@ -3805,6 +3989,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 327:  TryStatement ::= try Block Catchesopt Finally
             //
             case 327: {
+               if constexpr (probe) { *found = true; break; }
                //#line 761 "GJavaParser.g"
                 setResult(
                     //#line 761 GJavaParser.g
@@ -3830,6 +4015,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 329:  Catches ::= Catches CatchClause
             //
             case 329: {
+               if constexpr (probe) { *found = true; break; }
                //#line 764 "GJavaParser.g"
                 setResult(
                     //#line 764 GJavaParser.g
@@ -3846,6 +4032,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 330:  CatchClause ::= catch ( FormalParameter ) Block
             //
             case 330: {
+               if constexpr (probe) { *found = true; break; }
                //#line 766 "GJavaParser.g"
                 setResult(
                     //#line 766 GJavaParser.g
@@ -3868,6 +4055,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 331:  Finally ::= finally Block
             //
             case 331: {
+               if constexpr (probe) { *found = true; break; }
                //#line 768 "GJavaParser.g"
                 setResult(
                     //#line 768 GJavaParser.g
@@ -3899,6 +4087,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 335:  PrimaryNoNewArray ::= Type . class
             //
             case 335: {
+               if constexpr (probe) { *found = true; break; }
                //#line 784 "GJavaParser.g"
                 setResult(
                     //#line 784 GJavaParser.g
@@ -3917,6 +4106,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 336:  PrimaryNoNewArray ::= void . class
             //
             case 336: {
+               if constexpr (probe) { *found = true; break; }
                //#line 785 "GJavaParser.g"
                 setResult(
                     //#line 785 GJavaParser.g
@@ -3935,6 +4125,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 337:  PrimaryNoNewArray ::= this
             //
             case 337: {
+               if constexpr (probe) { *found = true; break; }
                //#line 786 "GJavaParser.g"
                 setResult(
                     //#line 786 GJavaParser.g
@@ -3947,6 +4138,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 338:  PrimaryNoNewArray ::= ClassName . this
             //
             case 338: {
+               if constexpr (probe) { *found = true; break; }
                //#line 787 "GJavaParser.g"
                 setResult(
                     //#line 787 GJavaParser.g
@@ -3965,6 +4157,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 339:  PrimaryNoNewArray ::= ( Expression )
             //
             case 339: {
+               if constexpr (probe) { *found = true; break; }
                //#line 788 "GJavaParser.g"
                 setResult(
                     //#line 788 GJavaParser.g
@@ -4003,6 +4196,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 344:  Literal ::= IntegerLiteral
             //
             case 344: {
+               if constexpr (probe) { *found = true; break; }
                //#line 794 "GJavaParser.g"
                 setResult(
                     //#line 794 GJavaParser.g
@@ -4015,6 +4209,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 345:  Literal ::= LongLiteral
             //
             case 345: {
+               if constexpr (probe) { *found = true; break; }
                //#line 795 "GJavaParser.g"
                 setResult(
                     //#line 795 GJavaParser.g
@@ -4027,6 +4222,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 346:  Literal ::= FloatingPointLiteral
             //
             case 346: {
+               if constexpr (probe) { *found = true; break; }
                //#line 796 "GJavaParser.g"
                 setResult(
                     //#line 796 GJavaParser.g
@@ -4039,6 +4235,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 347:  Literal ::= DoubleLiteral
             //
             case 347: {
+               if constexpr (probe) { *found = true; break; }
                //#line 797 "GJavaParser.g"
                 setResult(
                     //#line 797 GJavaParser.g
@@ -4056,6 +4253,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 349:  Literal ::= CharacterLiteral
             //
             case 349: {
+               if constexpr (probe) { *found = true; break; }
                //#line 799 "GJavaParser.g"
                 setResult(
                     //#line 799 GJavaParser.g
@@ -4068,6 +4266,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 350:  Literal ::= StringLiteral
             //
             case 350: {
+               if constexpr (probe) { *found = true; break; }
                //#line 800 "GJavaParser.g"
                 setResult(
                     //#line 800 GJavaParser.g
@@ -4080,6 +4279,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 351:  Literal ::= null
             //
             case 351: {
+               if constexpr (probe) { *found = true; break; }
                //#line 801 "GJavaParser.g"
                 setResult(
                     //#line 801 GJavaParser.g
@@ -4092,6 +4292,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 352:  BooleanLiteral ::= true
             //
             case 352: {
+               if constexpr (probe) { *found = true; break; }
                //#line 803 "GJavaParser.g"
                 setResult(
                     //#line 803 GJavaParser.g
@@ -4104,6 +4305,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 353:  BooleanLiteral ::= false
             //
             case 353: {
+               if constexpr (probe) { *found = true; break; }
                //#line 804 "GJavaParser.g"
                 setResult(
                     //#line 804 GJavaParser.g
@@ -4116,6 +4318,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 354:  ClassInstanceCreationExpression ::= new TypeArgumentsopt ClassOrInterfaceType TypeArgumentsopt ( ArgumentListopt ) ClassBodyopt
             //
             case 354: {
+               if constexpr (probe) { *found = true; break; }
                //#line 811 "GJavaParser.g"
                 setResult(
                     //#line 811 GJavaParser.g
@@ -4144,6 +4347,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 355:  ClassInstanceCreationExpression ::= Primary . new TypeArgumentsopt identifier TypeArgumentsopt ( ArgumentListopt ) ClassBodyopt
             //
             case 355: {
+               if constexpr (probe) { *found = true; break; }
                //#line 812 "GJavaParser.g"
                 setResult(
                     //#line 812 GJavaParser.g
@@ -4181,6 +4385,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 357:  ArgumentList ::= ArgumentList , Expression
             //
             case 357: {
+               if constexpr (probe) { *found = true; break; }
                //#line 816 "GJavaParser.g"
                 setResult(
                     //#line 816 GJavaParser.g
@@ -4199,6 +4404,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 358:  ArrayCreationExpression ::= new PrimitiveType DimExprs Dimsopt
             //
             case 358: {
+               if constexpr (probe) { *found = true; break; }
                //#line 826 "GJavaParser.g"
                 setResult(
                     //#line 826 GJavaParser.g
@@ -4219,6 +4425,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 359:  ArrayCreationExpression ::= new ClassOrInterfaceType DimExprs Dimsopt
             //
             case 359: {
+               if constexpr (probe) { *found = true; break; }
                //#line 827 "GJavaParser.g"
                 setResult(
                     //#line 827 GJavaParser.g
@@ -4239,6 +4446,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 360:  ArrayCreationExpression ::= new PrimitiveType Dims ArrayInitializer
             //
             case 360: {
+               if constexpr (probe) { *found = true; break; }
                //#line 828 "GJavaParser.g"
                 setResult(
                     //#line 828 GJavaParser.g
@@ -4259,6 +4467,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 361:  ArrayCreationExpression ::= new ClassOrInterfaceType Dims ArrayInitializer
             //
             case 361: {
+               if constexpr (probe) { *found = true; break; }
                //#line 829 "GJavaParser.g"
                 setResult(
                     //#line 829 GJavaParser.g
@@ -4284,6 +4493,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 363:  DimExprs ::= DimExprs DimExpr
             //
             case 363: {
+               if constexpr (probe) { *found = true; break; }
                //#line 832 "GJavaParser.g"
                 setResult(
                     //#line 832 GJavaParser.g
@@ -4300,6 +4510,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 364:  DimExpr ::= [ Expression ]
             //
             case 364: {
+               if constexpr (probe) { *found = true; break; }
                //#line 834 "GJavaParser.g"
                 setResult(
                     //#line 834 GJavaParser.g
@@ -4318,6 +4529,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 365:  Dims ::= [ ]
             //
             case 365: {
+               if constexpr (probe) { *found = true; break; }
                //#line 836 "GJavaParser.g"
                 setResult(
                     //#line 836 GJavaParser.g
@@ -4334,6 +4546,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 366:  Dims ::= Dims [ ]
             //
             case 366: {
+               if constexpr (probe) { *found = true; break; }
                //#line 837 "GJavaParser.g"
                 setResult(
                     //#line 837 GJavaParser.g
@@ -4352,6 +4565,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 367:  FieldAccess ::= Primary . identifier
             //
             case 367: {
+               if constexpr (probe) { *found = true; break; }
                //#line 839 "GJavaParser.g"
                 setResult(
                     //#line 839 GJavaParser.g
@@ -4370,6 +4584,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 368:  FieldAccess ::= super . identifier
             //
             case 368: {
+               if constexpr (probe) { *found = true; break; }
                //#line 840 "GJavaParser.g"
                 setResult(
                     //#line 840 GJavaParser.g
@@ -4388,6 +4603,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 369:  FieldAccess ::= ClassName . super . identifier
             //
             case 369: {
+               if constexpr (probe) { *found = true; break; }
                //#line 841 "GJavaParser.g"
                 setResult(
                     //#line 841 GJavaParser.g
@@ -4410,6 +4626,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 370:  MethodInvocation ::= MethodName ( ArgumentListopt )
             //
             case 370: {
+               if constexpr (probe) { *found = true; break; }
                //#line 843 "GJavaParser.g"
                 setResult(
                     //#line 843 GJavaParser.g
@@ -4430,6 +4647,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 371:  MethodInvocation ::= Primary . TypeArgumentsopt identifier ( ArgumentListopt )
             //
             case 371: {
+               if constexpr (probe) { *found = true; break; }
                //#line 844 "GJavaParser.g"
                 setResult(
                     //#line 844 GJavaParser.g
@@ -4456,6 +4674,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 372:  MethodInvocation ::= super . TypeArgumentsopt identifier ( ArgumentListopt )
             //
             case 372: {
+               if constexpr (probe) { *found = true; break; }
                //#line 845 "GJavaParser.g"
                 setResult(
                     //#line 845 GJavaParser.g
@@ -4482,6 +4701,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 373:  MethodInvocation ::= ClassName . super . TypeArgumentsopt identifier ( ArgumentListopt )
             //
             case 373: {
+               if constexpr (probe) { *found = true; break; }
                //#line 846 "GJavaParser.g"
                 setResult(
                     //#line 846 GJavaParser.g
@@ -4512,6 +4732,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 374:  MethodInvocation ::= TypeName . TypeArguments identifier ( ArgumentListopt )
             //
             case 374: {
+               if constexpr (probe) { *found = true; break; }
                //#line 847 "GJavaParser.g"
                 setResult(
                     //#line 847 GJavaParser.g
@@ -4538,6 +4759,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 375:  ArrayAccess ::= ExpressionName [ Expression ]
             //
             case 375: {
+               if constexpr (probe) { *found = true; break; }
                //#line 855 "GJavaParser.g"
                 setResult(
                     //#line 855 GJavaParser.g
@@ -4558,6 +4780,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 376:  ArrayAccess ::= PrimaryNoNewArray [ Expression ]
             //
             case 376: {
+               if constexpr (probe) { *found = true; break; }
                //#line 856 "GJavaParser.g"
                 setResult(
                     //#line 856 GJavaParser.g
@@ -4598,6 +4821,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 381:  PostIncrementExpression ::= PostfixExpression ++
             //
             case 381: {
+               if constexpr (probe) { *found = true; break; }
                //#line 863 "GJavaParser.g"
                 setResult(
                     //#line 863 GJavaParser.g
@@ -4614,6 +4838,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 382:  PostDecrementExpression ::= PostfixExpression --
             //
             case 382: {
+               if constexpr (probe) { *found = true; break; }
                //#line 865 "GJavaParser.g"
                 setResult(
                     //#line 865 GJavaParser.g
@@ -4640,6 +4865,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 385:  UnaryExpression ::= + UnaryExpression
             //
             case 385: {
+               if constexpr (probe) { *found = true; break; }
                //#line 869 "GJavaParser.g"
                 setResult(
                     //#line 869 GJavaParser.g
@@ -4656,6 +4882,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 386:  UnaryExpression ::= - UnaryExpression
             //
             case 386: {
+               if constexpr (probe) { *found = true; break; }
                //#line 870 "GJavaParser.g"
                 setResult(
                     //#line 870 GJavaParser.g
@@ -4677,6 +4904,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 388:  PreIncrementExpression ::= ++ UnaryExpression
             //
             case 388: {
+               if constexpr (probe) { *found = true; break; }
                //#line 873 "GJavaParser.g"
                 setResult(
                     //#line 873 GJavaParser.g
@@ -4693,6 +4921,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 389:  PreDecrementExpression ::= -- UnaryExpression
             //
             case 389: {
+               if constexpr (probe) { *found = true; break; }
                //#line 875 "GJavaParser.g"
                 setResult(
                     //#line 875 GJavaParser.g
@@ -4714,6 +4943,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 391:  UnaryExpressionNotPlusMinus ::= ~ UnaryExpression
             //
             case 391: {
+               if constexpr (probe) { *found = true; break; }
                //#line 878 "GJavaParser.g"
                 setResult(
                     //#line 878 GJavaParser.g
@@ -4730,6 +4960,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 392:  UnaryExpressionNotPlusMinus ::= ! UnaryExpression
             //
             case 392: {
+               if constexpr (probe) { *found = true; break; }
                //#line 879 "GJavaParser.g"
                 setResult(
                     //#line 879 GJavaParser.g
@@ -4751,6 +4982,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 394:  CastExpression ::= ( PrimitiveType Dimsopt ) UnaryExpression
             //
             case 394: {
+               if constexpr (probe) { *found = true; break; }
                //#line 882 "GJavaParser.g"
                 setResult(
                     //#line 882 GJavaParser.g
@@ -4773,6 +5005,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 395:  CastExpression ::= ( ReferenceType ) UnaryExpressionNotPlusMinus
             //
             case 395: {
+               if constexpr (probe) { *found = true; break; }
                //#line 883 "GJavaParser.g"
                 setResult(
                     //#line 883 GJavaParser.g
@@ -4798,6 +5031,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 397:  MultiplicativeExpression ::= MultiplicativeExpression * UnaryExpression
             //
             case 397: {
+               if constexpr (probe) { *found = true; break; }
                //#line 886 "GJavaParser.g"
                 setResult(
                     //#line 886 GJavaParser.g
@@ -4816,6 +5050,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 398:  MultiplicativeExpression ::= MultiplicativeExpression / UnaryExpression
             //
             case 398: {
+               if constexpr (probe) { *found = true; break; }
                //#line 887 "GJavaParser.g"
                 setResult(
                     //#line 887 GJavaParser.g
@@ -4834,6 +5069,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 399:  MultiplicativeExpression ::= MultiplicativeExpression % UnaryExpression
             //
             case 399: {
+               if constexpr (probe) { *found = true; break; }
                //#line 888 "GJavaParser.g"
                 setResult(
                     //#line 888 GJavaParser.g
@@ -4857,6 +5093,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 401:  AdditiveExpression ::= AdditiveExpression + MultiplicativeExpression
             //
             case 401: {
+               if constexpr (probe) { *found = true; break; }
                //#line 891 "GJavaParser.g"
                 setResult(
                     //#line 891 GJavaParser.g
@@ -4875,6 +5112,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 402:  AdditiveExpression ::= AdditiveExpression - MultiplicativeExpression
             //
             case 402: {
+               if constexpr (probe) { *found = true; break; }
                //#line 892 "GJavaParser.g"
                 setResult(
                     //#line 892 GJavaParser.g
@@ -4898,6 +5136,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 404:  ShiftExpression ::= ShiftExpression << AdditiveExpression
             //
             case 404: {
+               if constexpr (probe) { *found = true; break; }
                //#line 895 "GJavaParser.g"
                 setResult(
                     //#line 895 GJavaParser.g
@@ -4916,6 +5155,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 405:  ShiftExpression ::= ShiftExpression > > AdditiveExpression
             //
             case 405: {
+               if constexpr (probe) { *found = true; break; }
                //#line 896 "GJavaParser.g"
                 setResult(
                     //#line 896 GJavaParser.g
@@ -4936,6 +5176,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 406:  ShiftExpression ::= ShiftExpression > > > AdditiveExpression
             //
             case 406: {
+               if constexpr (probe) { *found = true; break; }
                //#line 897 "GJavaParser.g"
                 setResult(
                     //#line 897 GJavaParser.g
@@ -4963,6 +5204,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 408:  RelationalExpression ::= RelationalExpression < ShiftExpression
             //
             case 408: {
+               if constexpr (probe) { *found = true; break; }
                //#line 900 "GJavaParser.g"
                 setResult(
                     //#line 900 GJavaParser.g
@@ -4981,6 +5223,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 409:  RelationalExpression ::= RelationalExpression > ShiftExpression
             //
             case 409: {
+               if constexpr (probe) { *found = true; break; }
                //#line 901 "GJavaParser.g"
                 setResult(
                     //#line 901 GJavaParser.g
@@ -4999,6 +5242,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 410:  RelationalExpression ::= RelationalExpression <= ShiftExpression
             //
             case 410: {
+               if constexpr (probe) { *found = true; break; }
                //#line 902 "GJavaParser.g"
                 setResult(
                     //#line 902 GJavaParser.g
@@ -5017,6 +5261,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 411:  RelationalExpression ::= RelationalExpression > = ShiftExpression
             //
             case 411: {
+               if constexpr (probe) { *found = true; break; }
                //#line 903 "GJavaParser.g"
                 setResult(
                     //#line 903 GJavaParser.g
@@ -5037,6 +5282,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 412:  RelationalExpression ::= RelationalExpression instanceof ReferenceType
             //
             case 412: {
+               if constexpr (probe) { *found = true; break; }
                //#line 904 "GJavaParser.g"
                 setResult(
                     //#line 904 GJavaParser.g
@@ -5060,6 +5306,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 414:  EqualityExpression ::= EqualityExpression == RelationalExpression
             //
             case 414: {
+               if constexpr (probe) { *found = true; break; }
                //#line 907 "GJavaParser.g"
                 setResult(
                     //#line 907 GJavaParser.g
@@ -5078,6 +5325,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 415:  EqualityExpression ::= EqualityExpression != RelationalExpression
             //
             case 415: {
+               if constexpr (probe) { *found = true; break; }
                //#line 908 "GJavaParser.g"
                 setResult(
                     //#line 908 GJavaParser.g
@@ -5101,6 +5349,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 417:  AndExpression ::= AndExpression & EqualityExpression
             //
             case 417: {
+               if constexpr (probe) { *found = true; break; }
                //#line 911 "GJavaParser.g"
                 setResult(
                     //#line 911 GJavaParser.g
@@ -5124,6 +5373,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 419:  ExclusiveOrExpression ::= ExclusiveOrExpression ^ AndExpression
             //
             case 419: {
+               if constexpr (probe) { *found = true; break; }
                //#line 914 "GJavaParser.g"
                 setResult(
                     //#line 914 GJavaParser.g
@@ -5147,6 +5397,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 421:  InclusiveOrExpression ::= InclusiveOrExpression | ExclusiveOrExpression
             //
             case 421: {
+               if constexpr (probe) { *found = true; break; }
                //#line 917 "GJavaParser.g"
                 setResult(
                     //#line 917 GJavaParser.g
@@ -5170,6 +5421,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 423:  ConditionalAndExpression ::= ConditionalAndExpression && InclusiveOrExpression
             //
             case 423: {
+               if constexpr (probe) { *found = true; break; }
                //#line 920 "GJavaParser.g"
                 setResult(
                     //#line 920 GJavaParser.g
@@ -5193,6 +5445,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 425:  ConditionalOrExpression ::= ConditionalOrExpression || ConditionalAndExpression
             //
             case 425: {
+               if constexpr (probe) { *found = true; break; }
                //#line 923 "GJavaParser.g"
                 setResult(
                     //#line 923 GJavaParser.g
@@ -5216,6 +5469,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 427:  ConditionalExpression ::= ConditionalOrExpression ? Expression : ConditionalExpression
             //
             case 427: {
+               if constexpr (probe) { *found = true; break; }
                //#line 926 "GJavaParser.g"
                 setResult(
                     //#line 926 GJavaParser.g
@@ -5248,6 +5502,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 430:  Assignment ::= LeftHandSide AssignmentOperator AssignmentExpression
             //
             case 430: {
+               if constexpr (probe) { *found = true; break; }
                //#line 931 "GJavaParser.g"
                 setResult(
                     //#line 931 GJavaParser.g
@@ -5281,6 +5536,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 434:  AssignmentOperator ::= =
             //
             case 434: {
+               if constexpr (probe) { *found = true; break; }
                //#line 937 "GJavaParser.g"
                 setResult(
                     //#line 937 GJavaParser.g
@@ -5293,6 +5549,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 435:  AssignmentOperator ::= *=
             //
             case 435: {
+               if constexpr (probe) { *found = true; break; }
                //#line 938 "GJavaParser.g"
                 setResult(
                     //#line 938 GJavaParser.g
@@ -5305,6 +5562,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 436:  AssignmentOperator ::= /=
             //
             case 436: {
+               if constexpr (probe) { *found = true; break; }
                //#line 939 "GJavaParser.g"
                 setResult(
                     //#line 939 GJavaParser.g
@@ -5317,6 +5575,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 437:  AssignmentOperator ::= %=
             //
             case 437: {
+               if constexpr (probe) { *found = true; break; }
                //#line 940 "GJavaParser.g"
                 setResult(
                     //#line 940 GJavaParser.g
@@ -5329,6 +5588,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 438:  AssignmentOperator ::= +=
             //
             case 438: {
+               if constexpr (probe) { *found = true; break; }
                //#line 941 "GJavaParser.g"
                 setResult(
                     //#line 941 GJavaParser.g
@@ -5341,6 +5601,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 439:  AssignmentOperator ::= -=
             //
             case 439: {
+               if constexpr (probe) { *found = true; break; }
                //#line 942 "GJavaParser.g"
                 setResult(
                     //#line 942 GJavaParser.g
@@ -5353,6 +5614,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 440:  AssignmentOperator ::= <<=
             //
             case 440: {
+               if constexpr (probe) { *found = true; break; }
                //#line 943 "GJavaParser.g"
                 setResult(
                     //#line 943 GJavaParser.g
@@ -5365,6 +5627,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 441:  AssignmentOperator ::= > > =
             //
             case 441: {
+               if constexpr (probe) { *found = true; break; }
                //#line 944 "GJavaParser.g"
                 setResult(
                     //#line 944 GJavaParser.g
@@ -5383,6 +5646,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 442:  AssignmentOperator ::= > > > =
             //
             case 442: {
+               if constexpr (probe) { *found = true; break; }
                //#line 945 "GJavaParser.g"
                 setResult(
                     //#line 945 GJavaParser.g
@@ -5403,6 +5667,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 443:  AssignmentOperator ::= &=
             //
             case 443: {
+               if constexpr (probe) { *found = true; break; }
                //#line 946 "GJavaParser.g"
                 setResult(
                     //#line 946 GJavaParser.g
@@ -5415,6 +5680,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 444:  AssignmentOperator ::= ^=
             //
             case 444: {
+               if constexpr (probe) { *found = true; break; }
                //#line 947 "GJavaParser.g"
                 setResult(
                     //#line 947 GJavaParser.g
@@ -5427,6 +5693,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 445:  AssignmentOperator ::= |=
             //
             case 445: {
+               if constexpr (probe) { *found = true; break; }
                //#line 948 "GJavaParser.g"
                 setResult(
                     //#line 948 GJavaParser.g
@@ -5449,6 +5716,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 448:  Dimsopt ::= $Empty
             //
             case 448: {
+               if constexpr (probe) { *found = true; break; }
                //#line 957 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5462,6 +5730,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 450:  Catchesopt ::= $Empty
             //
             case 450: {
+               if constexpr (probe) { *found = true; break; }
                //#line 960 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5475,6 +5744,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 452:  identifieropt ::= $Empty
             //
             case 452: {
+               if constexpr (probe) { *found = true; break; }
                //#line 963 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5488,6 +5758,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 454:  ForUpdateopt ::= $Empty
             //
             case 454: {
+               if constexpr (probe) { *found = true; break; }
                //#line 966 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5501,6 +5772,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 456:  Expressionopt ::= $Empty
             //
             case 456: {
+               if constexpr (probe) { *found = true; break; }
                //#line 969 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5514,6 +5786,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 458:  ForInitopt ::= $Empty
             //
             case 458: {
+               if constexpr (probe) { *found = true; break; }
                //#line 972 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5527,6 +5800,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 460:  SwitchLabelsopt ::= $Empty
             //
             case 460: {
+               if constexpr (probe) { *found = true; break; }
                //#line 975 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5540,6 +5814,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 462:  SwitchBlockStatementGroupsopt ::= $Empty
             //
             case 462: {
+               if constexpr (probe) { *found = true; break; }
                //#line 978 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5553,6 +5828,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 464:  VariableModifiersopt ::= $Empty
             //
             case 464: {
+               if constexpr (probe) { *found = true; break; }
                //#line 981 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5566,6 +5842,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 466:  VariableInitializersopt ::= $Empty
             //
             case 466: {
+               if constexpr (probe) { *found = true; break; }
                //#line 984 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5579,6 +5856,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 468:  ElementValuesopt ::= $Empty
             //
             case 468: {
+               if constexpr (probe) { *found = true; break; }
                //#line 987 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5592,6 +5870,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 470:  ElementValuePairsopt ::= $Empty
             //
             case 470: {
+               if constexpr (probe) { *found = true; break; }
                //#line 990 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5605,6 +5884,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 472:  DefaultValueopt ::= $Empty
             //
             case 472: {
+               if constexpr (probe) { *found = true; break; }
                //#line 993 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5618,6 +5898,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 474:  AnnotationTypeElementDeclarationsopt ::= $Empty
             //
             case 474: {
+               if constexpr (probe) { *found = true; break; }
                //#line 996 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5631,6 +5912,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 476:  AbstractMethodModifiersopt ::= $Empty
             //
             case 476: {
+               if constexpr (probe) { *found = true; break; }
                //#line 999 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5644,6 +5926,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 478:  ConstantModifiersopt ::= $Empty
             //
             case 478: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1002 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5657,6 +5940,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 480:  InterfaceMemberDeclarationsopt ::= $Empty
             //
             case 480: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1005 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5670,6 +5954,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 482:  ExtendsInterfacesopt ::= $Empty
             //
             case 482: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1008 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5683,6 +5968,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 484:  InterfaceModifiersopt ::= $Empty
             //
             case 484: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1011 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5696,6 +5982,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 486:  ClassBodyopt ::= $Empty
             //
             case 486: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1014 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5709,6 +5996,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 488:  Argumentsopt ::= $Empty
             //
             case 488: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1017 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5722,6 +6010,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 490:  EnumBodyDeclarationsopt ::= $Empty
             //
             case 490: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1020 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5735,6 +6024,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 492:  ,opt ::= $Empty
             //
             case 492: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1023 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5743,6 +6033,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 493:  ,opt ::= ,
             //
             case 493: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1024 "GJavaParser.g"
                 setResult(
                     //#line 1024 GJavaParser.g
@@ -5755,6 +6046,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 494:  EnumConstantsopt ::= $Empty
             //
             case 494: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1026 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5768,6 +6060,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 496:  ArgumentListopt ::= $Empty
             //
             case 496: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1029 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5781,6 +6074,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 498:  BlockStatementsopt ::= $Empty
             //
             case 498: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1032 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5794,6 +6088,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 500:  ExplicitConstructorInvocationopt ::= $Empty
             //
             case 500: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1035 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5807,6 +6102,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 502:  ConstructorModifiersopt ::= $Empty
             //
             case 502: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1038 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5820,6 +6116,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 504:  ...opt ::= $Empty
             //
             case 504: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1041 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5828,6 +6125,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 505:  ...opt ::= ...
             //
             case 505: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1042 "GJavaParser.g"
                 setResult(
                     //#line 1042 GJavaParser.g
@@ -5840,6 +6138,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 506:  FormalParameterListopt ::= $Empty
             //
             case 506: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1044 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5853,6 +6152,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 508:  Throwsopt ::= $Empty
             //
             case 508: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1047 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5866,6 +6166,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 510:  MethodModifiersopt ::= $Empty
             //
             case 510: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1050 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5879,6 +6180,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 512:  FieldModifiersopt ::= $Empty
             //
             case 512: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1053 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5892,6 +6194,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 514:  ClassBodyDeclarationsopt ::= $Empty
             //
             case 514: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1056 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5905,6 +6208,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 516:  Interfacesopt ::= $Empty
             //
             case 516: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1059 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5918,6 +6222,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 518:  Superopt ::= $Empty
             //
             case 518: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1062 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5931,6 +6236,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 520:  TypeParametersopt ::= $Empty
             //
             case 520: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1065 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5944,6 +6250,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 522:  ClassModifiersopt ::= $Empty
             //
             case 522: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1068 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5957,6 +6264,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 524:  Annotationsopt ::= $Empty
             //
             case 524: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1071 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5970,6 +6278,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 526:  TypeDeclarationsopt ::= $Empty
             //
             case 526: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1074 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5983,6 +6292,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 528:  ImportDeclarationsopt ::= $Empty
             //
             case 528: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1077 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -5996,6 +6306,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 530:  PackageDeclarationopt ::= $Empty
             //
             case 530: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1080 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -6009,6 +6320,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 532:  WildcardBoundsOpt ::= $Empty
             //
             case 532: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1083 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -6022,6 +6334,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 534:  AdditionalBoundListopt ::= $Empty
             //
             case 534: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1086 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -6035,6 +6348,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 536:  TypeBoundopt ::= $Empty
             //
             case 536: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1089 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -6048,6 +6362,7 @@ using namespace JavaParser_top_level_ast;
             // Rule 538:  TypeArgumentsopt ::= $Empty
             //
             case 538: {
+               if constexpr (probe) { *found = true; break; }
                //#line 1092 "GJavaParser.g"
                 setResult(nullptr);
             break;
@@ -6057,7 +6372,7 @@ using namespace JavaParser_top_level_ast;
             //
             case 539:
                 break;
-    //#line 368 "btParserTemplateF.gi
+    //#line 393 "btParserTemplateF.gi
 
     
             default:
@@ -6066,3 +6381,13 @@ using namespace JavaParser_top_level_ast;
         return;
     }
 
+     void JavaParser::ruleAction(int ruleNumber)
+    {
+        ruleAction<false>(ruleNumber, nullptr);
+    }
+
+     const unsigned char* JavaParser::getRuleActionMap()
+    {
+        static const std::vector<unsigned char> map = findRuleActions(this, JavaParserprs::NUM_RULES);
+        return map.data();
+    }
@@ -14,17 +14,18 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
-    //#line 163 "btParserTemplateF.gi
+    //#line 180 "btParserTemplateF.gi
 
 #pragma once
 
 #include <iostream>
 #include "AstPoolHolder.h"
-#include "BacktrackingParser.h"
+#include "BacktrackingParserT.h"
 #include "DeterministicParser.h"
 #include "diagnose.h"
 #include "ErrorToken.h"
 #include "Exception.h"
+#include "GeneratedParseTable.h"
 #include "IAbstractArrayList.h"
 #include "IAst.h"
 #include "IAstVisitor.h"
@@ -43,7 +44,7 @@
 
 
 
-    //#line 190 "btParserTemplateF.gi
+    //#line 208 "btParserTemplateF.gi
 
 namespace JavaParser_top_level_ast {
 	struct Ast;
@@ -59,7 +60,7 @@ namespace JavaParser_top_level_ast {
     }
      bool unimplementedSymbolsWarning = false;
 
-     inline static ParseTable* prsTable = new JavaParserprs();
+     inline static ParseTable* prsTable = new GeneratedParseTable<JavaParserprs>();
      ParseTable* getParseTable() { return prsTable; }
 
      BacktrackingParser* btParser = nullptr;
@@ -135,7 +136,7 @@ namespace JavaParser_top_level_ast {
     {
         try
         {
-            btParser = new BacktrackingParser(prsStream, prsTable,  this);
+            btParser = new BacktrackingParserT<JavaParserprs, JavaParser>(prsStream, prsTable,  this);
         }
         catch (NotBacktrackParseTableException& e)
         {
@@ -208,7 +209,14 @@ namespace JavaParser_top_level_ast {
 
         return nullptr;
     }
+     //
+     // The actions of the rules, or, with probe, whether a rule has one
+     // (see findRuleActions).
+     //
+     template <bool probe>
+     void ruleAction(int ruleNumber, bool* found);
      void ruleAction(int ruleNumber);
+     const unsigned char* getRuleActionMap();
     //
     // Additional entry points, if any
     //
@@ -282,7 +290,7 @@ namespace JavaParser_top_level_ast {
     }
 
 
-    //#line 364 "btParserTemplateF.gi
+    //#line 389 "btParserTemplateF.gi
 
 };
 
@@ -12,27 +12,29 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
-    //#line 123 "LexerTemplateF.gi
+    //#line 141 "LexerTemplateF.gi
 
 
     //#line 7 "LPGLexer.gi
 
 
 
-    //#line 128 "LexerTemplateF.gi
+    //#line 146 "LexerTemplateF.gi
 
 #pragma once  
 #include <iostream>
 #include "IPrsStream.h"
 #include "Object.h"
+#include "GeneratedParseTable.h"
 #include "ParseTable.h"
 #include "RuleAction.h"
 #include "stringex.h"
 #include "Token.h"
 #include "LPGLexersym.h"
-#include "LPGLexerprs.h"
+#include "LPGLexerdirect.h"
 #include "LPGKWLexer.h"
 #include "LexParser.h"
+#include "LexParserT.h"
 #include "LpgLexStream.h"
  struct LPGLexer :public Object ,public RuleAction
 {
@@ -44,10 +46,10 @@
         delete lexParser;
     }
 
-     inline  static ParseTable* prs = new LPGLexerprs();
+     inline  static ParseTable* prs = new GeneratedParseTable<LPGLexerdirect>();
      ParseTable* getParseTable() { return prs; }
 
-     LexParser* lexParser = new LexParser();
+     LexParser* lexParser = new LexParserT<LPGLexerLpgLexStream, LPGLexerdirect, LPGLexer>();
      LexParser* getParser() { return lexParser; }
 
      int getToken(int i) { return lexParser->getToken(i); }
@@ -213,7 +215,7 @@
         lexStream->setStreamLength(input_chars.size());
         lexStream->computeLineOffsets(repair_offset);
 
-        int first_new_token_index = lexStream->getIPrsStream()->getTokens().size(),
+        int first_new_token_index = lexStream->getIPrsStream()->getSize(),
             first_new_adjunct_index = lexStream->getIPrsStream()->getAdjuncts().size();
         
         resetKeywordLexer();
@@ -242,9 +244,9 @@
         //
         IToken* first_new_token = nullptr;
           IToken*      last_new_token = nullptr;
-        if (first_new_token_index < lexStream->getIPrsStream()->getTokens().size()) {
+        if (first_new_token_index < lexStream->getIPrsStream()->getSize()) {
             first_new_token = lexStream->getIPrsStream()->getTokenAt(first_new_token_index);
-            last_new_token = lexStream->getIPrsStream()->getTokenAt(lexStream->getIPrsStream()->getTokens().size() - 1);
+            last_new_token = lexStream->getIPrsStream()->getTokenAt(lexStream->getIPrsStream()->getSize() - 1);
         }
         //
         // If an adjunct was added prior to the first real token, chose it instead as the first token.
@@ -304,6 +306,36 @@
     //#line 12 "LPGLexer.gi
 
    wchar_t escape_token='$';
+
+    //
+    // White space and single-line comments are scanned here a vector of
+    // characters at a time, rather than by the automaton (see
+    // RuleAction::scanSkippedTokens).
+    //
+     int scanSkippedTokens(int offset)
+    {
+        int length = lexStream->getStreamLength();
+        for (;;)
+        {
+            int c = (offset < length ? lexStream->getCharValue(offset) : 0xffff),
+                next = (offset + 1 < length ? lexStream->getCharValue(offset + 1) : 0xffff),
+                end;
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f') // Token ::= white
+            {
+                end = lexStream->skipWhitespace(offset + 1);
+                if (printTokens) printValue(offset, end - 1);
+            }
+            else if (c == '-' && next == '-') // Token ::= singleLineComment
+            {
+                end = lexStream->findLineEnd(offset + 2);
+                lexStream->getIPrsStream()->makeAdjunct(offset, end - 1, LPGParsersym::TK_SINGLE_LINE_COMMENT);
+            }
+            else break;
+
+            offset = end;
+        }
+        return offset;
+    }
  
     //#line 5 "LexerBasicMapF.gi
 
@@ -556,9 +588,25 @@
     }
     };
 
-    //#line 412 "LexerTemplateF.gi
+    //#line 432 "LexerTemplateF.gi
 
      void ruleAction(int ruleNumber)
+    {
+        ruleAction<false>(ruleNumber, nullptr);
+    }
+
+     const unsigned char* getRuleActionMap()
+    {
+        static const std::vector<unsigned char> map = findRuleActions(this, LPGLexerprs::NUM_RULES);
+        return map.data();
+    }
+
+    //
+    // The actions of the rules, or, with probe, whether a rule has one
+    // (see findRuleActions).
+    //
+     template <bool probe>
+     void ruleAction(int ruleNumber, bool* found)
     {
         switch(ruleNumber)
         {
@@ -566,98 +614,112 @@
             //
             // Rule 1:  Token ::= white
             //
-            case 1: { 
+            case 1: {
+             if constexpr (probe) { *found = true; break; }
              skipToken();             break;
             }
 
             //
             // Rule 2:  Token ::= singleLineComment
             //
-            case 2: { 
+            case 2: {
+             if constexpr (probe) { *found = true; break; }
              makeComment(LPGParsersym::TK_SINGLE_LINE_COMMENT);             break;
             }
 
             //
             // Rule 4:  Token ::= MacroSymbol
             //
-            case 4: { 
+            case 4: {
+             if constexpr (probe) { *found = true; break; }
              checkForKeyWord();            break;
             }
 
             //
             // Rule 5:  Token ::= Symbol
             //
-            case 5: { 
+            case 5: {
+             if constexpr (probe) { *found = true; break; }
              checkForKeyWord(LPGParsersym::TK_SYMBOL);            break;
             }
 
             //
             // Rule 6:  Token ::= Block
             //
-            case 6: { 
+            case 6: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_BLOCK);            break;
             }
 
             //
             // Rule 7:  Token ::= Equivalence
             //
-            case 7: { 
+            case 7: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_EQUIVALENCE);            break;
             }
 
             //
             // Rule 8:  Token ::= Equivalence ?
             //
-            case 8: { 
+            case 8: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_PRIORITY_EQUIVALENCE);            break;
             }
 
             //
             // Rule 9:  Token ::= #
             //
-            case 9: { 
+            case 9: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_SHARP);            break;
             }
 
             //
             // Rule 10:  Token ::= Arrow
             //
-            case 10: { 
+            case 10: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_ARROW);            break;
             }
 
             //
             // Rule 11:  Token ::= Arrow ?
             //
-            case 11: { 
+            case 11: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_PRIORITY_ARROW);            break;
             }
 
             //
             // Rule 12:  Token ::= |
             //
-            case 12: { 
+            case 12: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_OR_MARKER);            break;
             }
 
             //
             // Rule 13:  Token ::= [
             //
-            case 13: { 
+            case 13: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_LEFT_BRACKET);            break;
             }
 
             //
             // Rule 14:  Token ::= ]
             //
-            case 14: { 
+            case 14: {
+             if constexpr (probe) { *found = true; break; }
              makeToken(LPGParsersym::TK_RIGHT_BRACKET);            break;
             }
 
             //
             // Rule 859:  OptionLines ::= OptionLineList
             //
-            case 859: { 
+            case 859: {
+            if constexpr (probe) { *found = true; break; }
             
                   // What ever needs to happen after the options have been 
                   // scanned must happen here.
@@ -667,7 +729,8 @@
             //
             // Rule 868:  options ::= % oO pP tT iI oO nN sS
             //
-            case 868: { 
+            case 868: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getLeftSpan(), getRightSpan(), LPGParsersym::TK_OPTIONS_KEY);
                     break;
@@ -676,21 +739,24 @@
             //
             // Rule 869:  OptionComment ::= singleLineComment
             //
-            case 869: { 
+            case 869: {
+             if constexpr (probe) { *found = true; break; }
              makeComment(LPGParsersym::TK_SINGLE_LINE_COMMENT);             break;
             }
 
             //
             // Rule 893:  separator ::= ,$comma
             //
-            case 893: { 
+            case 893: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getLeftSpan(), getRightSpan(), LPGParsersym::TK_COMMA);             break;
             }
 
             //
             // Rule 894:  option ::= action_block$ab optionWhite =$eq optionWhite ($lp optionWhite filename$fn optionWhite ,$comma1 optionWhite block_begin$bb optionWhite ,$comma2 optionWhite block_end$be optionWhite )$rp optionWhite
             //
-            case 894: { 
+            case 894: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -707,7 +773,8 @@
             //
             // Rule 897:  option ::= ast_block$ab optionWhite =$eq optionWhite ($lp optionWhite block_begin$bb optionWhite ,$comma2 optionWhite block_end$be optionWhite )$rp optionWhite
             //
-            case 897: { 
+            case 897: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -723,7 +790,8 @@
             //
             // Rule 902:  option ::= ast_directory$ad optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 902: { 
+            case 902: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -734,7 +802,8 @@
             //
             // Rule 905:  option ::= ast_type$at optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 905: { 
+            case 905: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -745,35 +814,40 @@
             //
             // Rule 908:  option ::= attributes$a optionWhite
             //
-            case 908: { 
+            case 908: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 909:  option ::= no attributes$a optionWhite
             //
-            case 909: { 
+            case 909: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 911:  option ::= automatic_ast$a optionWhite
             //
-            case 911: { 
+            case 911: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 912:  option ::= no automatic_ast$a optionWhite
             //
-            case 912: { 
+            case 912: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 913:  option ::= automatic_ast$aa optionWhite =$eq optionWhite automatic_ast_value$val optionWhite
             //
-            case 913: { 
+            case 913: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -784,49 +858,56 @@
             //
             // Rule 919:  option ::= backtrack$b optionWhite
             //
-            case 919: { 
+            case 919: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 920:  option ::= no backtrack$b optionWhite
             //
-            case 920: { 
+            case 920: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 922:  option ::= byte$b optionWhite
             //
-            case 922: { 
+            case 922: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 923:  option ::= no byte$b optionWhite
             //
-            case 923: { 
+            case 923: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 925:  option ::= conflicts$c optionWhite
             //
-            case 925: { 
+            case 925: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 926:  option ::= no conflicts$c optionWhite
             //
-            case 926: { 
+            case 926: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 928:  option ::= dat_directory$dd optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 928: { 
+            case 928: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -837,7 +918,8 @@
             //
             // Rule 931:  option ::= dat_file$df optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 931: { 
+            case 931: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -848,7 +930,8 @@
             //
             // Rule 933:  option ::= dcl_file$df optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 933: { 
+            case 933: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -859,7 +942,8 @@
             //
             // Rule 935:  option ::= def_file$df optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 935: { 
+            case 935: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -870,49 +954,56 @@
             //
             // Rule 937:  option ::= debug$d optionWhite
             //
-            case 937: { 
+            case 937: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 938:  option ::= no debug$d optionWhite
             //
-            case 938: { 
+            case 938: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 940:  option ::= edit$e optionWhite
             //
-            case 940: { 
+            case 940: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 941:  option ::= no edit$e optionWhite
             //
-            case 941: { 
+            case 941: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 943:  option ::= error_maps$e optionWhite
             //
-            case 943: { 
+            case 943: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 944:  option ::= no error_maps$e optionWhite
             //
-            case 944: { 
+            case 944: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 947:  option ::= escape$e optionWhite =$eq optionWhite anyNonWhiteChar$val optionWhite
             //
-            case 947: { 
+            case 947: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -924,7 +1015,8 @@
             //
             // Rule 949:  option ::= export_terminals$et optionWhite =$eq optionWhite filename$fn optionWhite
             //
-            case 949: { 
+            case 949: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -935,7 +1027,8 @@
             //
             // Rule 950:  option ::= export_terminals$et optionWhite =$eq optionWhite ($lp optionWhite filename$fn optionWhite )$rp optionWhite
             //
-            case 950: { 
+            case 950: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -948,7 +1041,8 @@
             //
             // Rule 951:  option ::= export_terminals$et optionWhite =$eq optionWhite ($lp optionWhite filename$fn optionWhite ,$comma optionWhite export_prefix$ep optionWhite )$rp optionWhite
             //
-            case 951: { 
+            case 951: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -963,7 +1057,8 @@
             //
             // Rule 952:  option ::= export_terminals$et optionWhite =$eq optionWhite ($lp optionWhite filename$fn optionWhite ,$comma1 optionWhite export_prefix$ep optionWhite ,$comma2 optionWhite export_suffix$es optionWhite )$rp optionWhite
             //
-            case 952: { 
+            case 952: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -980,21 +1075,24 @@
             //
             // Rule 957:  option ::= extends_parsetable$e optionWhite
             //
-            case 957: { 
+            case 957: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 958:  option ::= no extends_parsetable$e optionWhite
             //
-            case 958: { 
+            case 958: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 959:  option ::= extends_parsetable$ep optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 959: { 
+            case 959: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1005,7 +1103,8 @@
             //
             // Rule 962:  option ::= factory$f optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 962: { 
+            case 962: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1016,7 +1115,8 @@
             //
             // Rule 964:  option ::= file_prefix$fp optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 964: { 
+            case 964: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1027,7 +1127,8 @@
             //
             // Rule 967:  option ::= filter$f optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 967: { 
+            case 967: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1038,49 +1139,56 @@
             //
             // Rule 969:  option ::= first$f optionWhite
             //
-            case 969: { 
+            case 969: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 970:  option ::= no first$f optionWhite
             //
-            case 970: { 
+            case 970: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 972:  option ::= follow$f optionWhite
             //
-            case 972: { 
+            case 972: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 973:  option ::= no follow$f optionWhite
             //
-            case 973: { 
+            case 973: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 975:  option ::= goto_default$g optionWhite
             //
-            case 975: { 
+            case 975: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 976:  option ::= no goto_default$g optionWhite
             //
-            case 976: { 
+            case 976: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 979:  option ::= headers$h optionWhite =$eq optionWhite ($lp optionWhite filename$fn optionWhite ,$comma1 optionWhite block_begin$bb optionWhite ,$comma2 optionWhite block_end$be optionWhite )$rp optionWhite
             //
-            case 979: { 
+            case 979: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1097,7 +1205,8 @@
             //
             // Rule 981:  option ::= imp_file$if optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 981: { 
+            case 981: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1108,7 +1217,8 @@
             //
             // Rule 984:  option ::= import_terminals$it optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 984: { 
+            case 984: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1119,7 +1229,8 @@
             //
             // Rule 987:  option ::= include_directory$id optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 987: { 
+            case 987: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1130,21 +1241,24 @@
             //
             // Rule 991:  option ::= lalr_level$l optionWhite
             //
-            case 991: { 
+            case 991: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 992:  option ::= no lalr_level$l optionWhite
             //
-            case 992: { 
+            case 992: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 993:  option ::= lalr_level$l optionWhite =$eq optionWhite number$val optionWhite
             //
-            case 993: { 
+            case 993: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1155,21 +1269,24 @@
             //
             // Rule 998:  option ::= list$l optionWhite
             //
-            case 998: { 
+            case 998: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 999:  option ::= no list$l optionWhite
             //
-            case 999: { 
+            case 999: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1001:  option ::= margin$m optionWhite =$eq optionWhite number$val optionWhite
             //
-            case 1001: { 
+            case 1001: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1180,7 +1297,8 @@
             //
             // Rule 1003:  option ::= max_cases$mc optionWhite =$eq optionWhite number$val optionWhite
             //
-            case 1003: { 
+            case 1003: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1191,21 +1309,24 @@
             //
             // Rule 1006:  option ::= names$n optionWhite
             //
-            case 1006: { 
+            case 1006: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1007:  option ::= no names$n optionWhite
             //
-            case 1007: { 
+            case 1007: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1008:  option ::= names$n optionWhite =$eq optionWhite names_value$val optionWhite
             //
-            case 1008: { 
+            case 1008: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1216,21 +1337,24 @@
             //
             // Rule 1013:  option ::= nt_check$n optionWhite
             //
-            case 1013: { 
+            case 1013: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1014:  option ::= no nt_check$n optionWhite
             //
-            case 1014: { 
+            case 1014: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1017:  option ::= or_marker$om optionWhite =$eq optionWhite anyNonWhiteChar$val optionWhite
             //
-            case 1017: { 
+            case 1017: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1241,7 +1365,8 @@
             //
             // Rule 1020:  option ::= out_directory$dd optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1020: { 
+            case 1020: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1252,21 +1377,24 @@
             //
             // Rule 1023:  option ::= parent_saved$ps optionWhite
             //
-            case 1023: { 
+            case 1023: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1024:  option ::= no parent_saved$ps optionWhite
             //
-            case 1024: { 
+            case 1024: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1027:  option ::= package$p optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1027: { 
+            case 1027: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1277,7 +1405,8 @@
             //
             // Rule 1029:  option ::= parsetable_interfaces$pi optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1029: { 
+            case 1029: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1288,7 +1417,8 @@
             //
             // Rule 1033:  option ::= prefix$p optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1033: { 
+            case 1033: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1299,21 +1429,24 @@
             //
             // Rule 1035:  option ::= priority$p optionWhite
             //
-            case 1035: { 
+            case 1035: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1036:  option ::= no priority$p optionWhite
             //
-            case 1036: { 
+            case 1036: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1038:  option ::= programming_language$pl optionWhite =$eq optionWhite programming_language_value$val optionWhite
             //
-            case 1038: { 
+            case 1038: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1324,7 +1457,8 @@
             //
             // Rule 1042:  option ::= prs_file$pf optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1042: { 
+            case 1042: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1335,147 +1469,168 @@
             //
             // Rule 1045:  option ::= quiet$q optionWhite
             //
-            case 1045: { 
+            case 1045: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1046:  option ::= no quiet$q optionWhite
             //
-            case 1046: { 
+            case 1046: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1048:  option ::= read_reduce$r optionWhite
             //
-            case 1048: { 
+            case 1048: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1049:  option ::= no read_reduce$r optionWhite
             //
-            case 1049: { 
+            case 1049: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1052:  option ::= remap_terminals$r optionWhite
             //
-            case 1052: { 
+            case 1052: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1053:  option ::= no remap_terminals$r optionWhite
             //
-            case 1053: { 
+            case 1053: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             }
 
             //
             // Rule 1056:  option ::= scopes$s optionWhite
             //
-            case 1056: { 
+            case 1056: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1057:  option ::= no scopes$s optionWhite
             //
-            case 1057: { 
+            case 1057: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1059:  option ::= serialize$s optionWhite
             //
-            case 1059: { 
+            case 1059: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1060:  option ::= no serialize$s optionWhite
             //
-            case 1060: { 
+            case 1060: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1062:  option ::= shift_default$s optionWhite
             //
-            case 1062: { 
+            case 1062: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1063:  option ::= no shift_default$s optionWhite
             //
-            case 1063: { 
+            case 1063: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1066:  option ::= single_productions$s optionWhite
             //
-            case 1066: { 
+            case 1066: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1067:  option ::= no single_productions$s optionWhite
             //
-            case 1067: { 
+            case 1067: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1070:  option ::= slr$s optionWhite
             //
-            case 1070: { 
+            case 1070: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1071:  option ::= no slr$s optionWhite
             //
-            case 1071: { 
+            case 1071: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1073:  option ::= soft_keywords$s optionWhite
             //
-            case 1073: { 
+            case 1073: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1074:  option ::= no soft_keywords$s optionWhite
             //
-            case 1074: { 
+            case 1074: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1078:  option ::= states$s optionWhite
             //
-            case 1078: { 
+            case 1078: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1079:  option ::= no states$s optionWhite
             //
-            case 1079: { 
+            case 1079: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1081:  option ::= suffix$s optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1081: { 
+            case 1081: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1486,7 +1641,8 @@
             //
             // Rule 1083:  option ::= sym_file$sf optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1083: { 
+            case 1083: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1497,7 +1653,8 @@
             //
             // Rule 1086:  option ::= tab_file$tf optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1086: { 
+            case 1086: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1508,7 +1665,8 @@
             //
             // Rule 1089:  option ::= template$t optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1089: { 
+            case 1089: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1519,7 +1677,8 @@
             //
             // Rule 1091:  option ::= trailers$t optionWhite =$eq optionWhite ($lp optionWhite filename$fn optionWhite ,$comma1 optionWhite block_begin$bb optionWhite ,$comma2 optionWhite block_end$be optionWhite )$rp optionWhite
             //
-            case 1091: { 
+            case 1091: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1536,21 +1695,24 @@
             //
             // Rule 1093:  option ::= table$t optionWhite
             //
-            case 1093: { 
+            case 1093: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1094:  option ::= no table$t optionWhite
             //
-            case 1094: { 
+            case 1094: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1095:  option ::= table$t optionWhite =$eq optionWhite programming_language_value$val optionWhite
             //
-            case 1095: { 
+            case 1095: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1561,21 +1723,24 @@
             //
             // Rule 1097:  option ::= trace$t optionWhite
             //
-            case 1097: { 
+            case 1097: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1098:  option ::= no trace$t optionWhite
             //
-            case 1098: { 
+            case 1098: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1099:  option ::= trace$t optionWhite =$eq optionWhite trace_value$val optionWhite
             //
-            case 1099: { 
+            case 1099: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1586,21 +1751,24 @@
             //
             // Rule 1104:  option ::= variables$v optionWhite
             //
-            case 1104: { 
+            case 1104: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1105:  option ::= no variables$v optionWhite
             //
-            case 1105: { 
+            case 1105: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1106:  option ::= variables$v optionWhite =$eq optionWhite variables_value$val optionWhite
             //
-            case 1106: { 
+            case 1106: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1611,35 +1779,40 @@
             //
             // Rule 1113:  option ::= verbose$v optionWhite
             //
-            case 1113: { 
+            case 1113: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1114:  option ::= no verbose$v optionWhite
             //
-            case 1114: { 
+            case 1114: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1116:  option ::= visitor$v optionWhite
             //
-            case 1116: { 
+            case 1116: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1117:  option ::= no visitor$v optionWhite
             //
-            case 1117: { 
+            case 1117: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1118:  option ::= visitor$v optionWhite =$eq optionWhite visitor_value$val optionWhite
             //
-            case 1118: { 
+            case 1118: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1650,7 +1823,8 @@
             //
             // Rule 1123:  option ::= visitor_type$vt optionWhite =$eq optionWhite Value$val optionWhite
             //
-            case 1123: { 
+            case 1123: {
+            if constexpr (probe) { *found = true; break; }
             
                   makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);
                   makeToken(getRhsFirstTokenIndex(3), getRhsLastTokenIndex(3), LPGParsersym::TK_EQUAL);
@@ -1661,32 +1835,36 @@
             //
             // Rule 1126:  option ::= warnings$w optionWhite
             //
-            case 1126: { 
+            case 1126: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1127:  option ::= no warnings$w optionWhite
             //
-            case 1127: { 
+            case 1127: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1129:  option ::= xreference$x optionWhite
             //
-            case 1129: { 
+            case 1129: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(1), getRhsLastTokenIndex(1), LPGParsersym::TK_SYMBOL);             break;
             } 
 
             //
             // Rule 1130:  option ::= no xreference$x optionWhite
             //
-            case 1130: { 
+            case 1130: {
+              if constexpr (probe) { *found = true; break; }
               makeToken(getRhsFirstTokenIndex(2), getRhsLastTokenIndex(2), LPGParsersym::TK_SYMBOL);             break;
             } 
 
-    //#line 416 "LexerTemplateF.gi
+    //#line 436 "LexerTemplateF.gi
 
     
             default:
@@ -0,0 +1,7066 @@
+#pragma once
+#include "GeneratedParseTable.h"
+#include "LPGLexerprs.h"
+
+//
+// Direct-coded terminal actions of LPGLexerprs, written by
+// DirectCodeGenerator. Do not edit: regenerate it with the table.
+//
+struct LPGLexerdirect :public GeneratedParseTable<LPGLexerprs>
+{
+    constexpr static bool DIRECT_CODED = true;
+
+    static int directTAction(int state, int sym)
+    {
+        switch (state)
+        {
+            case 1490:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 7: case 8: return 1667;
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 75: case 77: case 78: case 79: case 80: case 81:
+                    case 82: case 84: case 85: case 86: case 87: case 88: case 89: case 91:
+                    case 95: case 96: return 1838;
+                    case 16: return 1583;
+                    case 27: return 4008;
+                    case 74: return 3949;
+                    case 76: return 3767;
+                    case 83: return 3806;
+                    case 90: return 3837;
+                    case 92: return 6252;
+                    case 93: return 6256;
+                    case 94: return 6257;
+                    case 97: return 1135;
+                    case 98: return 1161;
+                    case 99: return 3868;
+                    case 100: return 6856;
+                    default: return 6243;
+                }
+            case 3148:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 78: case 79: case 80: case 81:
+                    case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6824;
+                    case 77: return 6817;
+                    case 90: return 6826;
+                    default: return 6243;
+                }
+            case 3185:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 84: case 85: case 86: case 87: case 88: case 89:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6844;
+                    case 83: return 6837;
+                    case 90: return 6846;
+                    default: return 6243;
+                }
+            case 3237:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 89:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6834;
+                    case 88: return 6827;
+                    case 90: return 6836;
+                    default: return 6243;
+                }
+            case 3344:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 78: case 79: case 80: case 81:
+                    case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6825;
+                    case 77: return 6818;
+                    case 90: return 6849;
+                    default: return 6243;
+                }
+            case 3394:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 84: case 85: case 86: case 87: case 88: case 89:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6845;
+                    case 83: return 6838;
+                    case 90: return 6848;
+                    default: return 6243;
+                }
+            case 4116:
+                return 6845;
+            case 4095:
+                return 6845;
+            case 3420:
+            case 3422:
+                return 6845;
+            case 3434:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8:
+                    case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+                    case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24:
+                    case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64:
+                    case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72:
+                    case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 89:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6835;
+                    case 88: return 6828;
+                    case 90: return 6847;
+                    default: return 6243;
+                }
+            case 4887:
+            case 4893:
+            case 4901:
+            case 4911:
+                return 6835;
+            case 4907:
+                return 6835;
+            case 3920:
+            case 3922:
+                return 6835;
+            case 3572:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 9: case 10:
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+                    case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+                    case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34:
+                    case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+                    case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6814;
+                    default: return 2;
+                }
+            case 1134:
+                switch (sym)
+                {
+                    case 101: return 6242;
+                    default: return 6243;
+                }
+            case 1583:
+                switch (sym)
+                {
+                    case 101: return 15;
+                    default: return 619;
+                }
+            case 4067:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 9: case 10:
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+                    case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+                    case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34:
+                    case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+                    case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 98: case 99:
+                    case 100: return 6810;
+                    case 97: return 6854;
+                    default: return 6243;
+                }
+            case 3822:
+                return 6810;
+            case 4308:
+            case 4327:
+            case 4382:
+                return 6810;
+            case 4539:
+                return 6810;
+            case 4012:
+            case 4014:
+            case 4020:
+                return 6810;
+            case 4500:
+            case 4520:
+                return 6810;
+            case 4191:
+            case 4212:
+                return 6810;
+            case 4444:
+            case 4445:
+            case 4448:
+                return 6810;
+            case 4570:
+            case 4572:
+            case 4574:
+            case 4578:
+                return 6810;
+            case 4605:
+            case 4622:
+            case 4691:
+                return 6810;
+            case 4649:
+            case 4651:
+            case 4657:
+                return 6810;
+            case 4774:
+            case 4787:
+                return 6810;
+            case 4855:
+            case 4859:
+                return 6810;
+            case 3722:
+                return 6810;
+            case 2120:
+            case 2422:
+            case 2820:
+                return 6810;
+            case 4741:
+            case 4744:
+            case 4745:
+            case 4754:
+            case 4766:
+                return 6810;
+            case 4830:
+            case 4835:
+                return 6810;
+            case 4699:
+            case 4702:
+            case 4708:
+                return 6810;
+            case 1915:
+                return 6810;
+            case 1591:
+            case 4287:
+            case 4381:
+            case 5031:
+            case 5053:
+            case 5529:
+            case 5566:
+            case 6149:
+            case 6181:
+            case 6221:
+            case 6225:
+                return 6810;
+            case 4098:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 9: case 10:
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+                    case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+                    case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34:
+                    case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+                    case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 99:
+                    case 100: return 6808;
+                    case 98: return 6853;
+                    default: return 6243;
+                }
+            case 1135:
+            case 5926:
+                return 566;
+            case 1161:
+                return 564;
+            case 6217:
+                return 6808;
+            case 3659:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 9: case 10:
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+                    case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+                    case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34:
+                    case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+                    case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98:
+                    case 99: case 100: return 6814;
+                    default: return 869;
+                }
+            case 5988:
+                return 6814;
+            case 1638:
+                return 580;
+            case 1635:
+                return 600;
+            case 5700:
+                return 6814;
+            case 5187:
+                return 6814;
+            case 6189:
+                return 6814;
+            case 4390:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 9: case 10:
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+                    case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+                    case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34:
+                    case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+                    case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 96: case 97: case 98: case 99:
+                    case 100: return 6812;
+                    case 95: return 6855;
+                    default: return 6243;
+                }
+            case 1491:
+                return 590;
+            case 1269:
+            case 1662:
+            case 1666:
+            case 1713:
+            case 1835:
+            case 1875:
+            case 1876:
+            case 1879:
+            case 1918:
+            case 1919:
+            case 1958:
+            case 1959:
+            case 1962:
+            case 2001:
+            case 2002:
+            case 2005:
+            case 2081:
+            case 2082:
+            case 2085:
+            case 2124:
+            case 2231:
+            case 2232:
+            case 2311:
+            case 2312:
+            case 3179:
+            case 3180:
+            case 3228:
+            case 3268:
+            case 3272:
+            case 3339:
+            case 3376:
+            case 3377:
+            case 3384:
+            case 3385:
+            case 3388:
+            case 3391:
+            case 3426:
+            case 3427:
+            case 3465:
+            case 3466:
+            case 3469:
+            case 3475:
+            case 3476:
+            case 3479:
+            case 3482:
+            case 3519:
+            case 3520:
+            case 3527:
+            case 3561:
+            case 3562:
+            case 3565:
+            case 3566:
+            case 3603:
+            case 3604:
+            case 3607:
+            case 3608:
+            case 3644:
+            case 3645:
+            case 3648:
+            case 3649:
+            case 3652:
+            case 3653:
+            case 3656:
+            case 3690:
+            case 3691:
+            case 3694:
+            case 3695:
+            case 3698:
+            case 4007:
+            case 4066:
+            case 4219:
+            case 4288:
+            case 4289:
+            case 4292:
+            case 4293:
+            case 4296:
+            case 4337:
+            case 4338:
+            case 4343:
+            case 4346:
+            case 4347:
+            case 4351:
+            case 4355:
+            case 4359:
+            case 4363:
+            case 4364:
+            case 4368:
+            case 4371:
+            case 4372:
+            case 4376:
+            case 4384:
+            case 4385:
+            case 4389:
+            case 4451:
+            case 4452:
+            case 4455:
+            case 4459:
+            case 4460:
+            case 4463:
+            case 4464:
+            case 4467:
+            case 4468:
+            case 4471:
+            case 4590:
+            case 4628:
+            case 4728:
+            case 4733:
+            case 4801:
+            case 4807:
+            case 4874:
+            case 4875:
+            case 4879:
+            case 4941:
+            case 4944:
+            case 4945:
+            case 4949:
+            case 4950:
+            case 4953:
+            case 4954:
+            case 4958:
+            case 4961:
+            case 4962:
+            case 4965:
+            case 4966:
+            case 4969:
+            case 4970:
+            case 4973:
+            case 4974:
+            case 4977:
+            case 4978:
+            case 4981:
+            case 4982:
+            case 4985:
+            case 4986:
+            case 4989:
+            case 4990:
+            case 4993:
+            case 4994:
+            case 4997:
+            case 5074:
+            case 5075:
+            case 5078:
+            case 5079:
+            case 5328:
+            case 5329:
+            case 5343:
+            case 5346:
+            case 5352:
+            case 5353:
+            case 5356:
+            case 5357:
+            case 5361:
+            case 5362:
+            case 5366:
+            case 5369:
+            case 5370:
+            case 5373:
+            case 5374:
+            case 5377:
+            case 5378:
+            case 5381:
+            case 5384:
+            case 5385:
+            case 5388:
+            case 5389:
+            case 5392:
+            case 5393:
+            case 5397:
+            case 5400:
+            case 5401:
+            case 5404:
+            case 5405:
+            case 5408:
+            case 5409:
+            case 5412:
+            case 5413:
+            case 5416:
+            case 5420:
+            case 5425:
+            case 5428:
+            case 5429:
+            case 5725:
+            case 5740:
+            case 5743:
+            case 5746:
+            case 5750:
+            case 5908:
+            case 5912:
+            case 5916:
+            case 5919:
+            case 5925:
+            case 5928:
+            case 6029:
+            case 6037:
+            case 6040:
+            case 6045:
+            case 6048:
+            case 6117:
+            case 6118:
+            case 6122:
+            case 6125:
+            case 6126:
+            case 6129:
+            case 6162:
+            case 6165:
+            case 6170:
+            case 6171:
+            case 6201:
+            case 6204:
+            case 6208:
+            case 6211:
+                return 889;
+            case 6025:
+                return 6812;
+            case 3485:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: case 100: return 5378;
+                    default: return 6243;
+                }
+            case 1667:
+                return 538;
+            case 1838:
+                return 619;
+            case 1422:
+                return 5378;
+            case 3530:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: case 100: return 5405;
+                    default: return 6243;
+                }
+            case 1880:
+                return 5;
+            case 1963:
+                return 568;
+            case 3613:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 5: case 6: case 9: case 10:
+                    case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+                    case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+                    case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34:
+                    case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+                    case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+                    case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+                    case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+                    case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+                    case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+                    case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+                    case 91: case 92: case 93: case 94: case 96: case 97: case 98: case 99:
+                    case 100: return 1963;
+                    default: return 6243;
+                }
+            case 2006:
+                return 878;
+            case 2046:
+                return 857;
+            case 1221:
+                switch (sym)
+                {
+                    case 13: case 14: return 4515;
+                    default: return 6243;
+                }
+            case 1675:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 100: return 2006;
+                    case 27: return 4734;
+                    case 96: return 5401;
+                    case 97: return 1135;
+                    case 98: return 1161;
+                    case 99: return 3280;
+                    default: return 6243;
+                }
+            case 1634:
+                switch (sym)
+                {
+                    case 27: return 6813;
+                    default: return 6243;
+                }
+            case 4008:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 28: case 29: case 30:
+                    case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38:
+                    case 39: case 40: case 41: case 42: case 43: case 44: case 45: case 46:
+                    case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54:
+                    case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62:
+                    case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70:
+                    case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78:
+                    case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86:
+                    case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94:
+                    case 96: case 97: case 98: case 99: case 100: return 7087;
+                    case 27: return 6813;
+                    case 95: return 4249;
+                    default: return 830;
+                }
+            case 1175:
+                switch (sym)
+                {
+                    case 5: case 6: return 3333;
+                    default: return 6243;
+                }
+            case 1535:
+            case 1590:
+            case 1719:
+            case 1759:
+            case 1799:
+            case 1839:
+            case 1882:
+            case 1922:
+            case 1965:
+            case 2008:
+            case 2044:
+            case 2088:
+            case 2131:
+            case 2194:
+            case 2238:
+            case 2318:
+            case 2354:
+            case 2390:
+            case 2428:
+            case 2464:
+            case 2500:
+            case 2536:
+            case 2572:
+            case 2608:
+            case 2644:
+            case 2680:
+            case 2716:
+            case 2752:
+            case 2788:
+            case 2824:
+            case 2860:
+            case 2896:
+            case 2932:
+            case 2968:
+            case 3004:
+            case 3040:
+            case 3076:
+            case 3112:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 100: return 2006;
+                    case 27: return 4734;
+                    case 97: return 1135;
+                    case 98: return 1161;
+                    case 99: return 3280;
+                    default: return 6243;
+                }
+            case 2274:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 100: return 2006;
+                    case 27: return 4734;
+                    case 97: return 1135;
+                    case 98: return 1161;
+                    case 99: return 3280;
+                    default: return 6243;
+                }
+            case 1213:
+                return 2006;
+            case 1510:
+            case 1516:
+                return 2006;
+            case 5431:
+                return 2006;
+            case 2080:
+                switch (sym)
+                {
+                    case 27: return 1634;
+                    default: return 6243;
+                }
+            case 1798:
+                switch (sym)
+                {
+                    case 7: case 8: return 7108;
+                    default: return 6243;
+                }
+            case 3704:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 7099;
+                    default: return 5;
+                }
+            case 3620:
+            case 3622:
+                return 7099;
+            case 1617:
+            case 1619:
+            case 1819:
+            case 1894:
+            case 2020:
+            case 2022:
+            case 2220:
+            case 2222:
+            case 2322:
+            case 2420:
+            case 2520:
+            case 2522:
+            case 2620:
+            case 2622:
+            case 2720:
+            case 2722:
+            case 2920:
+            case 2922:
+            case 3020:
+            case 3022:
+            case 3120:
+            case 3122:
+                return 7099;
+            case 3767:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 7090;
+                    default: return 12;
+                }
+            case 1522:
+                switch (sym)
+                {
+                    case 5: case 6: return 4920;
+                    default: return 6243;
+                }
+            case 3806:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 84: case 85: case 86:
+                    case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94:
+                    case 95: case 96: case 97: case 98: case 99: return 7083;
+                    case 83: return 4153;
+                    default: return 828;
+                }
+            case 2125:
+                switch (sym)
+                {
+                    case 5: case 6: return 5064;
+                    default: return 6243;
+                }
+            case 3837:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 78:
+                    case 79: case 80: case 81: case 82: case 84: case 85: case 86: case 87:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 96:
+                    case 97: case 98: case 99: return 7082;
+                    case 77: return 1638;
+                    case 83: return 1635;
+                    case 88: return 1491;
+                    default: return 827;
+                }
+            case 3571:
+                switch (sym)
+                {
+                    case 5: case 6: return 7167;
+                    default: return 6243;
+                }
+            case 3868:
+                switch (sym)
+                {
+                    case 4: case 19: case 27: case 58: case 59: case 60: case 61: case 62:
+                    case 63: case 64: case 65: case 66: case 67: case 73: case 74: case 75:
+                    case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83:
+                    case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 91:
+                    case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: return 7081;
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 20: case 21: case 22: case 23:
+                    case 24: case 25: case 26: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 68: case 69: case 70: case 71: case 72: return 3613;
+                    default: return 826;
+                }
+            case 3657:
+                switch (sym)
+                {
+                    case 5: case 6: return 5100;
+                    default: return 6243;
+                }
+            case 3949:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 21: case 23:
+                    case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7091;
+                    case 20: case 22: return 4185;
+                    default: return 831;
+                }
+            case 4514:
+                switch (sym)
+                {
+                    case 5: case 6: return 5132;
+                    default: return 6243;
+                }
+            case 4881:
+                return 5132;
+            case 4943:
+                return 7091;
+            case 4153:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30:
+                    case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38:
+                    case 39: case 40: case 41: case 42: case 43: case 44: case 45: case 46:
+                    case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54:
+                    case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62:
+                    case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70:
+                    case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78:
+                    case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86:
+                    case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94:
+                    case 95: case 96: case 97: case 98: case 99: return 7084;
+                    case 19: return 4297;
+                    default: return 829;
+                }
+            case 4551:
+                switch (sym)
+                {
+                    case 5: case 6: return 5158;
+                    default: return 6243;
+                }
+            case 4951:
+                return 7084;
+            case 4185:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7092;
+                    case 36: case 37: return 4421;
+                    default: return 832;
+                }
+            case 5116:
+                switch (sym)
+                {
+                    case 5: case 6: return 5251;
+                    default: return 6243;
+                }
+            case 4971:
+                return 7092;
+            case 4249:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 74: case 75: case 76: case 77: case 78:
+                    case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86:
+                    case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94:
+                    case 95: case 96: case 97: case 98: case 99: return 7088;
+                    case 73: return 11095;
+                    default: return 573;
+                }
+            case 5120:
+                switch (sym)
+                {
+                    case 5: case 6: return 5255;
+                    default: return 6243;
+                }
+            case 4297:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 74: case 75: case 76: case 77: case 78:
+                    case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86:
+                    case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94:
+                    case 95: case 96: case 97: case 98: case 99: return 7085;
+                    case 73: return 11195;
+                    default: return 572;
+                }
+            case 5152:
+                switch (sym)
+                {
+                    case 5: case 6: return 5289;
+                    default: return 6243;
+                }
+            case 4421:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 11: case 12: case 13: case 14: case 15:
+                    case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
+                    case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7093;
+                    case 9: case 10: return 4557;
+                    default: return 833;
+                }
+            case 5163:
+                switch (sym)
+                {
+                    case 5: case 6: return 5298;
+                    default: return 6243;
+                }
+            case 4992:
+                return 7093;
+            case 4479:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 7089;
+                    default: return 6243;
+                }
+            case 5177:
+                switch (sym)
+                {
+                    case 5: case 6: return 5310;
+                    default: return 6243;
+                }
+            case 4518:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 7086;
+                    default: return 6243;
+                }
+            case 5178:
+                switch (sym)
+                {
+                    case 5: case 6: return 7343;
+                    default: return 6243;
+                }
+            case 4557:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 15:
+                    case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
+                    case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7094;
+                    case 13: case 14: return 4597;
+                    default: return 834;
+                }
+            case 5184:
+                switch (sym)
+                {
+                    case 5: case 6: return 7339;
+                    default: return 6243;
+                }
+            case 4597:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 21: case 23:
+                    case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7095;
+                    case 20: case 22: return 4632;
+                    default: return 835;
+                }
+            case 5202:
+                switch (sym)
+                {
+                    case 5: case 6: return 5327;
+                    default: return 1131;
+                }
+            case 4632:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7096;
+                    case 28: case 29: return 4767;
+                    default: return 836;
+                }
+            case 5206:
+                switch (sym)
+                {
+                    case 5: case 6: return 5157;
+                    default: return 6243;
+                }
+            case 4767:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 22:
+                    case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+                    case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87:
+                    case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+                    case 96: case 97: case 98: case 99: return 7097;
+                    case 21: case 23: return 4843;
+                    default: return 837;
+                }
+            case 5247:
+                switch (sym)
+                {
+                    case 5: case 6: return 7191;
+                    default: return 6243;
+                }
+            case 4843:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 7098;
+                    default: return 868;
+                }
+            case 5276:
+                switch (sym)
+                {
+                    case 5: case 6: return 5469;
+                    default: return 6243;
+                }
+            case 1322:
+                return 7098;
+            case 1321:
+                return 7098;
+            case 5302:
+                switch (sym)
+                {
+                    case 5: case 6: return 5501;
+                    default: return 6243;
+                }
+            case 5311:
+                switch (sym)
+                {
+                    case 5: case 6: return 5509;
+                    default: return 6243;
+                }
+            case 1920:
+                return 4518;
+            case 3903:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 95: case 96:
+                    case 97: case 98: case 99: return 6863;
+                    default: return 5;
+                }
+            case 5334:
+                switch (sym)
+                {
+                    case 5: case 6: return 5522;
+                    default: return 6243;
+                }
+            case 1314:
+                return 6863;
+            case 2230:
+                switch (sym)
+                {
+                    case 11: case 12: return 5066;
+                    case 15: case 16: return 5068;
+                    default: return 6243;
+                }
+            case 4350:
+                switch (sym)
+                {
+                    case 7: case 8: return 7109;
+                    default: return 6243;
+                }
+            case 4692:
+                switch (sym)
+                {
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 100: return 7124;
+                    case 27: return 4810;
+                    default: return 884;
+                }
+            case 3222:
+                switch (sym)
+                {
+                    case 28: case 29: return 4662;
+                    default: return 6243;
+                }
+            case 4734:
+                switch (sym)
+                {
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 100: return 7122;
+                    default: return 883;
+                }
+            case 3269:
+                switch (sym)
+                {
+                    case 28: case 29: return 4917;
+                    default: return 6243;
+                }
+            case 4810:
+                switch (sym)
+                {
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22:
+                    case 23: case 24: case 25: case 26: case 28: case 29: case 30: case 31:
+                    case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39:
+                    case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47:
+                    case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55:
+                    case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+                    case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71:
+                    case 72: case 73: case 74: case 76: case 77: case 78: case 79: case 80:
+                    case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88:
+                    case 89: case 90: case 91: case 92: case 93: case 94: case 95: case 100: return 7123;
+                    default: return 885;
+                }
+            case 3522:
+                return 7123;
+            case 4930:
+                switch (sym)
+                {
+                    case 28: case 29: return 5194;
+                    default: return 6243;
+                }
+            case 4882:
+                switch (sym)
+                {
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 20: case 21: case 22: case 23:
+                    case 24: case 25: case 26: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 68: case 69: case 70: case 71: case 72: return 6857;
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: return 6858;
+                    default: return 4;
+                }
+            case 1398:
+                switch (sym)
+                {
+                    case 73: return 6254;
+                    default: return 10;
+                }
+            case 1492:
+            case 4968:
+                switch (sym)
+                {
+                    case 73: return 6251;
+                    default: return 7;
+                }
+            case 3280:
+                switch (sym)
+                {
+                    case 5: case 6: case 9: case 10: case 11: case 12: case 13: case 14:
+                    case 15: case 16: case 17: case 18: case 20: case 21: case 22: case 23:
+                    case 24: case 25: case 26: case 28: case 29: case 30: case 31: case 32:
+                    case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40:
+                    case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48:
+                    case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56:
+                    case 57: case 68: case 69: case 70: case 71: case 72: return 3613;
+                    default: return 6243;
+                }
+            case 6093:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 75: return 6126;
+                    default: return 6243;
+                }
+            case 1407:
+                switch (sym)
+                {
+                    case 11: case 12: return 4665;
+                    case 48: case 49: return 2826;
+                    default: return 6243;
+                }
+            case 1572:
+                switch (sym)
+                {
+                    case 74: return 3523;
+                    default: return 859;
+                }
+            case 4223:
+                switch (sym)
+                {
+                    case 51: case 53: return 5786;
+                    default: return 6243;
+                }
+            case 1133:
+                switch (sym)
+                {
+                    case 5: case 6: return 2168;
+                    case 7: case 8: return 7106;
+                    case 9: case 10: return 1571;
+                    case 11: case 12: return 1220;
+                    case 13: case 14: return 1299;
+                    case 15: case 16: return 1291;
+                    case 17: case 18: return 1526;
+                    case 20: case 22: return 1643;
+                    case 21: case 23: return 1431;
+                    case 24: case 25: return 1167;
+                    case 27: return 1634;
+                    case 28: case 29: return 1170;
+                    case 30: case 31: return 1219;
+                    case 32: case 33: return 1354;
+                    case 34: case 35: return 1162;
+                    case 36: case 37: return 1158;
+                    case 40: case 41: return 2169;
+                    case 42: case 43: return 1637;
+                    case 48: case 49: return 1581;
+                    case 50: case 52: return 1175;
+                    case 51: case 53: return 1362;
+                    case 54: case 55: return 2310;
+                    case 56: case 57: return 3219;
+                    default: return 6243;
+                }
+            case 2179:
+                switch (sym)
+                {
+                    case 13: case 14: return 5579;
+                    case 15: case 16: return 5559;
+                    default: return 6243;
+                }
+            case 1270:
+                switch (sym)
+                {
+                    case 5: case 6: return 2168;
+                    case 9: case 10: return 1571;
+                    case 11: case 12: return 1220;
+                    case 13: case 14: return 1299;
+                    case 15: case 16: return 1291;
+                    case 17: case 18: return 1526;
+                    case 20: case 22: return 1643;
+                    case 21: case 23: return 1431;
+                    case 24: case 25: return 1167;
+                    case 28: case 29: return 1170;
+                    case 30: case 31: return 1219;
+                    case 32: case 33: return 1354;
+                    case 34: case 35: return 1162;
+                    case 36: case 37: return 1158;
+                    case 40: case 41: return 2169;
+                    case 42: case 43: return 1637;
+                    case 48: case 49: return 1581;
+                    case 50: case 52: return 1175;
+                    case 51: case 53: return 1362;
+                    case 54: case 55: return 2310;
+                    case 56: case 57: return 3219;
+                    default: return 6243;
+                }
+            case 3219:
+                switch (sym)
+                {
+                    case 38: case 39: return 3430;
+                    default: return 6243;
+                }
+            case 1359:
+                switch (sym)
+                {
+                    case 11: case 12: return 4664;
+                    case 17: case 18: return 1150;
+                    default: return 6243;
+                }
+            case 1406:
+                switch (sym)
+                {
+                    case 5: case 6: return 3216;
+                    case 9: case 10: return 2230;
+                    case 11: case 12: return 1220;
+                    case 15: case 16: return 1575;
+                    case 17: case 18: return 1526;
+                    case 21: case 23: return 1636;
+                    case 24: case 25: return 1167;
+                    case 28: case 29: return 1573;
+                    case 30: case 31: return 2125;
+                    case 32: case 33: return 3273;
+                    case 36: case 37: return 1300;
+                    case 40: case 41: return 2169;
+                    case 42: case 43: return 1637;
+                    case 48: case 49: return 1581;
+                    case 51: case 53: return 1443;
+                    case 54: case 55: return 2310;
+                    case 56: case 57: return 3219;
+                    default: return 6243;
+                }
+            case 2182:
+                switch (sym)
+                {
+                    case 11: case 12: return 1711;
+                    case 24: case 25: return 4673;
+                    default: return 6243;
+                }
+            case 3218:
+                switch (sym)
+                {
+                    case 15: case 16: return 4677;
+                    case 34: case 35: return 4679;
+                    default: return 6243;
+                }
+            case 3934:
+                switch (sym)
+                {
+                    case 36: case 37: return 4215;
+                    default: return 6243;
+                }
+            case 1643:
+                switch (sym)
+                {
+                    case 11: case 12: return 2466;
+                    case 30: case 31: return 7265;
+                    case 34: case 35: return 7262;
+                    case 38: case 39: return 3755;
+                    default: return 6243;
+                }
+            case 2174:
+                switch (sym)
+                {
+                    case 32: case 33: return 2610;
+                    case 40: case 41: return 4663;
+                    default: return 6243;
+                }
+            case 1431:
+                switch (sym)
+                {
+                    case 5: case 6: return 3763;
+                    case 9: case 10: return 3758;
+                    case 13: case 14: return 3269;
+                    case 17: case 18: return 3761;
+                    case 20: case 22: return 3979;
+                    case 24: case 25: return 3798;
+                    case 30: case 31: return 7308;
+                    case 32: case 33: return 7328;
+                    case 36: case 37: return 7312;
+                    case 38: case 39: return 3381;
+                    case 44: case 46: return 7320;
+                    case 45: case 47: return 1438;
+                    case 50: case 52: return 3799;
+                    default: return 6243;
+                }
+            case 5197:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 96: return 5353;
+                    default: return 6243;
+                }
+            case 1272:
+                switch (sym)
+                {
+                    case 34: case 35: return 4514;
+                    default: return 6243;
+                }
+            case 2170:
+                switch (sym)
+                {
+                    case 44: case 46: return 5089;
+                    default: return 6243;
+                }
+            case 1637:
+                switch (sym)
+                {
+                    case 20: case 22: return 3752;
+                    case 30: case 31: return 7221;
+                    default: return 6243;
+                }
+            case 6180:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 75: return 6201;
+                    default: return 6243;
+                }
+            case 1636:
+                switch (sym)
+                {
+                    case 5: case 6: return 3763;
+                    case 9: case 10: return 3758;
+                    case 13: case 14: return 3269;
+                    case 17: case 18: return 3761;
+                    case 20: case 22: return 3979;
+                    case 24: case 25: return 3798;
+                    case 30: case 31: return 7308;
+                    case 36: case 37: return 7312;
+                    case 44: case 46: return 7320;
+                    case 50: case 52: return 3799;
+                    default: return 6243;
+                }
+            case 3736:
+                switch (sym)
+                {
+                    case 24: case 25: return 2170;
+                    default: return 6243;
+                }
+            case 2122:
+            case 2822:
+                return 6243;
+            case 1167:
+                switch (sym)
+                {
+                    case 20: case 22: return 3222;
+                    default: return 6243;
+                }
+            case 1757:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 3698;
+                    case 7: case 8: return 7105;
+                    default: return 6243;
+                }
+            case 1291:
+                switch (sym)
+                {
+                    case 9: case 10: return 2171;
+                    case 15: case 16: return 7158;
+                    case 21: case 23: return 2426;
+                    case 24: case 25: return 3314;
+                    case 30: case 31: return 7147;
+                    case 38: case 39: return 1712;
+                    case 40: case 41: return 7139;
+                    default: return 6243;
+                }
+            case 4329:
+            case 4331:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: return 2046;
+                    default: return 6243;
+                }
+            case 2168:
+                switch (sym)
+                {
+                    case 9: case 10: return 7197;
+                    case 11: case 12: return 3744;
+                    case 21: case 23: return 3739;
+                    case 30: case 31: return 1221;
+                    case 34: case 35: return 7189;
+                    case 36: case 37: return 7204;
+                    case 48: case 49: return 1661;
+                    default: return 6243;
+                }
+            case 3739:
+                switch (sym)
+                {
+                    case 24: case 25: return 4588;
+                    default: return 6243;
+                }
+            case 1354:
+                switch (sym)
+                {
+                    case 13: case 14: return 1359;
+                    case 15: case 16: return 3746;
+                    case 20: case 22: return 3743;
+                    case 36: case 37: return 7209;
+                    default: return 6243;
+                }
+            case 4335:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: return 2046;
+                    default: return 6243;
+                }
+            case 3273:
+                switch (sym)
+                {
+                    case 13: case 14: return 4878;
+                    case 20: case 22: return 3743;
+                    default: return 6243;
+                }
+            case 1299:
+                switch (sym)
+                {
+                    case 9: case 10: return 7229;
+                    case 28: case 29: return 3753;
+                    case 30: case 31: return 7233;
+                    case 32: case 33: return 7226;
+                    case 34: case 35: return 3934;
+                    default: return 6243;
+                }
+            case 3313:
+            case 3320:
+                switch (sym)
+                {
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: return 7101;
+                    default: return 889;
+                }
+            case 3735:
+                switch (sym)
+                {
+                    case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65:
+                    case 66: case 67: return 7101;
+                    default: return 889;
+                }
+            case 1158:
+                switch (sym)
+                {
+                    case 11: case 12: return 1521;
+                    case 13: case 14: return 7275;
+                    case 15: case 16: return 2182;
+                    case 17: case 18: return 7283;
+                    case 21: case 23: return 7269;
+                    case 32: case 33: return 7287;
+                    default: return 6243;
+                }
+            case 3216:
+                switch (sym)
+                {
+                    case 11: case 12: return 3744;
+                    case 30: case 31: return 1221;
+                    case 34: case 35: return 7189;
+                    case 36: case 37: return 7204;
+                    case 48: case 49: return 4931;
+                    default: return 6243;
+                }
+            case 5835:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 5916;
+                    case 75: return 5919;
+                    default: return 6243;
+                }
+            case 4913:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 28: case 29: return 5333;
+                    case 30: case 31: return 5334;
+                    case 36: case 37: return 5336;
+                    default: return 6243;
+                }
+            case 1306:
+                switch (sym)
+                {
+                    case 21: case 23: return 4629;
+                    default: return 6243;
+                }
+            case 1415:
+                switch (sym)
+                {
+                    case 13: case 14: return 5182;
+                    case 24: case 25: return 5178;
+                    default: return 6243;
+                }
+            case 4915:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 9: case 10: return 5344;
+                    case 28: case 29: return 3312;
+                    case 40: case 41: return 5340;
+                    default: return 6243;
+                }
+            case 1219:
+                switch (sym)
+                {
+                    case 5: case 6: return 2174;
+                    case 15: case 16: return 3738;
+                    case 24: case 25: return 3516;
+                    case 30: case 31: return 7173;
+                    default: return 6243;
+                }
+            case 1217:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 24: case 25: return 5351;
+                    case 28: case 29: return 5333;
+                    case 32: case 33: return 5350;
+                    default: return 6243;
+                }
+            case 5100:
+                switch (sym)
+                {
+                    case 28: case 29: return 5244;
+                    default: return 6243;
+                }
+            case 3331:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 9: case 10: return 5417;
+                    case 28: case 29: return 3217;
+                    default: return 6243;
+                }
+            case 1170:
+                switch (sym)
+                {
+                    case 9: case 10: return 2356;
+                    case 15: case 16: return 1272;
+                    case 20: case 22: return 7116;
+                    case 24: case 25: return 7259;
+                    default: return 6243;
+                }
+            case 1571:
+                switch (sym)
+                {
+                    case 5: case 6: return 3319;
+                    case 11: case 12: return 3935;
+                    case 15: case 16: return 3982;
+                    case 32: case 33: return 7331;
+                    default: return 6243;
+                }
+            case 3523:
+                switch (sym)
+                {
+                    case 20: case 22: return 4342;
+                    default: return 6243;
+                }
+            case 1362:
+                switch (sym)
+                {
+                    case 5: case 6: return 3899;
+                    case 9: case 10: return 7368;
+                    case 13: case 14: return 3936;
+                    case 15: case 16: return 3938;
+                    default: return 6243;
+                }
+            case 1423:
+                switch (sym)
+                {
+                    case 9: case 10: return 5221;
+                    case 30: case 31: return 5223;
+                    case 40: case 41: return 5222;
+                    default: return 6243;
+                }
+            case 1521:
+                switch (sym)
+                {
+                    case 5: case 6: return 4671;
+                    case 13: case 14: return 4672;
+                    case 20: case 22: return 4670;
+                    case 21: case 23: return 2970;
+                    default: return 6243;
+                }
+            case 1162:
+                switch (sym)
+                {
+                    case 15: case 16: return 1407;
+                    case 24: case 25: return 7248;
+                    default: return 6243;
+                }
+            case 3327:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 20: case 22: return 5382;
+                    case 34: case 35: return 2179;
+                    default: return 6243;
+                }
+            case 4665:
+                switch (sym)
+                {
+                    case 42: case 43: return 5128;
+                    default: return 6243;
+                }
+            case 3430:
+                switch (sym)
+                {
+                    case 13: case 14: return 4551;
+                    default: return 6243;
+                }
+            case 1581:
+                switch (sym)
+                {
+                    case 11: case 12: return 1522;
+                    default: return 6243;
+                }
+            case 2310:
+                switch (sym)
+                {
+                    case 15: case 16: return 3939;
+                    default: return 6243;
+                }
+            case 3746:
+                switch (sym)
+                {
+                    case 24: case 25: return 4627;
+                    default: return 6243;
+                }
+            case 1712:
+                switch (sym)
+                {
+                    case 9: case 10: return 4472;
+                    default: return 6243;
+                }
+            case 4454:
+                return 7133;
+            case 3753:
+                switch (sym)
+                {
+                    case 24: case 25: return 4367;
+                    default: return 6243;
+                }
+            case 2171:
+                switch (sym)
+                {
+                    case 9: case 10: return 4039;
+                    default: return 907;
+                }
+            case 2426:
+                switch (sym)
+                {
+                    case 9: case 10: return 2538;
+                    default: return 6243;
+                }
+            case 4676:
+                return 7133;
+            case 1526:
+                switch (sym)
+                {
+                    case 13: case 14: return 1306;
+                    case 15: case 16: return 3754;
+                    case 17: case 18: return 7240;
+                    default: return 6243;
+                }
+            case 3516:
+                switch (sym)
+                {
+                    case 17: case 18: return 2682;
+                    default: return 6243;
+                }
+            case 2129:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 2080;
+                    case 4: return 7136;
+                    case 7: case 8: return 7107;
+                    default: return 6243;
+                }
+            case 1220:
+                switch (sym)
+                {
+                    case 5: case 6: return 3218;
+                    case 9: case 10: return 7298;
+                    case 11: case 12: return 7294;
+                    default: return 6243;
+                }
+            case 1575:
+                switch (sym)
+                {
+                    case 9: case 10: return 4924;
+                    case 15: case 16: return 7158;
+                    case 38: case 39: return 1712;
+                    default: return 6243;
+                }
+            case 1573:
+                switch (sym)
+                {
+                    case 9: case 10: return 2356;
+                    case 15: case 16: return 1272;
+                    case 24: case 25: return 7259;
+                    default: return 6243;
+                }
+            case 5246:
+                switch (sym)
+                {
+                    case 54: case 55: return 7217;
+                    default: return 6243;
+                }
+            case 1300:
+                switch (sym)
+                {
+                    case 11: case 12: return 5065;
+                    case 15: case 16: return 5067;
+                    case 21: case 23: return 7269;
+                    default: return 6243;
+                }
+            case 6090:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 6122;
+                    case 75: return 6125;
+                    default: return 6243;
+                }
+            case 1357:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12548;
+                    default: return 1129;
+                }
+            case 1443:
+                switch (sym)
+                {
+                    case 5: case 6: return 3899;
+                    case 13: case 14: return 4798;
+                    case 15: case 16: return 3938;
+                    default: return 6243;
+                }
+            case 5826:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 5908;
+                    default: return 6243;
+                }
+            case 4811:
+                return 7133;
+            case 1661:
+                switch (sym)
+                {
+                    case 9: case 10: return 3657;
+                    case 36: case 37: return 4549;
+                    default: return 6243;
+                }
+            case 3743:
+                switch (sym)
+                {
+                    case 17: case 18: return 3937;
+                    default: return 6243;
+                }
+            case 5084:
+                return 7133;
+            case 5097:
+                return 4549;
+            case 3314:
+                switch (sym)
+                {
+                    case 9: case 10: return 4550;
+                    default: return 6243;
+                }
+            case 4333:
+                switch (sym)
+                {
+                    case 17: case 18: return 5184;
+                    case 26: case 27: return 5185;
+                    default: return 870;
+                }
+            case 5101:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1059;
+                }
+            case 5123:
+                return 7133;
+            case 5140:
+                return 7133;
+            case 5134:
+                return 7133;
+            case 3326:
+                switch (sym)
+                {
+                    case 9: case 10: return 3571;
+                    default: return 6243;
+                }
+            case 5125:
+                switch (sym)
+                {
+                    case 17: case 18: return 870;
+                    case 26: case 27: return 5265;
+                    default: return 995;
+                }
+            case 5151:
+                return 7133;
+            case 5156:
+                return 7133;
+            case 3738:
+                switch (sym)
+                {
+                    case 9: case 10: return 2754;
+                    default: return 6243;
+                }
+            case 3752:
+                switch (sym)
+                {
+                    case 9: case 10: return 4666;
+                    default: return 6243;
+                }
+            case 3754:
+                switch (sym)
+                {
+                    case 17: case 18: return 4593;
+                    default: return 996;
+                }
+            case 3755:
+                switch (sym)
+                {
+                    case 9: case 10: return 2898;
+                    default: return 6243;
+                }
+            case 2356:
+                switch (sym)
+                {
+                    case 26: case 27: return 4667;
+                    default: return 870;
+                }
+            case 4342:
+                switch (sym)
+                {
+                    case 36: case 37: return 5083;
+                    default: return 6243;
+                }
+            case 2466:
+                switch (sym)
+                {
+                    case 26: case 27: return 4668;
+                    default: return 870;
+                }
+            case 1718:
+                return 7133;
+            case 2538:
+                switch (sym)
+                {
+                    case 26: case 27: return 1423;
+                    default: return 870;
+                }
+            case 2610:
+                switch (sym)
+                {
+                    case 26: case 27: return 5094;
+                    default: return 870;
+                }
+            case 2682:
+                switch (sym)
+                {
+                    case 26: case 27: return 5095;
+                    default: return 870;
+                }
+            case 2754:
+                switch (sym)
+                {
+                    case 26: case 27: return 3311;
+                    default: return 870;
+                }
+            case 5268:
+                return 5095;
+            case 5269:
+                return 7133;
+            case 4515:
+                switch (sym)
+                {
+                    case 9: case 10: return 7185;
+                    default: return 6243;
+                }
+            case 3937:
+                switch (sym)
+                {
+                    case 17: case 18: return 5104;
+                    default: return 6243;
+                }
+            case 5323:
+                return 5104;
+            case 4627:
+                switch (sym)
+                {
+                    case 9: case 10: return 5117;
+                    default: return 6243;
+                }
+            case 4367:
+                switch (sym)
+                {
+                    case 17: case 18: return 5124;
+                    default: return 6243;
+                }
+            case 5322:
+                return 5117;
+            case 4629:
+                switch (sym)
+                {
+                    case 9: case 10: return 7243;
+                    default: return 6243;
+                }
+            case 2826:
+                switch (sym)
+                {
+                    case 26: case 27: return 5129;
+                    default: return 870;
+                }
+            case 5349:
+                return 7133;
+            case 5367:
+                return 7133;
+            case 2898:
+                switch (sym)
+                {
+                    case 26: case 27: return 5131;
+                    default: return 870;
+                }
+            case 5368:
+                return 7133;
+            case 4921:
+                switch (sym)
+                {
+                    case 36: case 37: return 5177;
+                    default: return 6243;
+                }
+            case 2970:
+                switch (sym)
+                {
+                    case 26: case 27: return 5133;
+                    default: return 870;
+                }
+            case 3042:
+                switch (sym)
+                {
+                    case 26: case 27: return 5160;
+                    default: return 870;
+                }
+            case 3322:
+                return 7133;
+            case 5386:
+                return 7133;
+            case 3220:
+            case 4725:
+                switch (sym)
+                {
+                    case 9: case 10: return 5163;
+                    default: return 6243;
+                }
+            case 5422:
+                return 7133;
+            case 5475:
+                return 7133;
+            case 4727:
+            case 5440:
+                switch (sym)
+                {
+                    case 9: case 10: return 5165;
+                    default: return 6243;
+                }
+            case 4923:
+                switch (sym)
+                {
+                    case 36: case 37: return 5183;
+                    default: return 6243;
+                }
+            case 5503:
+                return 7133;
+            case 4924:
+                switch (sym)
+                {
+                    case 9: case 10: return 4039;
+                    default: return 6243;
+                }
+            case 5090:
+                switch (sym)
+                {
+                    case 17: case 18: return 5232;
+                    default: return 6243;
+                }
+            case 5476:
+                return 7133;
+            case 4931:
+                switch (sym)
+                {
+                    case 9: case 10: return 3657;
+                    default: return 6243;
+                }
+            case 5083:
+                switch (sym)
+                {
+                    case 9: case 10: return 5219;
+                    default: return 6243;
+                }
+            case 5584:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1123;
+                }
+            case 5089:
+                switch (sym)
+                {
+                    case 9: case 10: return 5226;
+                    default: return 6243;
+                }
+            case 5099:
+                switch (sym)
+                {
+                    case 36: case 37: return 5247;
+                    default: return 6243;
+                }
+            case 5102:
+                switch (sym)
+                {
+                    case 26: case 27: return 5252;
+                    default: return 870;
+                }
+            case 5114:
+                switch (sym)
+                {
+                    case 9: case 10: return 7214;
+                    default: return 6243;
+                }
+            case 5664:
+                return 7133;
+            case 5665:
+                return 7133;
+            case 5158:
+                switch (sym)
+                {
+                    case 9: case 10: return 7290;
+                    default: return 6243;
+                }
+            case 5103:
+                switch (sym)
+                {
+                    case 26: case 27: return 5254;
+                    default: return 870;
+                }
+            case 5159:
+                switch (sym)
+                {
+                    case 36: case 37: return 5287;
+                    default: return 6243;
+                }
+            case 5137:
+                switch (sym)
+                {
+                    case 26: case 27: return 5294;
+                    default: return 870;
+                }
+            case 5736:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1033;
+                }
+            case 5754:
+                return 5294;
+            case 5167:
+                switch (sym)
+                {
+                    case 9: case 10: return 5303;
+                    default: return 6243;
+                }
+            case 5168:
+                switch (sym)
+                {
+                    case 17: case 18: return 5302;
+                    default: return 6243;
+                }
+            case 5799:
+                return 7133;
+            case 5800:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1008;
+                }
+            case 5817:
+                return 7133;
+            case 5182:
+                switch (sym)
+                {
+                    case 17: case 18: return 5311;
+                    default: return 6243;
+                }
+            case 5183:
+                switch (sym)
+                {
+                    case 17: case 18: return 5309;
+                    default: return 6243;
+                }
+            case 5188:
+                switch (sym)
+                {
+                    case 9: case 10: return 5313;
+                    default: return 6243;
+                }
+            case 5208:
+                switch (sym)
+                {
+                    case 17: case 18: return 5184;
+                    default: return 6243;
+                }
+            case 5863:
+                return 5313;
+            case 5245:
+                switch (sym)
+                {
+                    case 9: case 10: return 5445;
+                    default: return 6243;
+                }
+            case 5222:
+                switch (sym)
+                {
+                    case 17: case 18: return 5437;
+                    default: return 6243;
+                }
+            case 5890:
+                return 5445;
+            case 5899:
+                return 7133;
+            case 5252:
+                switch (sym)
+                {
+                    case 36: case 37: return 5458;
+                    default: return 6243;
+                }
+            case 5235:
+                switch (sym)
+                {
+                    case 26: case 27: return 5457;
+                    default: return 870;
+                }
+            case 5259:
+                switch (sym)
+                {
+                    case 9: case 10: return 5467;
+                    default: return 6243;
+                }
+            case 5953:
+                return 5457;
+            case 5952:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 931;
+                }
+            case 5980:
+                return 7133;
+            case 5289:
+                switch (sym)
+                {
+                    case 9: case 10: return 5487;
+                    default: return 6243;
+                }
+            case 5265:
+                switch (sym)
+                {
+                    case 17: case 18: return 5471;
+                    default: return 6243;
+                }
+            case 5292:
+                switch (sym)
+                {
+                    case 9: case 10: return 5489;
+                    default: return 6243;
+                }
+            case 5287:
+                switch (sym)
+                {
+                    case 26: case 27: return 5493;
+                    default: return 870;
+                }
+            case 5303:
+            case 6024:
+                switch (sym)
+                {
+                    case 26: case 27: return 5506;
+                    default: return 870;
+                }
+            case 3982:
+                switch (sym)
+                {
+                    case 40: case 41: return 4333;
+                    default: return 6243;
+                }
+            case 5697:
+                switch (sym)
+                {
+                    case 9: case 10: return 870;
+                    case 26: case 27: return 5806;
+                    default: return 1119;
+                }
+            case 2169:
+                switch (sym)
+                {
+                    case 15: case 16: return 3736;
+                    case 45: case 47: return 3326;
+                    default: return 6243;
+                }
+            case 1317:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 7: case 8: return 6782;
+                    default: return 1;
+                }
+            case 3149:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4590;
+                    default: return 6243;
+                }
+            case 3183:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 11814;
+                    case 19: return 4628;
+                    default: return 1116;
+                }
+            case 3800:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12375;
+                    case 19: return 4728;
+                    default: return 1104;
+                }
+            case 3802:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12388;
+                    case 19: return 4733;
+                    default: return 1097;
+                }
+            case 1150:
+                switch (sym)
+                {
+                    case 5: case 6: return 5102;
+                    case 9: case 10: return 5116;
+                    default: return 6243;
+                }
+            case 1438:
+                switch (sym)
+                {
+                    case 34: case 35: return 3042;
+                    default: return 6243;
+                }
+            case 2320:
+                return 5102;
+            case 3381:
+                switch (sym)
+                {
+                    case 32: case 33: return 4797;
+                    default: return 6243;
+                }
+            case 6153:
+                return 5116;
+            case 3838:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12397;
+                    case 19: return 4801;
+                    default: return 1093;
+                }
+            case 6167:
+                return 12397;
+            case 3869:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4807;
+                    default: return 6243;
+                }
+            case 6173:
+                return 7133;
+            case 3900:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4874;
+                    default: return 6243;
+                }
+            case 3940:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4875;
+                    default: return 6243;
+                }
+            case 3979:
+                switch (sym)
+                {
+                    case 32: case 33: return 4727;
+                    default: return 6243;
+                }
+            case 3744:
+                switch (sym)
+                {
+                    case 11: case 12: return 4587;
+                    default: return 6243;
+                }
+            case 6197:
+                return 6243;
+            case 4215:
+                switch (sym)
+                {
+                    case 20: case 22: return 5122;
+                    case 26: case 27: return 5121;
+                    default: return 870;
+                }
+            case 3947:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4879;
+                    default: return 6243;
+                }
+            case 3983:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4941;
+                    default: return 6243;
+                }
+            case 4046:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4944;
+                    default: return 6243;
+                }
+            case 4048:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4945;
+                    default: return 6243;
+                }
+            case 6213:
+                return 7133;
+            case 4662:
+                switch (sym)
+                {
+                    case 32: case 33: return 5090;
+                    default: return 6243;
+                }
+            case 3319:
+                switch (sym)
+                {
+                    case 34: case 35: return 4923;
+                    default: return 6243;
+                }
+            case 3798:
+                switch (sym)
+                {
+                    case 20: case 22: return 4921;
+                    default: return 6243;
+                }
+            case 4998:
+            case 6234:
+            case 6235:
+            case 6241:
+                return 6243;
+            case 4054:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4949;
+                    default: return 6243;
+                }
+            case 4056:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4950;
+                    default: return 6243;
+                }
+            case 4058:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4953;
+                    default: return 6243;
+                }
+            case 4062:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4954;
+                    default: return 6243;
+                }
+            case 3761:
+                switch (sym)
+                {
+                    case 11: case 12: return 7315;
+                    default: return 6243;
+                }
+            case 3470:
+                switch (sym)
+                {
+                    case 30: case 31: return 5120;
+                    default: return 6243;
+                }
+            case 4472:
+                switch (sym)
+                {
+                    case 20: case 22: return 5069;
+                    default: return 6243;
+                }
+            case 4064:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4958;
+                    default: return 6243;
+                }
+            case 4129:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12410;
+                    case 19: return 4961;
+                    default: return 1006;
+                }
+            case 4131:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4962;
+                    default: return 6243;
+                }
+            case 4133:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4965;
+                    default: return 6243;
+                }
+            case 3799:
+                switch (sym)
+                {
+                    case 13: case 14: return 4918;
+                    default: return 6243;
+                }
+            case 4668:
+                switch (sym)
+                {
+                    case 34: case 35: return 5136;
+                    default: return 6243;
+                }
+            case 4667:
+                switch (sym)
+                {
+                    case 24: case 25: return 5130;
+                    default: return 6243;
+                }
+            case 4137:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12419;
+                    case 19: return 4966;
+                    default: return 991;
+                }
+            case 4139:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4969;
+                    default: return 6243;
+                }
+            case 4141:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4970;
+                    default: return 6243;
+                }
+            case 4143:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4973;
+                    default: return 6243;
+                }
+            case 4671:
+                switch (sym)
+                {
+                    case 32: case 33: return 5148;
+                    default: return 6243;
+                }
+            case 3763:
+                switch (sym)
+                {
+                    case 11: case 12: return 4682;
+                    default: return 6243;
+                }
+            case 4663:
+                switch (sym)
+                {
+                    case 38: case 39: return 5092;
+                    default: return 6243;
+                }
+            case 4549:
+                switch (sym)
+                {
+                    case 20: case 22: return 5096;
+                    default: return 6243;
+                }
+            case 4145:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4974;
+                    default: return 6243;
+                }
+            case 4186:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4977;
+                    default: return 6243;
+                }
+            case 4217:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4978;
+                    default: return 6243;
+                }
+            case 4225:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4981;
+                    default: return 6243;
+                }
+            case 4797:
+                switch (sym)
+                {
+                    case 32: case 33: return 5164;
+                    default: return 6243;
+                }
+            case 4677:
+                switch (sym)
+                {
+                    case 30: case 31: return 5137;
+                    default: return 6243;
+                }
+            case 3936:
+                switch (sym)
+                {
+                    case 21: case 23: return 4799;
+                    default: return 6243;
+                }
+            case 4227:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12432;
+                    case 19: return 4982;
+                    default: return 957;
+                }
+            case 4229:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4985;
+                    default: return 6243;
+                }
+            case 4231:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4986;
+                    default: return 6243;
+                }
+            case 4239:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4989;
+                    default: return 6243;
+                }
+            case 3899:
+                switch (sym)
+                {
+                    case 11: case 12: return 4922;
+                    default: return 6243;
+                }
+            case 4587:
+                switch (sym)
+                {
+                    case 20: case 22: return 5105;
+                    default: return 6243;
+                }
+            case 4241:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4990;
+                    default: return 6243;
+                }
+            case 4243:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4993;
+                    default: return 6243;
+                }
+            case 4245:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 4994;
+                    default: return 6243;
+                }
+            case 4286:
+                switch (sym)
+                {
+                    case 1: return 12454;
+                    case 2: return 12441;
+                    case 3: return 12463;
+                    case 19: return 4997;
+                    default: return 911;
+                }
+            case 5344:
+                switch (sym)
+                {
+                    case 5: case 6: return 5539;
+                    default: return 6243;
+                }
+            case 3938:
+                switch (sym)
+                {
+                    case 11: case 12: return 4800;
+                    default: return 6243;
+                }
+            case 4673:
+                switch (sym)
+                {
+                    case 44: case 46: return 5149;
+                    default: return 6243;
+                }
+            case 5165:
+                switch (sym)
+                {
+                    case 26: case 27: return 5300;
+                    case 44: case 46: return 870;
+                    default: return 1076;
+                }
+            case 4422:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 5074;
+                    default: return 6243;
+                }
+            case 4474:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 5075;
+                    default: return 6243;
+                }
+            case 4476:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 5078;
+                    default: return 6243;
+                }
+            case 4510:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 19: return 5079;
+                    default: return 6243;
+                }
+            case 1711:
+                switch (sym)
+                {
+                    case 5: case 6: return 5157;
+                    case 21: case 23: return 5152;
+                    default: return 6243;
+                }
+            case 3311:
+                switch (sym)
+                {
+                    case 30: case 31: return 5242;
+                    case 32: case 33: return 5237;
+                    default: return 6243;
+                }
+            case 3939:
+                switch (sym)
+                {
+                    case 11: case 12: return 4930;
+                    default: return 6243;
+                }
+            case 4664:
+                switch (sym)
+                {
+                    case 21: case 23: return 5114;
+                    default: return 6243;
+                }
+            case 5124:
+                switch (sym)
+                {
+                    case 38: case 39: return 5261;
+                    default: return 6243;
+                }
+            case 5203:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 96: return 5389;
+                    default: return 6243;
+                }
+            case 3217:
+                switch (sym)
+                {
+                    case 5: case 6: return 5619;
+                    case 20: case 22: return 5526;
+                    default: return 6243;
+                }
+            case 5212:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 96: return 5428;
+                    default: return 6243;
+                }
+            case 5214:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 96: return 5429;
+                    default: return 6243;
+                }
+            case 3312:
+                switch (sym)
+                {
+                    case 9: case 10: return 7355;
+                    case 20: case 22: return 5542;
+                    default: return 6243;
+                }
+            case 3389:
+                switch (sym)
+                {
+                    case 5: case 6: return 7117;
+                    case 26: case 27: return 5821;
+                    default: return 870;
+                }
+            case 5833:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 5912;
+                    default: return 6243;
+                }
+            case 1755:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12557;
+                    default: return 1126;
+                }
+            case 5841:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 5925;
+                    default: return 6243;
+                }
+            case 5848:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 5928;
+                    default: return 6243;
+                }
+            case 5948:
+                switch (sym)
+                {
+                    case 13: case 14: return 870;
+                    case 26: case 27: return 6009;
+                    default: return 1031;
+                }
+            case 6080:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 6117;
+                    default: return 6243;
+                }
+            case 6086:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 6118;
+                    default: return 6243;
+                }
+            case 3317:
+                switch (sym)
+                {
+                    case 13: case 14: return 6194;
+                    case 45: case 47: return 7231;
+                    default: return 6243;
+                }
+            case 6096:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 4: return 6129;
+                    default: return 6243;
+                }
+            case 6183:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 75: return 6204;
+                    default: return 6243;
+                }
+            case 6185:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 75: return 6208;
+                    default: return 6243;
+                }
+            case 4666:
+                switch (sym)
+                {
+                    case 20: case 22: return 5103;
+                    default: return 6243;
+                }
+            case 6187:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    case 75: return 6211;
+                    default: return 6243;
+                }
+            case 3705:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12566;
+                    default: return 1113;
+                }
+            case 3987:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12575;
+                    default: return 1078;
+                }
+            case 3989:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12584;
+                    default: return 1073;
+                }
+            case 5221:
+                switch (sym)
+                {
+                    case 45: case 47: return 5434;
+                    default: return 6243;
+                }
+            case 3991:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12593;
+                    default: return 1070;
+                }
+            case 3994:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12602;
+                    default: return 1066;
+                }
+            case 3996:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12611;
+                    default: return 1062;
+                }
+            case 3998:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12620;
+                    default: return 1059;
+                }
+            case 4001:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12629;
+                    default: return 1056;
+                }
+            case 4003:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12638;
+                    default: return 1052;
+                }
+            case 4005:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12647;
+                    default: return 1048;
+                }
+            case 4041:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12656;
+                    default: return 1045;
+                }
+            case 4052:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12665;
+                    default: return 1035;
+                }
+            case 4060:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12674;
+                    default: return 1023;
+                }
+            case 4099:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12683;
+                    default: return 1013;
+                }
+            case 4135:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12692;
+                    default: return 998;
+                }
+            case 4147:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12701;
+                    default: return 975;
+                }
+            case 4149:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12710;
+                    default: return 972;
+                }
+            case 4151:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12719;
+                    default: return 969;
+                }
+            case 4233:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12728;
+                    default: return 943;
+                }
+            case 4235:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12737;
+                    default: return 940;
+                }
+            case 4237:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12746;
+                    default: return 937;
+                }
+            case 4280:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12755;
+                    default: return 925;
+                }
+            case 4282:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12764;
+                    default: return 922;
+                }
+            case 4284:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12773;
+                    default: return 919;
+                }
+            case 4380:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12782;
+                    default: return 908;
+                }
+            case 4512:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 7133;
+                    default: return 867;
+                }
+            case 4552:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12791;
+                    default: return 1130;
+                }
+            case 4768:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12800;
+                    default: return 1127;
+                }
+            case 4844:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12809;
+                    default: return 1117;
+                }
+            case 5000:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12818;
+                    default: return 1114;
+                }
+            case 5002:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12827;
+                    default: return 1105;
+                }
+            case 5004:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12836;
+                    default: return 1098;
+                }
+            case 5006:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12845;
+                    default: return 1094;
+                }
+            case 5008:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12854;
+                    default: return 1079;
+                }
+            case 5010:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12863;
+                    default: return 1074;
+                }
+            case 5012:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12872;
+                    default: return 1071;
+                }
+            case 5014:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12881;
+                    default: return 1067;
+                }
+            case 5016:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12890;
+                    default: return 1063;
+                }
+            case 5018:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12899;
+                    default: return 1060;
+                }
+            case 5020:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12908;
+                    default: return 1057;
+                }
+            case 5022:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12917;
+                    default: return 1053;
+                }
+            case 5024:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12926;
+                    default: return 1049;
+                }
+            case 5026:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12935;
+                    default: return 1046;
+                }
+            case 5028:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12944;
+                    default: return 1036;
+                }
+            case 5030:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12953;
+                    default: return 1024;
+                }
+            case 5032:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12962;
+                    default: return 1014;
+                }
+            case 5034:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12971;
+                    default: return 1007;
+                }
+            case 5036:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12980;
+                    default: return 999;
+                }
+            case 5038:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12989;
+                    default: return 992;
+                }
+            case 5040:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 12998;
+                    default: return 976;
+                }
+            case 5042:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13007;
+                    default: return 973;
+                }
+            case 5044:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13016;
+                    default: return 970;
+                }
+            case 5046:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13025;
+                    default: return 958;
+                }
+            case 5048:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13034;
+                    default: return 944;
+                }
+            case 5050:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13043;
+                    default: return 941;
+                }
+            case 5052:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13052;
+                    default: return 938;
+                }
+            case 5054:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13061;
+                    default: return 926;
+                }
+            case 5056:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13070;
+                    default: return 923;
+                }
+            case 5058:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13079;
+                    default: return 920;
+                }
+            case 5060:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13088;
+                    default: return 912;
+                }
+            case 5062:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13097;
+                    default: return 909;
+                }
+            case 5528:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13106;
+                    default: return 1123;
+                }
+            case 5530:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13115;
+                    default: return 1118;
+                }
+            case 5533:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13124;
+                    default: return 1106;
+                }
+            case 5546:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13133;
+                    default: return 1099;
+                }
+            case 5549:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13142;
+                    default: return 1095;
+                }
+            case 5552:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13151;
+                    default: return 1089;
+                }
+            case 5555:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13160;
+                    default: return 1086;
+                }
+            case 5557:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13169;
+                    default: return 1083;
+                }
+            case 5561:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13178;
+                    default: return 1081;
+                }
+            case 5563:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13187;
+                    default: return 1042;
+                }
+            case 5565:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13196;
+                    default: return 1038;
+                }
+            case 5567:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13205;
+                    default: return 1033;
+                }
+            case 5569:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13214;
+                    default: return 1029;
+                }
+            case 5571:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13223;
+                    default: return 1027;
+                }
+            case 5573:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13232;
+                    default: return 1020;
+                }
+            case 5575:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13241;
+                    default: return 1017;
+                }
+            case 5577:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13250;
+                    default: return 1008;
+                }
+            case 5582:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13259;
+                    default: return 1003;
+                }
+            case 5585:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13268;
+                    default: return 1001;
+                }
+            case 5587:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13277;
+                    default: return 993;
+                }
+            case 5589:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13286;
+                    default: return 987;
+                }
+            case 5592:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13295;
+                    default: return 984;
+                }
+            case 5594:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13304;
+                    default: return 981;
+                }
+            case 5596:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13313;
+                    default: return 967;
+                }
+            case 5598:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13322;
+                    default: return 964;
+                }
+            case 5600:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13331;
+                    default: return 962;
+                }
+            case 5602:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13340;
+                    default: return 959;
+                }
+            case 5604:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13349;
+                    default: return 949;
+                }
+            case 5606:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13358;
+                    default: return 947;
+                }
+            case 5608:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13367;
+                    default: return 935;
+                }
+            case 5610:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13376;
+                    default: return 933;
+                }
+            case 5612:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13385;
+                    default: return 931;
+                }
+            case 5614:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13394;
+                    default: return 928;
+                }
+            case 5616:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13403;
+                    default: return 913;
+                }
+            case 5622:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13412;
+                    default: return 905;
+                }
+            case 5624:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13421;
+                    default: return 902;
+                }
+            case 5985:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13430;
+                    default: return 950;
+                }
+            case 6148:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13439;
+                    default: return 951;
+                }
+            case 6151:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13448;
+                    default: return 897;
+                }
+            case 6214:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13457;
+                    default: return 1091;
+                }
+            case 6220:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13466;
+                    default: return 979;
+                }
+            case 6224:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: return 13475;
+                    default: return 952;
+                }
+            case 6226:
+                switch (sym)
+                {
+                    case 1: return 13493;
+                    case 2: return 13484;
+                    case 3: return 13502;
+                    default: return 894;
+                }
+            case 3333:
+                switch (sym)
+                {
+                    case 15: case 16: return 3470;
+                    default: return 6243;
+                }
+            case 4039:
+                switch (sym)
+                {
+                    case 11: case 12: return 5085;
+                    default: return 6243;
+                }
+            case 3758:
+                switch (sym)
+                {
+                    case 15: case 16: return 4725;
+                    default: return 6243;
+                }
+            case 4670:
+                switch (sym)
+                {
+                    case 42: case 43: return 5145;
+                    default: return 6243;
+                }
+            case 3935:
+                switch (sym)
+                {
+                    case 15: case 16: return 1415;
+                    default: return 6243;
+                }
+            case 4917:
+                switch (sym)
+                {
+                    case 42: case 43: return 5168;
+                    default: return 6243;
+                }
+            case 4672:
+                switch (sym)
+                {
+                    case 20: case 22: return 5146;
+                    default: return 6243;
+                }
+            case 4918:
+                switch (sym)
+                {
+                    case 32: case 33: return 5167;
+                    default: return 6243;
+                }
+            case 4550:
+                switch (sym)
+                {
+                    case 13: case 14: return 5088;
+                    default: return 6243;
+                }
+            case 4588:
+                switch (sym)
+                {
+                    case 15: case 16: return 5099;
+                    default: return 6243;
+                }
+            case 4920:
+                switch (sym)
+                {
+                    case 32: case 33: return 5202;
+                    default: return 6243;
+                }
+            case 4679:
+                switch (sym)
+                {
+                    case 15: case 16: return 5159;
+                    default: return 6243;
+                }
+            case 4593:
+                switch (sym)
+                {
+                    case 11: case 12: return 5125;
+                    default: return 6243;
+                }
+            case 4922:
+                switch (sym)
+                {
+                    case 40: case 41: return 5186;
+                    default: return 6243;
+                }
+            case 5064:
+                switch (sym)
+                {
+                    case 40: case 41: return 4663;
+                    default: return 6243;
+                }
+            case 4682:
+                switch (sym)
+                {
+                    case 13: case 14: return 5172;
+                    default: return 6243;
+                }
+            case 5068:
+                switch (sym)
+                {
+                    case 40: case 41: return 5208;
+                    default: return 6243;
+                }
+            case 4799:
+                switch (sym)
+                {
+                    case 13: case 14: return 5188;
+                    default: return 6243;
+                }
+            case 4800:
+                switch (sym)
+                {
+                    case 13: case 14: return 5189;
+                    default: return 6243;
+                }
+            case 5065:
+                switch (sym)
+                {
+                    case 13: case 14: return 4672;
+                    default: return 6243;
+                }
+            case 4878:
+                switch (sym)
+                {
+                    case 11: case 12: return 4664;
+                    default: return 6243;
+                }
+            case 5069:
+                switch (sym)
+                {
+                    case 34: case 35: return 5220;
+                    default: return 6243;
+                }
+            case 4798:
+                switch (sym)
+                {
+                    case 21: case 23: return 5211;
+                    default: return 6243;
+                }
+            case 5066:
+                switch (sym)
+                {
+                    case 15: case 16: return 5207;
+                    default: return 6243;
+                }
+            case 5092:
+                switch (sym)
+                {
+                    case 42: case 43: return 7182;
+                    default: return 6243;
+                }
+            case 5067:
+                switch (sym)
+                {
+                    case 11: case 12: return 5206;
+                    default: return 6243;
+                }
+            case 5094:
+                switch (sym)
+                {
+                    case 32: case 33: return 5233;
+                    default: return 6243;
+                }
+            case 5088:
+                switch (sym)
+                {
+                    case 20: case 22: return 5224;
+                    default: return 6243;
+                }
+            case 5095:
+                switch (sym)
+                {
+                    case 32: case 33: return 5234;
+                    default: return 6243;
+                }
+            case 5085:
+                switch (sym)
+                {
+                    case 13: case 14: return 5210;
+                    default: return 6243;
+                }
+            case 5130:
+                switch (sym)
+                {
+                    case 50: case 52: return 5276;
+                    default: return 6243;
+                }
+            case 5096:
+                switch (sym)
+                {
+                    case 11: case 12: return 5245;
+                    default: return 6243;
+                }
+            case 5104:
+                switch (sym)
+                {
+                    case 20: case 22: return 5246;
+                    default: return 6243;
+                }
+            case 5105:
+                switch (sym)
+                {
+                    case 11: case 12: return 5235;
+                    default: return 6243;
+                }
+            case 5117:
+                switch (sym)
+                {
+                    case 20: case 22: return 5253;
+                    default: return 6243;
+                }
+            case 5121:
+                switch (sym)
+                {
+                    case 32: case 33: return 5264;
+                    default: return 6243;
+                }
+            case 5129:
+                switch (sym)
+                {
+                    case 24: case 25: return 5262;
+                    default: return 6243;
+                }
+            case 5128:
+                switch (sym)
+                {
+                    case 13: case 14: return 5266;
+                    default: return 6243;
+                }
+            case 5122:
+                switch (sym)
+                {
+                    case 11: case 12: return 5259;
+                    default: return 6243;
+                }
+            case 5131:
+                switch (sym)
+                {
+                    case 30: case 31: return 5275;
+                    default: return 6243;
+                }
+            case 5133:
+                switch (sym)
+                {
+                    case 32: case 33: return 5280;
+                    default: return 6243;
+                }
+            case 5132:
+                switch (sym)
+                {
+                    case 21: case 23: return 7252;
+                    default: return 6243;
+                }
+            case 5160:
+                switch (sym)
+                {
+                    case 32: case 33: return 5295;
+                    default: return 6243;
+                }
+            case 5157:
+                switch (sym)
+                {
+                    case 28: case 29: return 5292;
+                    default: return 6243;
+                }
+            case 5136:
+                switch (sym)
+                {
+                    case 15: case 16: return 5277;
+                    default: return 6243;
+                }
+            case 5185:
+                switch (sym)
+                {
+                    case 32: case 33: return 5318;
+                    default: return 6243;
+                }
+            case 5145:
+                switch (sym)
+                {
+                    case 11: case 12: return 5283;
+                    default: return 6243;
+                }
+            case 5146:
+                switch (sym)
+                {
+                    case 11: case 12: return 5285;
+                    default: return 6243;
+                }
+            case 5148:
+                switch (sym)
+                {
+                    case 13: case 14: return 5284;
+                    default: return 6243;
+                }
+            case 5149:
+                switch (sym)
+                {
+                    case 15: case 16: return 5288;
+                    default: return 6243;
+                }
+            case 5164:
+                switch (sym)
+                {
+                    case 13: case 14: return 5297;
+                    default: return 6243;
+                }
+            case 5172:
+                switch (sym)
+                {
+                    case 15: case 16: return 5304;
+                    default: return 6243;
+                }
+            case 5186:
+                switch (sym)
+                {
+                    case 20: case 22: return 5315;
+                    default: return 6243;
+                }
+            case 5189:
+                switch (sym)
+                {
+                    case 15: case 16: return 5317;
+                    default: return 6243;
+                }
+            case 5207:
+                switch (sym)
+                {
+                    case 24: case 25: return 5178;
+                    default: return 6243;
+                }
+            case 5210:
+                switch (sym)
+                {
+                    case 40: case 41: return 5421;
+                    default: return 6243;
+                }
+            case 5194:
+                switch (sym)
+                {
+                    case 13: case 14: return 5326;
+                    default: return 6243;
+                }
+            case 5220:
+                switch (sym)
+                {
+                    case 15: case 16: return 5432;
+                    default: return 6243;
+                }
+            case 5224:
+                switch (sym)
+                {
+                    case 28: case 29: return 5439;
+                    default: return 6243;
+                }
+            case 5211:
+                switch (sym)
+                {
+                    case 13: case 14: return 5419;
+                    default: return 6243;
+                }
+            case 5219:
+                switch (sym)
+                {
+                    case 13: case 14: return 5424;
+                    default: return 6243;
+                }
+            case 5223:
+                switch (sym)
+                {
+                    case 13: case 14: return 5435;
+                    default: return 6243;
+                }
+            case 5226:
+                switch (sym)
+                {
+                    case 11: case 12: return 5441;
+                    default: return 6243;
+                }
+            case 5244:
+                switch (sym)
+                {
+                    case 30: case 31: return 5456;
+                    default: return 6243;
+                }
+            case 5232:
+                switch (sym)
+                {
+                    case 13: case 14: return 5442;
+                    default: return 6243;
+                }
+            case 5254:
+                switch (sym)
+                {
+                    case 30: case 31: return 5461;
+                    default: return 6243;
+                }
+            case 5233:
+                switch (sym)
+                {
+                    case 13: case 14: return 5443;
+                    default: return 6243;
+                }
+            case 5261:
+                switch (sym)
+                {
+                    case 30: case 31: return 5462;
+                    default: return 6243;
+                }
+            case 5234:
+                switch (sym)
+                {
+                    case 13: case 14: return 5444;
+                    default: return 6243;
+                }
+            case 5237:
+                switch (sym)
+                {
+                    case 13: case 14: return 5447;
+                    default: return 6243;
+                }
+            case 5242:
+                switch (sym)
+                {
+                    case 13: case 14: return 5449;
+                    default: return 6243;
+                }
+            case 5284:
+                switch (sym)
+                {
+                    case 48: case 49: return 7277;
+                    default: return 6243;
+                }
+            case 5288:
+                switch (sym)
+                {
+                    case 42: case 43: return 5488;
+                    default: return 6243;
+                }
+            case 5266:
+                switch (sym)
+                {
+                    case 28: case 29: return 7245;
+                    default: return 6243;
+                }
+            case 5251:
+                switch (sym)
+                {
+                    case 11: case 12: return 7211;
+                    default: return 6243;
+                }
+            case 5253:
+                switch (sym)
+                {
+                    case 11: case 12: return 5459;
+                    default: return 6243;
+                }
+            case 5255:
+                switch (sym)
+                {
+                    case 11: case 12: return 5460;
+                    default: return 6243;
+                }
+            case 5264:
+                switch (sym)
+                {
+                    case 13: case 14: return 5468;
+                    default: return 6243;
+                }
+            case 5262:
+                switch (sym)
+                {
+                    case 15: case 16: return 5473;
+                    default: return 6243;
+                }
+            case 5277:
+                switch (sym)
+                {
+                    case 11: case 12: return 5478;
+                    default: return 6243;
+                }
+            case 5275:
+                switch (sym)
+                {
+                    case 13: case 14: return 5477;
+                    default: return 6243;
+                }
+            case 5280:
+                switch (sym)
+                {
+                    case 13: case 14: return 5484;
+                    default: return 6243;
+                }
+            case 5283:
+                switch (sym)
+                {
+                    case 15: case 16: return 5485;
+                    default: return 6243;
+                }
+            case 5285:
+                switch (sym)
+                {
+                    case 13: case 14: return 5486;
+                    default: return 6243;
+                }
+            case 5294:
+                switch (sym)
+                {
+                    case 11: case 12: return 5495;
+                    default: return 6243;
+                }
+            case 5295:
+                switch (sym)
+                {
+                    case 13: case 14: return 5496;
+                    default: return 6243;
+                }
+            case 5297:
+                switch (sym)
+                {
+                    case 48: case 49: return 7325;
+                    default: return 6243;
+                }
+            case 5298:
+                switch (sym)
+                {
+                    case 21: case 23: return 7323;
+                    default: return 6243;
+                }
+            case 5300:
+                switch (sym)
+                {
+                    case 44: case 46: return 5502;
+                    default: return 6243;
+                }
+            case 5310:
+                switch (sym)
+                {
+                    case 21: case 23: return 7301;
+                    default: return 6243;
+                }
+            case 5304:
+                switch (sym)
+                {
+                    case 17: case 18: return 5507;
+                    default: return 6243;
+                }
+            case 5419:
+                switch (sym)
+                {
+                    case 9: case 10: return 5621;
+                    default: return 6243;
+                }
+            case 5317:
+                switch (sym)
+                {
+                    case 40: case 41: return 5515;
+                    default: return 6243;
+                }
+            case 5326:
+                switch (sym)
+                {
+                    case 28: case 29: return 5521;
+                    default: return 6243;
+                }
+            case 5313:
+                switch (sym)
+                {
+                    case 20: case 22: return 5511;
+                    default: return 6243;
+                }
+            case 5309:
+                switch (sym)
+                {
+                    case 15: case 16: return 5508;
+                    default: return 6243;
+                }
+            case 5315:
+                switch (sym)
+                {
+                    case 21: case 23: return 5517;
+                    default: return 6243;
+                }
+            case 5318:
+                switch (sym)
+                {
+                    case 13: case 14: return 5510;
+                    default: return 6243;
+                }
+            case 5350:
+                switch (sym)
+                {
+                    case 38: case 39: return 5543;
+                    default: return 6243;
+                }
+            case 5333:
+                switch (sym)
+                {
+                    case 20: case 22: return 5526;
+                    default: return 6243;
+                }
+            case 5382:
+                switch (sym)
+                {
+                    case 36: case 37: return 5580;
+                    default: return 6243;
+                }
+            case 5340:
+                switch (sym)
+                {
+                    case 20: case 22: return 5541;
+                    default: return 6243;
+                }
+            case 5327:
+                switch (sym)
+                {
+                    case 11: case 12: return 5524;
+                    default: return 6243;
+                }
+            case 5336:
+                switch (sym)
+                {
+                    case 11: case 12: return 5532;
+                    default: return 6243;
+                }
+            case 5351:
+                switch (sym)
+                {
+                    case 20: case 22: return 5548;
+                    default: return 6243;
+                }
+            case 5432:
+                switch (sym)
+                {
+                    case 9: case 10: return 5627;
+                    default: return 6243;
+                }
+            case 5417:
+                switch (sym)
+                {
+                    case 20: case 22: return 5618;
+                    default: return 6243;
+                }
+            case 5424:
+                switch (sym)
+                {
+                    case 20: case 22: return 5620;
+                    default: return 6243;
+                }
+            case 5421:
+                switch (sym)
+                {
+                    case 38: case 39: return 5631;
+                    default: return 6243;
+                }
+            case 5434:
+                switch (sym)
+                {
+                    case 36: case 37: return 5636;
+                    default: return 6243;
+                }
+            case 5437:
+                switch (sym)
+                {
+                    case 20: case 22: return 5638;
+                    default: return 6243;
+                }
+            case 5439:
+                switch (sym)
+                {
+                    case 26: case 27: return 5626;
+                    default: return 870;
+                }
+            case 5435:
+                switch (sym)
+                {
+                    case 11: case 12: return 5637;
+                    default: return 6243;
+                }
+            case 5459:
+                switch (sym)
+                {
+                    case 45: case 47: return 7206;
+                    default: return 6243;
+                }
+            case 5441:
+                switch (sym)
+                {
+                    case 15: case 16: return 5641;
+                    default: return 6243;
+                }
+            case 5443:
+                switch (sym)
+                {
+                    case 17: case 18: return 5645;
+                    default: return 6243;
+                }
+            case 5442:
+                switch (sym)
+                {
+                    case 24: case 25: return 5642;
+                    default: return 6243;
+                }
+            case 5444:
+                switch (sym)
+                {
+                    case 17: case 18: return 5647;
+                    default: return 6243;
+                }
+            case 5445:
+                switch (sym)
+                {
+                    case 26: case 27: return 5655;
+                    default: return 870;
+                }
+            case 5447:
+                switch (sym)
+                {
+                    case 17: case 18: return 5651;
+                    default: return 6243;
+                }
+            case 5457:
+                switch (sym)
+                {
+                    case 34: case 35: return 5658;
+                    default: return 6243;
+                }
+            case 5449:
+                switch (sym)
+                {
+                    case 11: case 12: return 5653;
+                    default: return 6243;
+                }
+            case 5456:
+                switch (sym)
+                {
+                    case 21: case 23: return 5628;
+                    default: return 6243;
+                }
+            case 5458:
+                switch (sym)
+                {
+                    case 11: case 12: return 5657;
+                    default: return 6243;
+                }
+            case 5460:
+                switch (sym)
+                {
+                    case 21: case 23: return 7223;
+                    default: return 6243;
+                }
+            case 5467:
+                switch (sym)
+                {
+                    case 26: case 27: return 5662;
+                    default: return 870;
+                }
+            case 5461:
+                switch (sym)
+                {
+                    case 5: case 6: return 5661;
+                    default: return 6243;
+                }
+            case 5469:
+                switch (sym)
+                {
+                    case 24: case 25: return 5663;
+                    default: return 6243;
+                }
+            case 5468:
+                switch (sym)
+                {
+                    case 17: case 18: return 5667;
+                    default: return 6243;
+                }
+            case 5473:
+                switch (sym)
+                {
+                    case 21: case 23: return 5668;
+                    default: return 6243;
+                }
+            case 5462:
+                switch (sym)
+                {
+                    case 5: case 6: return 5643;
+                    default: return 6243;
+                }
+            case 5471:
+                switch (sym)
+                {
+                    case 5: case 6: return 4223;
+                    default: return 6243;
+                }
+            case 5477:
+                switch (sym)
+                {
+                    case 11: case 12: return 5669;
+                    default: return 6243;
+                }
+            case 5478:
+                switch (sym)
+                {
+                    case 44: case 46: return 5673;
+                    default: return 6243;
+                }
+            case 5484:
+                switch (sym)
+                {
+                    case 17: case 18: return 5674;
+                    default: return 6243;
+                }
+            case 5485:
+                switch (sym)
+                {
+                    case 34: case 35: return 5678;
+                    default: return 6243;
+                }
+            case 5486:
+                switch (sym)
+                {
+                    case 9: case 10: return 5680;
+                    default: return 6243;
+                }
+            case 5488:
+                switch (sym)
+                {
+                    case 5: case 6: return 7271;
+                    default: return 6243;
+                }
+            case 5487:
+                switch (sym)
+                {
+                    case 15: case 16: return 5681;
+                    default: return 6243;
+                }
+            case 5489:
+                switch (sym)
+                {
+                    case 26: case 27: return 5682;
+                    default: return 870;
+                }
+            case 5509:
+                switch (sym)
+                {
+                    case 11: case 12: return 5696;
+                    default: return 6243;
+                }
+            case 5496:
+                switch (sym)
+                {
+                    case 17: case 18: return 5687;
+                    default: return 6243;
+                }
+            case 5501:
+                switch (sym)
+                {
+                    case 26: case 27: return 5689;
+                    default: return 870;
+                }
+            case 5493:
+                switch (sym)
+                {
+                    case 9: case 10: return 5683;
+                    default: return 6243;
+                }
+            case 5506:
+                switch (sym)
+                {
+                    case 30: case 31: return 5691;
+                    default: return 6243;
+                }
+            case 5495:
+                switch (sym)
+                {
+                    case 5: case 6: return 5685;
+                    default: return 6243;
+                }
+            case 5521:
+                switch (sym)
+                {
+                    case 42: case 43: return 5703;
+                    default: return 6243;
+                }
+            case 5510:
+                switch (sym)
+                {
+                    case 17: case 18: return 5707;
+                    default: return 6243;
+                }
+            case 5502:
+                switch (sym)
+                {
+                    case 5: case 6: return 5688;
+                    default: return 6243;
+                }
+            case 5507:
+                switch (sym)
+                {
+                    case 13: case 14: return 5695;
+                    default: return 6243;
+                }
+            case 5508:
+                switch (sym)
+                {
+                    case 9: case 10: return 5701;
+                    default: return 6243;
+                }
+            case 5511:
+                switch (sym)
+                {
+                    case 11: case 12: return 5697;
+                    default: return 6243;
+                }
+            case 5515:
+                switch (sym)
+                {
+                    case 17: case 18: return 5709;
+                    default: return 6243;
+                }
+            case 5517:
+                switch (sym)
+                {
+                    case 5: case 6: return 7358;
+                    default: return 6243;
+                }
+            case 5524:
+                switch (sym)
+                {
+                    case 5: case 6: return 5702;
+                    default: return 6243;
+                }
+            case 5522:
+                switch (sym)
+                {
+                    case 32: case 33: return 5715;
+                    default: return 6243;
+                }
+            case 5526:
+                switch (sym)
+                {
+                    case 28: case 29: return 5716;
+                    default: return 6243;
+                }
+            case 5539:
+                switch (sym)
+                {
+                    case 11: case 12: return 5717;
+                    default: return 6243;
+                }
+            case 5532:
+                switch (sym)
+                {
+                    case 5: case 6: return 5711;
+                    default: return 6243;
+                }
+            case 5541:
+                switch (sym)
+                {
+                    case 9: case 10: return 5718;
+                    default: return 6243;
+                }
+            case 5542:
+                switch (sym)
+                {
+                    case 28: case 29: return 3389;
+                    default: return 6243;
+                }
+            case 5548:
+                switch (sym)
+                {
+                    case 28: case 29: return 5724;
+                    default: return 6243;
+                }
+            case 5543:
+                switch (sym)
+                {
+                    case 17: case 18: return 5721;
+                    default: return 6243;
+                }
+            case 5579:
+                switch (sym)
+                {
+                    case 28: case 29: return 5728;
+                    default: return 6243;
+                }
+            case 5559:
+                switch (sym)
+                {
+                    case 48: case 49: return 5730;
+                    default: return 6243;
+                }
+            case 5618:
+                switch (sym)
+                {
+                    case 36: case 37: return 5726;
+                    default: return 6243;
+                }
+            case 5619:
+                switch (sym)
+                {
+                    case 21: case 23: return 5735;
+                    default: return 6243;
+                }
+            case 5580:
+                switch (sym)
+                {
+                    case 9: case 10: return 5731;
+                    default: return 6243;
+                }
+            case 5621:
+                switch (sym)
+                {
+                    case 20: case 22: return 5744;
+                    default: return 6243;
+                }
+            case 5620:
+                switch (sym)
+                {
+                    case 28: case 29: return 5747;
+                    default: return 6243;
+                }
+            case 5702:
+                switch (sym)
+                {
+                    case 28: case 29: return 5811;
+                    default: return 6243;
+                }
+            case 5627:
+                switch (sym)
+                {
+                    case 13: case 14: return 5753;
+                    default: return 6243;
+                }
+            case 5626:
+                switch (sym)
+                {
+                    case 40: case 41: return 5759;
+                    default: return 6243;
+                }
+            case 5638:
+                switch (sym)
+                {
+                    case 24: case 25: return 5756;
+                    default: return 6243;
+                }
+            case 5631:
+                switch (sym)
+                {
+                    case 9: case 10: return 5751;
+                    default: return 6243;
+                }
+            case 5636:
+                switch (sym)
+                {
+                    case 5: case 6: return 7149;
+                    default: return 6243;
+                }
+            case 5641:
+                switch (sym)
+                {
+                    case 24: case 25: return 5758;
+                    default: return 6243;
+                }
+            case 5658:
+                switch (sym)
+                {
+                    case 15: case 16: return 5769;
+                    default: return 6243;
+                }
+            case 5637:
+                switch (sym)
+                {
+                    case 5: case 6: return 5755;
+                    default: return 6243;
+                }
+            case 5642:
+                switch (sym)
+                {
+                    case 9: case 10: return 5760;
+                    default: return 6243;
+                }
+            case 5628:
+                switch (sym)
+                {
+                    case 26: case 27: return 5765;
+                    default: return 870;
+                }
+            case 5695:
+                switch (sym)
+                {
+                    case 68: case 69: return 5805;
+                    default: return 6243;
+                }
+            case 5645:
+                switch (sym)
+                {
+                    case 5: case 6: return 7179;
+                    default: return 6243;
+                }
+            case 5661:
+                switch (sym)
+                {
+                    case 32: case 33: return 5775;
+                    default: return 6243;
+                }
+            case 5647:
+                switch (sym)
+                {
+                    case 5: case 6: return 7177;
+                    default: return 6243;
+                }
+            case 5651:
+                switch (sym)
+                {
+                    case 5: case 6: return 7175;
+                    default: return 6243;
+                }
+            case 5663:
+                switch (sym)
+                {
+                    case 44: case 46: return 7258;
+                    default: return 6243;
+                }
+            case 5653:
+                switch (sym)
+                {
+                    case 5: case 6: return 5761;
+                    default: return 6243;
+                }
+            case 5655:
+                switch (sym)
+                {
+                    case 9: case 10: return 5768;
+                    default: return 6243;
+                }
+            case 5657:
+                switch (sym)
+                {
+                    case 5: case 6: return 5773;
+                    default: return 6243;
+                }
+            case 5643:
+                switch (sym)
+                {
+                    case 26: case 27: return 5763;
+                    default: return 870;
+                }
+            case 5662:
+                switch (sym)
+                {
+                    case 9: case 10: return 5780;
+                    default: return 6243;
+                }
+            case 5680:
+                switch (sym)
+                {
+                    case 45: case 47: return 7280;
+                    default: return 6243;
+                }
+            case 5678:
+                switch (sym)
+                {
+                    case 34: case 35: return 5791;
+                    default: return 6243;
+                }
+            case 5685:
+                switch (sym)
+                {
+                    case 30: case 31: return 5796;
+                    default: return 6243;
+                }
+            case 5667:
+                switch (sym)
+                {
+                    case 5: case 6: return 7225;
+                    default: return 6243;
+                }
+            case 5668:
+                switch (sym)
+                {
+                    case 5: case 6: return 5774;
+                    default: return 6243;
+                }
+            case 5681:
+                switch (sym)
+                {
+                    case 40: case 41: return 5792;
+                    default: return 6243;
+                }
+            case 5669:
+                switch (sym)
+                {
+                    case 5: case 6: return 5788;
+                    default: return 6243;
+                }
+            case 5682:
+                switch (sym)
+                {
+                    case 21: case 23: return 5794;
+                    default: return 6243;
+                }
+            case 5673:
+                switch (sym)
+                {
+                    case 5: case 6: return 5790;
+                    default: return 6243;
+                }
+            case 5674:
+                switch (sym)
+                {
+                    case 5: case 6: return 7286;
+                    default: return 6243;
+                }
+            case 5688:
+                switch (sym)
+                {
+                    case 45: case 47: return 5778;
+                    default: return 6243;
+                }
+            case 5689:
+                switch (sym)
+                {
+                    case 36: case 37: return 5802;
+                    default: return 6243;
+                }
+            case 5696:
+                switch (sym)
+                {
+                    case 21: case 23: return 7335;
+                    default: return 6243;
+                }
+            case 5683:
+                switch (sym)
+                {
+                    case 5: case 6: return 5793;
+                    default: return 6243;
+                }
+            case 5687:
+                switch (sym)
+                {
+                    case 5: case 6: return 7327;
+                    default: return 6243;
+                }
+            case 5718:
+                switch (sym)
+                {
+                    case 50: case 52: return 7352;
+                    default: return 6243;
+                }
+            case 5691:
+                switch (sym)
+                {
+                    case 5: case 6: return 5803;
+                    default: return 6243;
+                }
+            case 5701:
+                switch (sym)
+                {
+                    case 5: case 6: return 7333;
+                    default: return 6243;
+                }
+            case 5703:
+                switch (sym)
+                {
+                    case 21: case 23: return 7371;
+                    default: return 6243;
+                }
+            case 5726:
+                switch (sym)
+                {
+                    case 26: case 27: return 5838;
+                    default: return 870;
+                }
+            case 5707:
+                switch (sym)
+                {
+                    case 5: case 6: return 7330;
+                    default: return 6243;
+                }
+            case 5709:
+                switch (sym)
+                {
+                    case 5: case 6: return 5809;
+                    default: return 6243;
+                }
+            case 5711:
+                switch (sym)
+                {
+                    case 20: case 22: return 5815;
+                    default: return 6243;
+                }
+            case 5715:
+                switch (sym)
+                {
+                    case 15: case 16: return 5812;
+                    default: return 6243;
+                }
+            case 5716:
+                switch (sym)
+                {
+                    case 5: case 6: return 7117;
+                    default: return 6243;
+                }
+            case 5717:
+                switch (sym)
+                {
+                    case 34: case 35: return 5818;
+                    default: return 6243;
+                }
+            case 5721:
+                switch (sym)
+                {
+                    case 17: case 18: return 7346;
+                    default: return 6243;
+                }
+            case 5724:
+                switch (sym)
+                {
+                    case 32: case 33: return 5823;
+                    default: return 6243;
+                }
+            case 5756:
+                switch (sym)
+                {
+                    case 44: case 46: return 7141;
+                    default: return 6243;
+                }
+            case 5758:
+                switch (sym)
+                {
+                    case 44: case 46: return 7164;
+                    default: return 6243;
+                }
+            case 5728:
+                switch (sym)
+                {
+                    case 13: case 14: return 5828;
+                    default: return 6243;
+                }
+            case 5730:
+                switch (sym)
+                {
+                    case 13: case 14: return 5830;
+                    default: return 6243;
+                }
+            case 5731:
+                switch (sym)
+                {
+                    case 13: case 14: return 5832;
+                    default: return 6243;
+                }
+            case 5747:
+                switch (sym)
+                {
+                    case 21: case 23: return 7111;
+                    default: return 6243;
+                }
+            case 5744:
+                switch (sym)
+                {
+                    case 11: case 12: return 7362;
+                    default: return 6243;
+                }
+            case 5735:
+                switch (sym)
+                {
+                    case 9: case 10: return 5837;
+                    default: return 6243;
+                }
+            case 5753:
+                switch (sym)
+                {
+                    case 24: case 25: return 5814;
+                    default: return 6243;
+                }
+            case 5755:
+                switch (sym)
+                {
+                    case 24: case 25: return 5851;
+                    default: return 6243;
+                }
+            case 5751:
+                switch (sym)
+                {
+                    case 5: case 6: return 5844;
+                    default: return 6243;
+                }
+            case 5759:
+                switch (sym)
+                {
+                    case 17: case 18: return 5852;
+                    default: return 6243;
+                }
+            case 5760:
+                switch (sym)
+                {
+                    case 21: case 23: return 7170;
+                    default: return 6243;
+                }
+            case 5761:
+                switch (sym)
+                {
+                    case 24: case 25: return 5853;
+                    default: return 6243;
+                }
+            case 5765:
+                switch (sym)
+                {
+                    case 36: case 37: return 5856;
+                    default: return 6243;
+                }
+            case 5773:
+                switch (sym)
+                {
+                    case 32: case 33: return 5860;
+                    default: return 6243;
+                }
+            case 5769:
+                switch (sym)
+                {
+                    case 36: case 37: return 5858;
+                    default: return 6243;
+                }
+            case 5763:
+                switch (sym)
+                {
+                    case 30: case 31: return 5865;
+                    default: return 6243;
+                }
+            case 5775:
+                switch (sym)
+                {
+                    case 15: case 16: return 5862;
+                    default: return 6243;
+                }
+            case 5768:
+                switch (sym)
+                {
+                    case 5: case 6: return 5859;
+                    default: return 6243;
+                }
+            case 5778:
+                switch (sym)
+                {
+                    case 54: case 55: return 5882;
+                    default: return 6243;
+                }
+            case 5780:
+                switch (sym)
+                {
+                    case 5: case 6: return 5867;
+                    default: return 6243;
+                }
+            case 5796:
+                switch (sym)
+                {
+                    case 38: case 39: return 5881;
+                    default: return 6243;
+                }
+            case 5774:
+                switch (sym)
+                {
+                    case 21: case 23: return 7247;
+                    default: return 6243;
+                }
+            case 5788:
+                switch (sym)
+                {
+                    case 24: case 25: return 5870;
+                    default: return 6243;
+                }
+            case 5791:
+                switch (sym)
+                {
+                    case 13: case 14: return 5873;
+                    default: return 6243;
+                }
+            case 5786:
+                switch (sym)
+                {
+                    case 5: case 6: return 5869;
+                    default: return 6243;
+                }
+            case 5790:
+                switch (sym)
+                {
+                    case 11: case 12: return 7261;
+                    default: return 6243;
+                }
+            case 5792:
+                switch (sym)
+                {
+                    case 17: case 18: return 5875;
+                    default: return 6243;
+                }
+            case 5794:
+                switch (sym)
+                {
+                    case 15: case 16: return 5876;
+                    default: return 6243;
+                }
+            case 5803:
+                switch (sym)
+                {
+                    case 32: case 33: return 5883;
+                    default: return 6243;
+                }
+            case 5793:
+                switch (sym)
+                {
+                    case 11: case 12: return 5880;
+                    default: return 6243;
+                }
+            case 5812:
+                switch (sym)
+                {
+                    case 38: case 39: return 5896;
+                    default: return 6243;
+                }
+            case 5802:
+                switch (sym)
+                {
+                    case 11: case 12: return 5884;
+                    default: return 6243;
+                }
+            case 5809:
+                switch (sym)
+                {
+                    case 21: case 23: return 7350;
+                    default: return 6243;
+                }
+            case 5806:
+                switch (sym)
+                {
+                    case 9: case 10: return 5886;
+                    default: return 6243;
+                }
+            case 5805:
+                switch (sym)
+                {
+                    case 5: case 6: return 7304;
+                    default: return 6243;
+                }
+            case 5811:
+                switch (sym)
+                {
+                    case 24: case 25: return 5894;
+                    default: return 6243;
+                }
+            case 5815:
+                switch (sym)
+                {
+                    case 11: case 12: return 5888;
+                    default: return 6243;
+                }
+            case 5818:
+                switch (sym)
+                {
+                    case 13: case 14: return 5887;
+                    default: return 6243;
+                }
+            case 5821:
+                switch (sym)
+                {
+                    case 9: case 10: return 5902;
+                    default: return 6243;
+                }
+            case 5823:
+                switch (sym)
+                {
+                    case 17: case 18: return 5903;
+                    default: return 6243;
+                }
+            case 5828:
+                switch (sym)
+                {
+                    case 34: case 35: return 5898;
+                    default: return 6243;
+                }
+            case 5830:
+                switch (sym)
+                {
+                    case 34: case 35: return 5907;
+                    default: return 6243;
+                }
+            case 5832:
+                switch (sym)
+                {
+                    case 34: case 35: return 5911;
+                    default: return 6243;
+                }
+            case 5838:
+                switch (sym)
+                {
+                    case 17: case 18: return 5920;
+                    default: return 6243;
+                }
+            case 5837:
+                switch (sym)
+                {
+                    case 5: case 6: return 5913;
+                    default: return 6243;
+                }
+            case 5862:
+                switch (sym)
+                {
+                    case 38: case 39: return 5937;
+                    default: return 6243;
+                }
+            case 5875:
+                switch (sym)
+                {
+                    case 5: case 6: return 5948;
+                    default: return 6243;
+                }
+            case 5851:
+                switch (sym)
+                {
+                    case 9: case 10: return 5931;
+                    default: return 6243;
+                }
+            case 5814:
+                switch (sym)
+                {
+                    case 26: case 27: return 5922;
+                    default: return 870;
+                }
+            case 5859:
+                switch (sym)
+                {
+                    case 11: case 12: return 5935;
+                    default: return 6243;
+                }
+            case 5856:
+                switch (sym)
+                {
+                    case 15: case 16: return 5934;
+                    default: return 6243;
+                }
+            case 5844:
+                switch (sym)
+                {
+                    case 21: case 23: return 7153;
+                    default: return 6243;
+                }
+            case 5852:
+                switch (sym)
+                {
+                    case 20: case 22: return 5932;
+                    default: return 6243;
+                }
+            case 5876:
+                switch (sym)
+                {
+                    case 51: case 53: return 5949;
+                    default: return 6243;
+                }
+            case 5858:
+                switch (sym)
+                {
+                    case 21: case 23: return 7188;
+                    default: return 6243;
+                }
+            case 5853:
+                switch (sym)
+                {
+                    case 9: case 10: return 5933;
+                    default: return 6243;
+                }
+            case 5873:
+                switch (sym)
+                {
+                    case 28: case 29: return 5944;
+                    default: return 6243;
+                }
+            case 5860:
+                switch (sym)
+                {
+                    case 13: case 14: return 5936;
+                    default: return 6243;
+                }
+            case 5865:
+                switch (sym)
+                {
+                    case 13: case 14: return 5941;
+                    default: return 6243;
+                }
+            case 5869:
+                switch (sym)
+                {
+                    case 17: case 18: return 7237;
+                    default: return 6243;
+                }
+            case 5867:
+                switch (sym)
+                {
+                    case 11: case 12: return 5938;
+                    default: return 6243;
+                }
+            case 5880:
+                switch (sym)
+                {
+                    case 34: case 35: return 5951;
+                    default: return 6243;
+                }
+            case 5881:
+                switch (sym)
+                {
+                    case 24: case 25: return 5959;
+                    default: return 6243;
+                }
+            case 5870:
+                switch (sym)
+                {
+                    case 9: case 10: return 5947;
+                    default: return 6243;
+                }
+            case 5883:
+                switch (sym)
+                {
+                    case 15: case 16: return 5961;
+                    default: return 6243;
+                }
+            case 5886:
+                switch (sym)
+                {
+                    case 45: case 47: return 5964;
+                    default: return 6243;
+                }
+            case 5882:
+                switch (sym)
+                {
+                    case 20: case 22: return 5955;
+                    default: return 6243;
+                }
+            case 5884:
+                switch (sym)
+                {
+                    case 20: case 22: return 5954;
+                    default: return 6243;
+                }
+            case 5888:
+                switch (sym)
+                {
+                    case 30: case 31: return 5965;
+                    default: return 6243;
+                }
+            case 5896:
+                switch (sym)
+                {
+                    case 17: case 18: return 5966;
+                    default: return 6243;
+                }
+            case 5898:
+                switch (sym)
+                {
+                    case 38: case 39: return 5973;
+                    default: return 6243;
+                }
+            case 5907:
+                switch (sym)
+                {
+                    case 38: case 39: return 5974;
+                    default: return 6243;
+                }
+            case 5932:
+                switch (sym)
+                {
+                    case 24: case 25: return 5979;
+                    default: return 6243;
+                }
+            case 5887:
+                switch (sym)
+                {
+                    case 28: case 29: return 5969;
+                    default: return 6243;
+                }
+            case 5894:
+                switch (sym)
+                {
+                    case 5: case 6: return 7375;
+                    default: return 6243;
+                }
+            case 5935:
+                switch (sym)
+                {
+                    case 34: case 35: return 5996;
+                    default: return 6243;
+                }
+            case 5913:
+                switch (sym)
+                {
+                    case 30: case 31: return 7160;
+                    default: return 6243;
+                }
+            case 5902:
+                switch (sym)
+                {
+                    case 5: case 6: return 5972;
+                    default: return 6243;
+                }
+            case 5903:
+                switch (sym)
+                {
+                    case 13: case 14: return 5971;
+                    default: return 6243;
+                }
+            case 5920:
+                switch (sym)
+                {
+                    case 5: case 6: return 5981;
+                    default: return 6243;
+                }
+            case 5911:
+                switch (sym)
+                {
+                    case 13: case 14: return 5975;
+                    default: return 6243;
+                }
+            case 5922:
+                switch (sym)
+                {
+                    case 15: case 16: return 5983;
+                    default: return 6243;
+                }
+            case 5931:
+                switch (sym)
+                {
+                    case 20: case 22: return 5987;
+                    default: return 6243;
+                }
+            case 5933:
+                switch (sym)
+                {
+                    case 20: case 22: return 5990;
+                    default: return 6243;
+                }
+            case 5934:
+                switch (sym)
+                {
+                    case 11: case 12: return 5991;
+                    default: return 6243;
+                }
+            case 5936:
+                switch (sym)
+                {
+                    case 48: case 49: return 7208;
+                    default: return 6243;
+                }
+            case 5937:
+                switch (sym)
+                {
+                    case 17: case 18: return 5994;
+                    default: return 6243;
+                }
+            case 5941:
+                switch (sym)
+                {
+                    case 11: case 12: return 6004;
+                    default: return 6243;
+                }
+            case 5938:
+                switch (sym)
+                {
+                    case 34: case 35: return 6006;
+                    default: return 6243;
+                }
+            case 5947:
+                switch (sym)
+                {
+                    case 20: case 22: return 6008;
+                    default: return 6243;
+                }
+            case 5944:
+                switch (sym)
+                {
+                    case 42: case 43: return 5997;
+                    default: return 6243;
+                }
+            case 5949:
+                switch (sym)
+                {
+                    case 5: case 6: return 6010;
+                    default: return 6243;
+                }
+            case 5951:
+                switch (sym)
+                {
+                    case 13: case 14: return 5999;
+                    default: return 6243;
+                }
+            case 5954:
+                switch (sym)
+                {
+                    case 30: case 31: return 6017;
+                    default: return 6243;
+                }
+            case 5955:
+                switch (sym)
+                {
+                    case 11: case 12: return 6014;
+                    default: return 6243;
+                }
+            case 5961:
+                switch (sym)
+                {
+                    case 38: case 39: return 6016;
+                    default: return 6243;
+                }
+            case 5975:
+                switch (sym)
+                {
+                    case 68: case 69: return 6035;
+                    default: return 6243;
+                }
+            case 5959:
+                switch (sym)
+                {
+                    case 5: case 6: return 7293;
+                    default: return 6243;
+                }
+            case 5964:
+                switch (sym)
+                {
+                    case 36: case 37: return 6018;
+                    default: return 6243;
+                }
+            case 5965:
+                switch (sym)
+                {
+                    case 5: case 6: return 6020;
+                    default: return 6243;
+                }
+            case 5966:
+                switch (sym)
+                {
+                    case 9: case 10: return 7364;
+                    default: return 6243;
+                }
+            case 5973:
+                switch (sym)
+                {
+                    case 34: case 35: return 7255;
+                    default: return 6243;
+                }
+            case 5969:
+                switch (sym)
+                {
+                    case 15: case 16: return 6022;
+                    default: return 6243;
+                }
+            case 5972:
+                switch (sym)
+                {
+                    case 11: case 12: return 6026;
+                    default: return 6243;
+                }
+            case 5971:
+                switch (sym)
+                {
+                    case 24: case 25: return 6028;
+                    default: return 6243;
+                }
+            case 5974:
+                switch (sym)
+                {
+                    case 34: case 35: return 7254;
+                    default: return 6243;
+                }
+            case 5981:
+                switch (sym)
+                {
+                    case 51: case 53: return 6043;
+                    default: return 6243;
+                }
+            case 5983:
+                switch (sym)
+                {
+                    case 21: case 23: return 6049;
+                    default: return 6243;
+                }
+            case 5979:
+                switch (sym)
+                {
+                    case 44: case 46: return 7138;
+                    default: return 6243;
+                }
+            case 5987:
+                switch (sym)
+                {
+                    case 11: case 12: return 6036;
+                    default: return 6243;
+                }
+            case 5990:
+                switch (sym)
+                {
+                    case 11: case 12: return 6044;
+                    default: return 6243;
+                }
+            case 5996:
+                switch (sym)
+                {
+                    case 13: case 14: return 6055;
+                    default: return 6243;
+                }
+            case 5991:
+                switch (sym)
+                {
+                    case 21: case 23: return 6051;
+                    default: return 6243;
+                }
+            case 5994:
+                switch (sym)
+                {
+                    case 9: case 10: return 7220;
+                    default: return 6243;
+                }
+            case 6008:
+                switch (sym)
+                {
+                    case 11: case 12: return 6058;
+                    default: return 6243;
+                }
+            case 6017:
+                switch (sym)
+                {
+                    case 38: case 39: return 6062;
+                    default: return 6243;
+                }
+            case 6006:
+                switch (sym)
+                {
+                    case 13: case 14: return 6057;
+                    default: return 6243;
+                }
+            case 6004:
+                switch (sym)
+                {
+                    case 5: case 6: return 6052;
+                    default: return 6243;
+                }
+            case 5997:
+                switch (sym)
+                {
+                    case 26: case 27: return 6060;
+                    default: return 870;
+                }
+            case 6009:
+                switch (sym)
+                {
+                    case 13: case 14: return 6059;
+                    default: return 6243;
+                }
+            case 6010:
+                switch (sym)
+                {
+                    case 30: case 31: return 7268;
+                    default: return 6243;
+                }
+            case 5999:
+                switch (sym)
+                {
+                    case 28: case 29: return 6065;
+                    default: return 6243;
+                }
+            case 6014:
+                switch (sym)
+                {
+                    case 30: case 31: return 6066;
+                    default: return 6243;
+                }
+            case 6016:
+                switch (sym)
+                {
+                    case 17: case 18: return 6070;
+                    default: return 6243;
+                }
+            case 6026:
+                switch (sym)
+                {
+                    case 34: case 35: return 6077;
+                    default: return 6243;
+                }
+            case 6020:
+                switch (sym)
+                {
+                    case 11: case 12: return 7365;
+                    default: return 6243;
+                }
+            case 6036:
+                switch (sym)
+                {
+                    case 45: case 47: return 7146;
+                    default: return 6243;
+                }
+            case 6018:
+                switch (sym)
+                {
+                    case 5: case 6: return 7367;
+                    default: return 6243;
+                }
+            case 6022:
+                switch (sym)
+                {
+                    case 17: case 18: return 6075;
+                    default: return 6243;
+                }
+            case 6028:
+                switch (sym)
+                {
+                    case 9: case 10: return 6079;
+                    default: return 6243;
+                }
+            case 6044:
+                switch (sym)
+                {
+                    case 45: case 47: return 7172;
+                    default: return 6243;
+                }
+            case 6035:
+                switch (sym)
+                {
+                    case 5: case 6: return 6082;
+                    default: return 6243;
+                }
+            case 6043:
+                switch (sym)
+                {
+                    case 5: case 6: return 6084;
+                    default: return 6243;
+                }
+            case 6049:
+                switch (sym)
+                {
+                    case 9: case 10: return 7157;
+                    default: return 6243;
+                }
+            case 6051:
+                switch (sym)
+                {
+                    case 5: case 6: return 6098;
+                    default: return 6243;
+                }
+            case 6055:
+                switch (sym)
+                {
+                    case 28: case 29: return 6099;
+                    default: return 6243;
+                }
+            case 6058:
+                switch (sym)
+                {
+                    case 45: case 47: return 7264;
+                    default: return 6243;
+                }
+            case 6057:
+                switch (sym)
+                {
+                    case 28: case 29: return 6101;
+                    default: return 6243;
+                }
+            case 6060:
+                switch (sym)
+                {
+                    case 17: case 18: return 6103;
+                    default: return 6243;
+                }
+            case 6052:
+                switch (sym)
+                {
+                    case 24: case 25: return 6100;
+                    default: return 6243;
+                }
+            case 6059:
+                switch (sym)
+                {
+                    case 28: case 29: return 6105;
+                    default: return 6243;
+                }
+            case 6070:
+                switch (sym)
+                {
+                    case 9: case 10: return 7307;
+                    default: return 6243;
+                }
+            case 6135:
+                switch (sym)
+                {
+                    case 40: case 41: return 6174;
+                    default: return 6243;
+                }
+            case 6082:
+                switch (sym)
+                {
+                    case 30: case 31: return 7253;
+                    default: return 6243;
+                }
+            case 6066:
+                switch (sym)
+                {
+                    case 21: case 23: return 7318;
+                    default: return 6243;
+                }
+            case 6062:
+                switch (sym)
+                {
+                    case 24: case 25: return 6112;
+                    default: return 6243;
+                }
+            case 6065:
+                switch (sym)
+                {
+                    case 15: case 16: return 6107;
+                    default: return 6243;
+                }
+            case 6075:
+                switch (sym)
+                {
+                    case 21: case 23: return 7353;
+                    default: return 6243;
+                }
+            case 6077:
+                switch (sym)
+                {
+                    case 13: case 14: return 6111;
+                    default: return 6243;
+                }
+            case 6079:
+                switch (sym)
+                {
+                    case 21: case 23: return 7345;
+                    default: return 6243;
+                }
+            case 6098:
+                switch (sym)
+                {
+                    case 9: case 10: return 6114;
+                    default: return 6243;
+                }
+            case 6084:
+                switch (sym)
+                {
+                    case 17: case 18: return 7161;
+                    default: return 6243;
+                }
+            case 6099:
+                switch (sym)
+                {
+                    case 15: case 16: return 6130;
+                    default: return 6243;
+                }
+            case 6107:
+                switch (sym)
+                {
+                    case 17: case 18: return 6137;
+                    default: return 6243;
+                }
+            case 6100:
+                switch (sym)
+                {
+                    case 9: case 10: return 6132;
+                    default: return 6243;
+                }
+            case 6101:
+                switch (sym)
+                {
+                    case 15: case 16: return 6134;
+                    default: return 6243;
+                }
+            case 6111:
+                switch (sym)
+                {
+                    case 28: case 29: return 6143;
+                    default: return 6243;
+                }
+            case 6103:
+                switch (sym)
+                {
+                    case 15: case 16: return 6133;
+                    default: return 6243;
+                }
+            case 6114:
+                switch (sym)
+                {
+                    case 15: case 16: return 6135;
+                    default: return 6243;
+                }
+            case 6105:
+                switch (sym)
+                {
+                    case 9: case 10: return 6136;
+                    default: return 6243;
+                }
+            case 6112:
+                switch (sym)
+                {
+                    case 9: case 10: return 6140;
+                    default: return 6243;
+                }
+            case 6130:
+                switch (sym)
+                {
+                    case 17: case 18: return 6144;
+                    default: return 6243;
+                }
+            case 6132:
+                switch (sym)
+                {
+                    case 20: case 22: return 6155;
+                    default: return 6243;
+                }
+            case 6133:
+                switch (sym)
+                {
+                    case 28: case 29: return 6157;
+                    default: return 6243;
+                }
+            case 6134:
+                switch (sym)
+                {
+                    case 17: case 18: return 6156;
+                    default: return 6243;
+                }
+            case 6137:
+                switch (sym)
+                {
+                    case 21: case 23: return 7297;
+                    default: return 6243;
+                }
+            case 6140:
+                switch (sym)
+                {
+                    case 13: case 14: return 6159;
+                    default: return 6243;
+                }
+            case 6136:
+                switch (sym)
+                {
+                    case 5: case 6: return 6158;
+                    default: return 6243;
+                }
+            case 6143:
+                switch (sym)
+                {
+                    case 15: case 16: return 6161;
+                    default: return 6243;
+                }
+            case 6157:
+                switch (sym)
+                {
+                    case 42: case 43: return 6175;
+                    default: return 6243;
+                }
+            case 6144:
+                switch (sym)
+                {
+                    case 21: case 23: return 7196;
+                    default: return 6243;
+                }
+            case 6156:
+                switch (sym)
+                {
+                    case 21: case 23: return 7228;
+                    default: return 6243;
+                }
+            case 6155:
+                switch (sym)
+                {
+                    case 11: case 12: return 3317;
+                    default: return 6243;
+                }
+            case 6158:
+                switch (sym)
+                {
+                    case 11: case 12: return 6177;
+                    default: return 6243;
+                }
+            case 6161:
+                switch (sym)
+                {
+                    case 17: case 18: return 6179;
+                    default: return 6243;
+                }
+            case 6159:
+                switch (sym)
+                {
+                    case 20: case 22: return 6178;
+                    default: return 6243;
+                }
+            case 6175:
+                switch (sym)
+                {
+                    case 38: case 39: return 6195;
+                    default: return 6243;
+                }
+            case 6177:
+                switch (sym)
+                {
+                    case 32: case 33: return 6198;
+                    default: return 6243;
+                }
+            case 6174:
+                switch (sym)
+                {
+                    case 17: case 18: return 6193;
+                    default: return 6243;
+                }
+            case 6179:
+                switch (sym)
+                {
+                    case 21: case 23: return 7354;
+                    default: return 6243;
+                }
+            case 6200:
+                switch (sym)
+                {
+                    case 42: case 43: return 6228;
+                    default: return 6243;
+                }
+            case 6178:
+                switch (sym)
+                {
+                    case 28: case 29: return 6199;
+                    default: return 6243;
+                }
+            case 6193:
+                switch (sym)
+                {
+                    case 5: case 6: return 7203;
+                    default: return 6243;
+                }
+            case 6194:
+                switch (sym)
+                {
+                    case 5: case 6: return 6207;
+                    default: return 6243;
+                }
+            case 6195:
+                switch (sym)
+                {
+                    case 15: case 16: return 6200;
+                    default: return 6243;
+                }
+            case 6198:
+                switch (sym)
+                {
+                    case 15: case 16: return 6212;
+                    default: return 6243;
+                }
+            case 6199:
+                switch (sym)
+                {
+                    case 21: case 23: return 7311;
+                    default: return 6243;
+                }
+            case 6207:
+                switch (sym)
+                {
+                    case 21: case 23: return 7232;
+                    default: return 6243;
+                }
+            case 6212:
+                switch (sym)
+                {
+                    case 24: case 25: return 6229;
+                    default: return 6243;
+                }
+            case 6228:
+                switch (sym)
+                {
+                    case 5: case 6: return 7282;
+                    default: return 6243;
+                }
+            case 6229:
+                switch (sym)
+                {
+                    case 5: case 6: return 6230;
+                    default: return 6243;
+                }
+            case 6230:
+                switch (sym)
+                {
+                    case 21: case 23: return 7273;
+                    default: return 6243;
+                }
+            default:
+            {
+                int i = _baseAction[state],
+                    k = i + sym;
+                return _termAction[_termCheck[k] == sym ? k : i];
+            }
+        }
+    }
+
+    static int directLookAhead(int la_state, int sym)
+    {
+        switch (la_state)
+        {
+            case 3720:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 4479;
+                    default: return 573;
+                }
+            case 3820:
+                switch (sym)
+                {
+                    case 4: case 5: case 6: case 9: case 10: case 11: case 12: case 13:
+                    case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21:
+                    case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29:
+                    case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37:
+                    case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45:
+                    case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53:
+                    case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61:
+                    case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69:
+                    case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77:
+                    case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85:
+                    case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93:
+                    case 94: case 95: case 96: case 97: case 98: case 99: return 4518;
+                    default: return 572;
+                }
+            case 4439:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 1116;
+                }
+            case 5000:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 1104;
+                }
+            case 5013:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 1097;
+                }
+            case 5022:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 1093;
+                }
+            case 5035:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 1006;
+                }
+            case 5044:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 991;
+                }
+            case 5057:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 957;
+                }
+            case 5066:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 911;
+                }
+            case 5079:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 911;
+                }
+            case 5088:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: case 19: return 7133;
+                    default: return 911;
+                }
+            case 5173:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1129;
+                }
+            case 5182:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1126;
+                }
+            case 5191:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1113;
+                }
+            case 5200:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1078;
+                }
+            case 5209:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1073;
+                }
+            case 5218:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1070;
+                }
+            case 5227:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1066;
+                }
+            case 5236:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1062;
+                }
+            case 5245:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1059;
+                }
+            case 5254:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1056;
+                }
+            case 5263:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1052;
+                }
+            case 5272:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1048;
+                }
+            case 5281:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1045;
+                }
+            case 5290:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1035;
+                }
+            case 5299:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1023;
+                }
+            case 5308:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1013;
+                }
+            case 5317:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 998;
+                }
+            case 5326:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 975;
+                }
+            case 5335:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 972;
+                }
+            case 5344:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 969;
+                }
+            case 5353:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 943;
+                }
+            case 5362:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 940;
+                }
+            case 5371:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 937;
+                }
+            case 5380:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 925;
+                }
+            case 5389:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 922;
+                }
+            case 5398:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 919;
+                }
+            case 5407:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 908;
+                }
+            case 5416:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1130;
+                }
+            case 5425:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1127;
+                }
+            case 5434:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1117;
+                }
+            case 5443:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1114;
+                }
+            case 5452:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1105;
+                }
+            case 5461:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1098;
+                }
+            case 5470:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1094;
+                }
+            case 5479:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1079;
+                }
+            case 5488:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1074;
+                }
+            case 5497:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1071;
+                }
+            case 5506:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1067;
+                }
+            case 5515:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1063;
+                }
+            case 5524:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1060;
+                }
+            case 5533:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1057;
+                }
+            case 5542:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1053;
+                }
+            case 5551:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1049;
+                }
+            case 5560:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1046;
+                }
+            case 5569:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1036;
+                }
+            case 5578:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1024;
+                }
+            case 5587:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1014;
+                }
+            case 5596:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1007;
+                }
+            case 5605:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 999;
+                }
+            case 5614:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 992;
+                }
+            case 5623:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 976;
+                }
+            case 5632:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 973;
+                }
+            case 5641:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 970;
+                }
+            case 5650:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 958;
+                }
+            case 5659:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 944;
+                }
+            case 5668:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 941;
+                }
+            case 5677:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 938;
+                }
+            case 5686:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 926;
+                }
+            case 5695:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 923;
+                }
+            case 5704:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 920;
+                }
+            case 5713:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 912;
+                }
+            case 5722:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 909;
+                }
+            case 5731:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1123;
+                }
+            case 5740:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1118;
+                }
+            case 5749:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1106;
+                }
+            case 5758:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1099;
+                }
+            case 5767:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1095;
+                }
+            case 5776:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1089;
+                }
+            case 5785:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1086;
+                }
+            case 5794:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1083;
+                }
+            case 5803:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1081;
+                }
+            case 5812:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1042;
+                }
+            case 5821:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1038;
+                }
+            case 5830:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1033;
+                }
+            case 5839:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1029;
+                }
+            case 5848:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1027;
+                }
+            case 5857:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1020;
+                }
+            case 5866:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1017;
+                }
+            case 5875:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1008;
+                }
+            case 5884:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1003;
+                }
+            case 5893:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1001;
+                }
+            case 5902:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 993;
+                }
+            case 5911:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 987;
+                }
+            case 5920:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 984;
+                }
+            case 5929:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 981;
+                }
+            case 5938:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 967;
+                }
+            case 5947:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 964;
+                }
+            case 5956:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 962;
+                }
+            case 5965:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 959;
+                }
+            case 5974:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 949;
+                }
+            case 5983:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 947;
+                }
+            case 5992:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 935;
+                }
+            case 6001:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 933;
+                }
+            case 6010:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 931;
+                }
+            case 6019:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 928;
+                }
+            case 6028:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 913;
+                }
+            case 6037:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 905;
+                }
+            case 6046:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 902;
+                }
+            case 6055:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 950;
+                }
+            case 6064:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 951;
+                }
+            case 6073:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 897;
+                }
+            case 6082:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 1091;
+                }
+            case 6091:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 979;
+                }
+            case 6100:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 952;
+                }
+            case 6109:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 894;
+                }
+            case 6118:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7133;
+                    default: return 894;
+                }
+            case 6127:
+                switch (sym)
+                {
+                    case 1: case 2: case 3: case 4: case 7: case 8: return 7129;
+                    default: return 894;
+                }
+            default:
+            {
+                int k = la_state + sym;
+                return _termAction[_termCheck[k] == sym ? k : la_state];
+            }
+        }
+    }
+
+    int tAction(int state, int sym) override { return directTAction(state, sym); }
+
+    int lookAhead(int la_state, int sym) override { return directLookAhead(la_state, sym); }
+};
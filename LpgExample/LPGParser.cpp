@@ -1,11 +1,12 @@
 
-    //#line 360 "btParserTemplateF.gi
+    //#line 385 "btParserTemplateF.gi
 
      #include "LPGParser.h"
 
 #include "LPGParser_top_level_ast.h"
 
-    void LPGParser::ruleAction(int ruleNumber)
+    template <bool probe>
+    void LPGParser::ruleAction(int ruleNumber, bool* found)
     {
         switch (ruleNumber)
         {
@@ -15,6 +16,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 1:  LPG ::= options_segment LPG_INPUT
             //
             case 1: {
+               if constexpr (probe) { *found = true; break; }
                //#line 51 "LPGParser.g"
                 setResult(
                     //#line 51 LPGParser.g
@@ -31,6 +33,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 2:  LPG_INPUT ::= $Empty
             //
             case 2: {
+               if constexpr (probe) { *found = true; break; }
                //#line 59 "LPGParser.g"
                 setResult(
                     //#line 59 LPGParser.g
@@ -43,6 +46,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 3:  LPG_INPUT ::= LPG_INPUT LPG_item
             //
             case 3: {
+               if constexpr (probe) { *found = true; break; }
                //#line 60 "LPGParser.g"
                 ((LPG_itemList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -51,6 +55,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 4:  LPG_item ::= ALIAS_KEY$ alias_segment END_KEY_OPT$
             //
             case 4: {
+               if constexpr (probe) { *found = true; break; }
                //#line 63 "LPGParser.g"
                 setResult(
                     //#line 63 LPGParser.g
@@ -65,6 +70,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 5:  LPG_item ::= AST_KEY$ ast_segment END_KEY_OPT$
             //
             case 5: {
+               if constexpr (probe) { *found = true; break; }
                //#line 64 "LPGParser.g"
                 setResult(
                     //#line 64 LPGParser.g
@@ -79,6 +85,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 6:  LPG_item ::= DEFINE_KEY$ define_segment END_KEY_OPT$
             //
             case 6: {
+               if constexpr (probe) { *found = true; break; }
                //#line 65 "LPGParser.g"
                 setResult(
                     //#line 65 LPGParser.g
@@ -93,6 +100,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 7:  LPG_item ::= EOF_KEY$ eof_segment END_KEY_OPT$
             //
             case 7: {
+               if constexpr (probe) { *found = true; break; }
                //#line 66 "LPGParser.g"
                 setResult(
                     //#line 66 LPGParser.g
@@ -107,6 +115,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 8:  LPG_item ::= EOL_KEY$ eol_segment END_KEY_OPT$
             //
             case 8: {
+               if constexpr (probe) { *found = true; break; }
                //#line 67 "LPGParser.g"
                 setResult(
                     //#line 67 LPGParser.g
@@ -121,6 +130,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 9:  LPG_item ::= ERROR_KEY$ error_segment END_KEY_OPT$
             //
             case 9: {
+               if constexpr (probe) { *found = true; break; }
                //#line 68 "LPGParser.g"
                 setResult(
                     //#line 68 LPGParser.g
@@ -135,6 +145,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 10:  LPG_item ::= EXPORT_KEY$ export_segment END_KEY_OPT$
             //
             case 10: {
+               if constexpr (probe) { *found = true; break; }
                //#line 69 "LPGParser.g"
                 setResult(
                     //#line 69 LPGParser.g
@@ -149,6 +160,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 11:  LPG_item ::= GLOBALS_KEY$ globals_segment END_KEY_OPT$
             //
             case 11: {
+               if constexpr (probe) { *found = true; break; }
                //#line 70 "LPGParser.g"
                 setResult(
                     //#line 70 LPGParser.g
@@ -163,6 +175,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 12:  LPG_item ::= HEADERS_KEY$ headers_segment END_KEY_OPT$
             //
             case 12: {
+               if constexpr (probe) { *found = true; break; }
                //#line 71 "LPGParser.g"
                 setResult(
                     //#line 71 LPGParser.g
@@ -177,6 +190,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 13:  LPG_item ::= IDENTIFIER_KEY$ identifier_segment END_KEY_OPT$
             //
             case 13: {
+               if constexpr (probe) { *found = true; break; }
                //#line 72 "LPGParser.g"
                 setResult(
                     //#line 72 LPGParser.g
@@ -191,6 +205,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 14:  LPG_item ::= IMPORT_KEY$ import_segment END_KEY_OPT$
             //
             case 14: {
+               if constexpr (probe) { *found = true; break; }
                //#line 73 "LPGParser.g"
                 setResult(
                     //#line 73 LPGParser.g
@@ -205,6 +220,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 15:  LPG_item ::= INCLUDE_KEY$ include_segment END_KEY_OPT$
             //
             case 15: {
+               if constexpr (probe) { *found = true; break; }
                //#line 74 "LPGParser.g"
                 setResult(
                     //#line 74 LPGParser.g
@@ -219,6 +235,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 16:  LPG_item ::= KEYWORDS_KEY$ keywords_segment END_KEY_OPT$
             //
             case 16: {
+               if constexpr (probe) { *found = true; break; }
                //#line 75 "LPGParser.g"
                 setResult(
                     //#line 75 LPGParser.g
@@ -233,6 +250,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 17:  LPG_item ::= NAMES_KEY$ names_segment END_KEY_OPT$
             //
             case 17: {
+               if constexpr (probe) { *found = true; break; }
                //#line 76 "LPGParser.g"
                 setResult(
                     //#line 76 LPGParser.g
@@ -247,6 +265,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 18:  LPG_item ::= NOTICE_KEY$ notice_segment END_KEY_OPT$
             //
             case 18: {
+               if constexpr (probe) { *found = true; break; }
                //#line 77 "LPGParser.g"
                 setResult(
                     //#line 77 LPGParser.g
@@ -261,6 +280,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 19:  LPG_item ::= RULES_KEY$ rules_segment END_KEY_OPT$
             //
             case 19: {
+               if constexpr (probe) { *found = true; break; }
                //#line 78 "LPGParser.g"
                 setResult(
                     //#line 78 LPGParser.g
@@ -275,6 +295,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 20:  LPG_item ::= SOFT_KEYWORDS_KEY$ keywords_segment END_KEY_OPT$
             //
             case 20: {
+               if constexpr (probe) { *found = true; break; }
                //#line 79 "LPGParser.g"
                 setResult(
                     //#line 79 LPGParser.g
@@ -289,6 +310,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 21:  LPG_item ::= START_KEY$ start_segment END_KEY_OPT$
             //
             case 21: {
+               if constexpr (probe) { *found = true; break; }
                //#line 80 "LPGParser.g"
                 setResult(
                     //#line 80 LPGParser.g
@@ -303,6 +325,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 22:  LPG_item ::= TERMINALS_KEY$ terminals_segment END_KEY_OPT$
             //
             case 22: {
+               if constexpr (probe) { *found = true; break; }
                //#line 81 "LPGParser.g"
                 setResult(
                     //#line 81 LPGParser.g
@@ -317,6 +340,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 23:  LPG_item ::= TRAILERS_KEY$ trailers_segment END_KEY_OPT$
             //
             case 23: {
+               if constexpr (probe) { *found = true; break; }
                //#line 82 "LPGParser.g"
                 setResult(
                     //#line 82 LPGParser.g
@@ -331,6 +355,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 24:  LPG_item ::= TYPES_KEY$ types_segment END_KEY_OPT$
             //
             case 24: {
+               if constexpr (probe) { *found = true; break; }
                //#line 83 "LPGParser.g"
                 setResult(
                     //#line 83 LPGParser.g
@@ -345,6 +370,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 25:  LPG_item ::= RECOVER_KEY$ recover_segment END_KEY_OPT$
             //
             case 25: {
+               if constexpr (probe) { *found = true; break; }
                //#line 84 "LPGParser.g"
                 setResult(
                     //#line 84 LPGParser.g
@@ -359,6 +385,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 26:  LPG_item ::= DISJOINTPREDECESSORSETS_KEY$ predecessor_segment END_KEY_OPT$
             //
             case 26: {
+               if constexpr (probe) { *found = true; break; }
                //#line 85 "LPGParser.g"
                 setResult(
                     //#line 85 LPGParser.g
@@ -373,6 +400,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 27:  options_segment ::= $Empty
             //
             case 27: {
+               if constexpr (probe) { *found = true; break; }
                //#line 88 "LPGParser.g"
                 setResult(
                     //#line 88 LPGParser.g
@@ -385,6 +413,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 28:  options_segment ::= options_segment option_spec
             //
             case 28: {
+               if constexpr (probe) { *found = true; break; }
                //#line 88 "LPGParser.g"
                 ((option_specList*)getRhsSym(1))->addElement((option_spec *)getRhsSym(2));
             break;
@@ -393,6 +422,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 29:  option_spec ::= OPTIONS_KEY$ option_list
             //
             case 29: {
+               if constexpr (probe) { *found = true; break; }
                //#line 89 "LPGParser.g"
                 setResult(
                     //#line 89 LPGParser.g
@@ -407,6 +437,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 30:  option_list ::= option
             //
             case 30: {
+               if constexpr (probe) { *found = true; break; }
                //#line 90 "LPGParser.g"
                 setResult(
                     //#line 90 LPGParser.g
@@ -419,6 +450,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 31:  option_list ::= option_list ,$ option
             //
             case 31: {
+               if constexpr (probe) { *found = true; break; }
                //#line 90 "LPGParser.g"
                 ((optionList*)getRhsSym(1))->addElement((option *)getRhsSym(3));
             break;
@@ -427,6 +459,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 32:  option ::= SYMBOL option_value
             //
             case 32: {
+               if constexpr (probe) { *found = true; break; }
                //#line 91 "LPGParser.g"
                 setResult(
                     //#line 91 LPGParser.g
@@ -443,6 +476,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 33:  option_value ::= $Empty
             //
             case 33: {
+               if constexpr (probe) { *found = true; break; }
                //#line 92 "LPGParser.g"
                 setResult(nullptr);
             break;
@@ -451,6 +485,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 34:  option_value ::= =$ SYMBOL
             //
             case 34: {
+               if constexpr (probe) { *found = true; break; }
                //#line 92 "LPGParser.g"
                 setResult(
                     //#line 92 LPGParser.g
@@ -465,6 +500,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 35:  option_value ::= =$ ($ symbol_list )$
             //
             case 35: {
+               if constexpr (probe) { *found = true; break; }
                //#line 92 "LPGParser.g"
                 setResult(
                     //#line 92 LPGParser.g
@@ -479,6 +515,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 36:  symbol_list ::= SYMBOL
             //
             case 36: {
+               if constexpr (probe) { *found = true; break; }
                //#line 94 "LPGParser.g"
                 setResult(
                     //#line 94 LPGParser.g
@@ -491,6 +528,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 37:  symbol_list ::= symbol_list ,$ SYMBOL
             //
             case 37: {
+               if constexpr (probe) { *found = true; break; }
                //#line 95 "LPGParser.g"
                 ((SYMBOLList*)getRhsSym(1))->addElement( _automatic_ast_pool << new ASTNodeToken(getRhsIToken(3)));
             break;
@@ -499,6 +537,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 38:  alias_segment ::= aliasSpec
             //
             case 38: {
+               if constexpr (probe) { *found = true; break; }
                //#line 98 "LPGParser.g"
                 setResult(
                     //#line 98 LPGParser.g
@@ -511,6 +550,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 39:  alias_segment ::= alias_segment aliasSpec
             //
             case 39: {
+               if constexpr (probe) { *found = true; break; }
                //#line 98 "LPGParser.g"
                 ((aliasSpecList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -519,6 +559,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 40:  aliasSpec ::= ERROR_KEY produces alias_rhs
             //
             case 40: {
+               if constexpr (probe) { *found = true; break; }
                //#line 100 "LPGParser.g"
                 setResult(
                     //#line 100 LPGParser.g
@@ -537,6 +578,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 41:  aliasSpec ::= EOL_KEY produces alias_rhs
             //
             case 41: {
+               if constexpr (probe) { *found = true; break; }
                //#line 101 "LPGParser.g"
                 setResult(
                     //#line 101 LPGParser.g
@@ -555,6 +597,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 42:  aliasSpec ::= EOF_KEY produces alias_rhs
             //
             case 42: {
+               if constexpr (probe) { *found = true; break; }
                //#line 102 "LPGParser.g"
                 setResult(
                     //#line 102 LPGParser.g
@@ -573,6 +616,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 43:  aliasSpec ::= IDENTIFIER_KEY produces alias_rhs
             //
             case 43: {
+               if constexpr (probe) { *found = true; break; }
                //#line 103 "LPGParser.g"
                 setResult(
                     //#line 103 LPGParser.g
@@ -591,6 +635,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 44:  aliasSpec ::= SYMBOL produces alias_rhs
             //
             case 44: {
+               if constexpr (probe) { *found = true; break; }
                //#line 104 "LPGParser.g"
                 setResult(
                     //#line 104 LPGParser.g
@@ -609,6 +654,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 45:  aliasSpec ::= alias_lhs_macro_name produces alias_rhs
             //
             case 45: {
+               if constexpr (probe) { *found = true; break; }
                //#line 105 "LPGParser.g"
                 setResult(
                     //#line 105 LPGParser.g
@@ -627,6 +673,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 46:  alias_lhs_macro_name ::= MACRO_NAME
             //
             case 46: {
+               if constexpr (probe) { *found = true; break; }
                //#line 107 "LPGParser.g"
                 setResult(
                     //#line 107 LPGParser.g
@@ -639,6 +686,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 47:  alias_rhs ::= SYMBOL
             //
             case 47: {
+               if constexpr (probe) { *found = true; break; }
                //#line 109 "LPGParser.g"
                 setResult(
                     //#line 109 LPGParser.g
@@ -651,6 +699,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 48:  alias_rhs ::= MACRO_NAME
             //
             case 48: {
+               if constexpr (probe) { *found = true; break; }
                //#line 110 "LPGParser.g"
                 setResult(
                     //#line 110 LPGParser.g
@@ -663,6 +712,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 49:  alias_rhs ::= ERROR_KEY
             //
             case 49: {
+               if constexpr (probe) { *found = true; break; }
                //#line 111 "LPGParser.g"
                 setResult(
                     //#line 111 LPGParser.g
@@ -675,6 +725,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 50:  alias_rhs ::= EOL_KEY
             //
             case 50: {
+               if constexpr (probe) { *found = true; break; }
                //#line 112 "LPGParser.g"
                 setResult(
                     //#line 112 LPGParser.g
@@ -687,6 +738,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 51:  alias_rhs ::= EOF_KEY
             //
             case 51: {
+               if constexpr (probe) { *found = true; break; }
                //#line 113 "LPGParser.g"
                 setResult(
                     //#line 113 LPGParser.g
@@ -699,6 +751,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 52:  alias_rhs ::= EMPTY_KEY
             //
             case 52: {
+               if constexpr (probe) { *found = true; break; }
                //#line 114 "LPGParser.g"
                 setResult(
                     //#line 114 LPGParser.g
@@ -711,6 +764,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 53:  alias_rhs ::= IDENTIFIER_KEY
             //
             case 53: {
+               if constexpr (probe) { *found = true; break; }
                //#line 115 "LPGParser.g"
                 setResult(
                     //#line 115 LPGParser.g
@@ -728,6 +782,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 55:  define_segment ::= defineSpec
             //
             case 55: {
+               if constexpr (probe) { *found = true; break; }
                //#line 121 "LPGParser.g"
                 setResult(
                     //#line 121 LPGParser.g
@@ -740,6 +795,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 56:  define_segment ::= define_segment defineSpec
             //
             case 56: {
+               if constexpr (probe) { *found = true; break; }
                //#line 121 "LPGParser.g"
                 ((defineSpecList*)getRhsSym(1))->addElement((defineSpec *)getRhsSym(2));
             break;
@@ -748,6 +804,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 57:  defineSpec ::= macro_name_symbol macro_segment
             //
             case 57: {
+               if constexpr (probe) { *found = true; break; }
                //#line 122 "LPGParser.g"
                 setResult(
                     //#line 122 LPGParser.g
@@ -764,6 +821,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 58:  macro_name_symbol ::= MACRO_NAME
             //
             case 58: {
+               if constexpr (probe) { *found = true; break; }
                //#line 130 "LPGParser.g"
                 setResult(
                     //#line 130 LPGParser.g
@@ -776,6 +834,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 59:  macro_name_symbol ::= SYMBOL
             //
             case 59: {
+               if constexpr (probe) { *found = true; break; }
                //#line 131 "LPGParser.g"
                 setResult(
                     //#line 131 LPGParser.g
@@ -788,6 +847,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 60:  macro_segment ::= BLOCK
             //
             case 60: {
+               if constexpr (probe) { *found = true; break; }
                //#line 132 "LPGParser.g"
                 setResult(
                     //#line 132 LPGParser.g
@@ -815,6 +875,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 64:  export_segment ::= terminal_symbol
             //
             case 64: {
+               if constexpr (probe) { *found = true; break; }
                //#line 142 "LPGParser.g"
                 setResult(
                     //#line 142 LPGParser.g
@@ -827,6 +888,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 65:  export_segment ::= export_segment terminal_symbol
             //
             case 65: {
+               if constexpr (probe) { *found = true; break; }
                //#line 142 "LPGParser.g"
                 ((terminal_symbolList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -835,6 +897,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 66:  globals_segment ::= action_segment
             //
             case 66: {
+               if constexpr (probe) { *found = true; break; }
                //#line 145 "LPGParser.g"
                 setResult(
                     //#line 145 LPGParser.g
@@ -847,6 +910,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 67:  globals_segment ::= globals_segment action_segment
             //
             case 67: {
+               if constexpr (probe) { *found = true; break; }
                //#line 145 "LPGParser.g"
                 ((action_segmentList*)getRhsSym(1))->addElement((action_segment *)getRhsSym(2));
             break;
@@ -865,6 +929,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 70:  import_segment ::= SYMBOL drop_command_list
             //
             case 70: {
+               if constexpr (probe) { *found = true; break; }
                //#line 154 "LPGParser.g"
                 setResult(
                     //#line 154 LPGParser.g
@@ -881,6 +946,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 71:  drop_command_list ::= $Empty
             //
             case 71: {
+               if constexpr (probe) { *found = true; break; }
                //#line 156 "LPGParser.g"
                 setResult(
                     //#line 156 LPGParser.g
@@ -893,6 +959,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 72:  drop_command_list ::= drop_command_list drop_command
             //
             case 72: {
+               if constexpr (probe) { *found = true; break; }
                //#line 156 "LPGParser.g"
                 ((drop_commandList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -901,6 +968,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 73:  drop_command ::= DROPSYMBOLS_KEY drop_symbols
             //
             case 73: {
+               if constexpr (probe) { *found = true; break; }
                //#line 158 "LPGParser.g"
                 setResult(
                     //#line 158 LPGParser.g
@@ -917,6 +985,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 74:  drop_command ::= DROPRULES_KEY drop_rules
             //
             case 74: {
+               if constexpr (probe) { *found = true; break; }
                //#line 159 "LPGParser.g"
                 setResult(
                     //#line 159 LPGParser.g
@@ -933,6 +1002,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 75:  drop_symbols ::= SYMBOL
             //
             case 75: {
+               if constexpr (probe) { *found = true; break; }
                //#line 161 "LPGParser.g"
                 setResult(
                     //#line 161 LPGParser.g
@@ -945,6 +1015,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 76:  drop_symbols ::= drop_symbols SYMBOL
             //
             case 76: {
+               if constexpr (probe) { *found = true; break; }
                //#line 162 "LPGParser.g"
                 ((SYMBOLList*)getRhsSym(1))->addElement( _automatic_ast_pool << new ASTNodeToken(getRhsIToken(2)));
             break;
@@ -953,6 +1024,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 77:  drop_rules ::= drop_rule
             //
             case 77: {
+               if constexpr (probe) { *found = true; break; }
                //#line 163 "LPGParser.g"
                 setResult(
                     //#line 163 LPGParser.g
@@ -965,6 +1037,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 78:  drop_rules ::= drop_rules drop_rule
             //
             case 78: {
+               if constexpr (probe) { *found = true; break; }
                //#line 164 "LPGParser.g"
                 ((drop_ruleList*)getRhsSym(1))->addElement((drop_rule *)getRhsSym(2));
             break;
@@ -973,6 +1046,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 79:  drop_rule ::= SYMBOL optMacroName produces ruleList
             //
             case 79: {
+               if constexpr (probe) { *found = true; break; }
                //#line 166 "LPGParser.g"
                 setResult(
                     //#line 166 LPGParser.g
@@ -993,6 +1067,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 80:  optMacroName ::= $Empty
             //
             case 80: {
+               if constexpr (probe) { *found = true; break; }
                //#line 168 "LPGParser.g"
                 setResult(nullptr);
             break;
@@ -1001,6 +1076,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 81:  optMacroName ::= MACRO_NAME
             //
             case 81: {
+               if constexpr (probe) { *found = true; break; }
                //#line 168 "LPGParser.g"
                 setResult(
                     //#line 168 LPGParser.g
@@ -1013,6 +1089,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 82:  include_segment ::= SYMBOL
             //
             case 82: {
+               if constexpr (probe) { *found = true; break; }
                //#line 171 "LPGParser.g"
                 setResult(
                     //#line 171 LPGParser.g
@@ -1025,6 +1102,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 83:  keywords_segment ::= keywordSpec
             //
             case 83: {
+               if constexpr (probe) { *found = true; break; }
                //#line 174 "LPGParser.g"
                 setResult(
                     //#line 174 LPGParser.g
@@ -1037,6 +1115,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 84:  keywords_segment ::= keywords_segment keywordSpec
             //
             case 84: {
+               if constexpr (probe) { *found = true; break; }
                //#line 174 "LPGParser.g"
                 ((keywordSpecList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -1050,6 +1129,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 86:  keywordSpec ::= terminal_symbol produces name
             //
             case 86: {
+               if constexpr (probe) { *found = true; break; }
                //#line 176 "LPGParser.g"
                 setResult(
                     //#line 176 LPGParser.g
@@ -1068,6 +1148,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 87:  names_segment ::= nameSpec
             //
             case 87: {
+               if constexpr (probe) { *found = true; break; }
                //#line 179 "LPGParser.g"
                 setResult(
                     //#line 179 LPGParser.g
@@ -1080,6 +1161,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 88:  names_segment ::= names_segment nameSpec
             //
             case 88: {
+               if constexpr (probe) { *found = true; break; }
                //#line 179 "LPGParser.g"
                 ((nameSpecList*)getRhsSym(1))->addElement((nameSpec *)getRhsSym(2));
             break;
@@ -1088,6 +1170,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 89:  nameSpec ::= name produces name
             //
             case 89: {
+               if constexpr (probe) { *found = true; break; }
                //#line 180 "LPGParser.g"
                 setResult(
                     //#line 180 LPGParser.g
@@ -1106,6 +1189,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 90:  name ::= SYMBOL
             //
             case 90: {
+               if constexpr (probe) { *found = true; break; }
                //#line 182 "LPGParser.g"
                 setResult(
                     //#line 182 LPGParser.g
@@ -1118,6 +1202,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 91:  name ::= MACRO_NAME
             //
             case 91: {
+               if constexpr (probe) { *found = true; break; }
                //#line 183 "LPGParser.g"
                 setResult(
                     //#line 183 LPGParser.g
@@ -1130,6 +1215,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 92:  name ::= EMPTY_KEY
             //
             case 92: {
+               if constexpr (probe) { *found = true; break; }
                //#line 184 "LPGParser.g"
                 setResult(
                     //#line 184 LPGParser.g
@@ -1142,6 +1228,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 93:  name ::= ERROR_KEY
             //
             case 93: {
+               if constexpr (probe) { *found = true; break; }
                //#line 185 "LPGParser.g"
                 setResult(
                     //#line 185 LPGParser.g
@@ -1154,6 +1241,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 94:  name ::= EOL_KEY
             //
             case 94: {
+               if constexpr (probe) { *found = true; break; }
                //#line 186 "LPGParser.g"
                 setResult(
                     //#line 186 LPGParser.g
@@ -1166,6 +1254,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 95:  name ::= IDENTIFIER_KEY
             //
             case 95: {
+               if constexpr (probe) { *found = true; break; }
                //#line 187 "LPGParser.g"
                 setResult(
                     //#line 187 LPGParser.g
@@ -1178,6 +1267,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 96:  notice_segment ::= action_segment
             //
             case 96: {
+               if constexpr (probe) { *found = true; break; }
                //#line 190 "LPGParser.g"
                 setResult(
                     //#line 190 LPGParser.g
@@ -1190,6 +1280,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 97:  notice_segment ::= notice_segment action_segment
             //
             case 97: {
+               if constexpr (probe) { *found = true; break; }
                //#line 190 "LPGParser.g"
                 ((action_segmentList*)getRhsSym(1))->addElement((action_segment *)getRhsSym(2));
             break;
@@ -1198,6 +1289,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 98:  rules_segment ::= action_segment_list nonTermList
             //
             case 98: {
+               if constexpr (probe) { *found = true; break; }
                //#line 193 "LPGParser.g"
                 setResult(
                     //#line 193 LPGParser.g
@@ -1214,6 +1306,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 99:  nonTermList ::= $Empty
             //
             case 99: {
+               if constexpr (probe) { *found = true; break; }
                //#line 195 "LPGParser.g"
                 setResult(
                     //#line 195 LPGParser.g
@@ -1226,6 +1319,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 100:  nonTermList ::= nonTermList nonTerm
             //
             case 100: {
+               if constexpr (probe) { *found = true; break; }
                //#line 195 "LPGParser.g"
                 ((nonTermList*)getRhsSym(1))->addElement((nonTerm *)getRhsSym(2));
             break;
@@ -1234,6 +1328,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 101:  nonTerm ::= ruleNameWithAttributes produces ruleList
             //
             case 101: {
+               if constexpr (probe) { *found = true; break; }
                //#line 197 "LPGParser.g"
                 setResult(
                     //#line 197 LPGParser.g
@@ -1252,6 +1347,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 102:  ruleNameWithAttributes ::= SYMBOL
             //
             case 102: {
+               if constexpr (probe) { *found = true; break; }
                //#line 205 "LPGParser.g"
                 setResult(
                     //#line 205 LPGParser.g
@@ -1270,6 +1366,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 103:  ruleNameWithAttributes ::= SYMBOL MACRO_NAME$className
             //
             case 103: {
+               if constexpr (probe) { *found = true; break; }
                //#line 206 "LPGParser.g"
                 setResult(
                     //#line 206 LPGParser.g
@@ -1288,6 +1385,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 104:  ruleNameWithAttributes ::= SYMBOL MACRO_NAME$className MACRO_NAME$arrayElement
             //
             case 104: {
+               if constexpr (probe) { *found = true; break; }
                //#line 207 "LPGParser.g"
                 setResult(
                     //#line 207 LPGParser.g
@@ -1306,6 +1404,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 105:  ruleList ::= rule
             //
             case 105: {
+               if constexpr (probe) { *found = true; break; }
                //#line 221 "LPGParser.g"
                 setResult(
                     //#line 221 LPGParser.g
@@ -1318,6 +1417,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 106:  ruleList ::= ruleList |$ rule
             //
             case 106: {
+               if constexpr (probe) { *found = true; break; }
                //#line 221 "LPGParser.g"
                 ((ruleList*)getRhsSym(1))->addElement((rule *)getRhsSym(3));
             break;
@@ -1326,6 +1426,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 107:  produces ::= ::=
             //
             case 107: {
+               if constexpr (probe) { *found = true; break; }
                //#line 223 "LPGParser.g"
                 setResult(
                     //#line 223 LPGParser.g
@@ -1338,6 +1439,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 108:  produces ::= ::=?
             //
             case 108: {
+               if constexpr (probe) { *found = true; break; }
                //#line 224 "LPGParser.g"
                 setResult(
                     //#line 224 LPGParser.g
@@ -1350,6 +1452,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 109:  produces ::= ->
             //
             case 109: {
+               if constexpr (probe) { *found = true; break; }
                //#line 225 "LPGParser.g"
                 setResult(
                     //#line 225 LPGParser.g
@@ -1362,6 +1465,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 110:  produces ::= ->?
             //
             case 110: {
+               if constexpr (probe) { *found = true; break; }
                //#line 226 "LPGParser.g"
                 setResult(
                     //#line 226 LPGParser.g
@@ -1374,6 +1478,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 111:  rule ::= symWithAttrsList action_segment_list
             //
             case 111: {
+               if constexpr (probe) { *found = true; break; }
                //#line 228 "LPGParser.g"
                 setResult(
                     //#line 228 LPGParser.g
@@ -1390,6 +1495,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 112:  symWithAttrsList ::= $Empty
             //
             case 112: {
+               if constexpr (probe) { *found = true; break; }
                //#line 230 "LPGParser.g"
                 setResult(
                     //#line 230 LPGParser.g
@@ -1402,6 +1508,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 113:  symWithAttrsList ::= symWithAttrsList symWithAttrs
             //
             case 113: {
+               if constexpr (probe) { *found = true; break; }
                //#line 230 "LPGParser.g"
                 ((symWithAttrsList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -1410,6 +1517,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 114:  symWithAttrs ::= EMPTY_KEY
             //
             case 114: {
+               if constexpr (probe) { *found = true; break; }
                //#line 232 "LPGParser.g"
                 setResult(
                     //#line 232 LPGParser.g
@@ -1422,6 +1530,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 115:  symWithAttrs ::= SYMBOL optAttrList
             //
             case 115: {
+               if constexpr (probe) { *found = true; break; }
                //#line 233 "LPGParser.g"
                 setResult(
                     //#line 233 LPGParser.g
@@ -1438,6 +1547,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 116:  optAttrList ::= $Empty
             //
             case 116: {
+               if constexpr (probe) { *found = true; break; }
                //#line 236 "LPGParser.g"
                 setResult(
                     //#line 236 LPGParser.g
@@ -1452,6 +1562,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 117:  optAttrList ::= MACRO_NAME
             //
             case 117: {
+               if constexpr (probe) { *found = true; break; }
                //#line 237 "LPGParser.g"
                 setResult(
                     //#line 237 LPGParser.g
@@ -1466,6 +1577,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 118:  opt_action_segment ::= $Empty
             //
             case 118: {
+               if constexpr (probe) { *found = true; break; }
                //#line 239 "LPGParser.g"
                 setResult(nullptr);
             break;
@@ -1479,6 +1591,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 120:  action_segment ::= BLOCK
             //
             case 120: {
+               if constexpr (probe) { *found = true; break; }
                //#line 241 "LPGParser.g"
                 setResult(
                     //#line 241 LPGParser.g
@@ -1491,6 +1604,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 121:  start_segment ::= start_symbol
             //
             case 121: {
+               if constexpr (probe) { *found = true; break; }
                //#line 246 "LPGParser.g"
                 setResult(
                     //#line 246 LPGParser.g
@@ -1503,6 +1617,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 122:  start_segment ::= start_segment start_symbol
             //
             case 122: {
+               if constexpr (probe) { *found = true; break; }
                //#line 246 "LPGParser.g"
                 ((start_symbolList*)getRhsSym(1))->addElement((ASTNode *)getRhsSym(2));
             break;
@@ -1511,6 +1626,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 123:  start_symbol ::= SYMBOL
             //
             case 123: {
+               if constexpr (probe) { *found = true; break; }
                //#line 247 "LPGParser.g"
                 setResult(
                     //#line 247 LPGParser.g
@@ -1523,6 +1639,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 124:  start_symbol ::= MACRO_NAME
             //
             case 124: {
+               if constexpr (probe) { *found = true; break; }
                //#line 248 "LPGParser.g"
                 setResult(
                     //#line 248 LPGParser.g
@@ -1535,6 +1652,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 125:  terminals_segment ::= terminal
             //
             case 125: {
+               if constexpr (probe) { *found = true; break; }
                //#line 251 "LPGParser.g"
                 setResult(
                     //#line 251 LPGParser.g
@@ -1547,6 +1665,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 126:  terminals_segment ::= terminals_segment terminal
             //
             case 126: {
+               if constexpr (probe) { *found = true; break; }
                //#line 251 "LPGParser.g"
                 ((terminalList*)getRhsSym(1))->addElement((terminal *)getRhsSym(2));
             break;
@@ -1555,6 +1674,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 127:  terminal ::= terminal_symbol optTerminalAlias
             //
             case 127: {
+               if constexpr (probe) { *found = true; break; }
                //#line 254 "LPGParser.g"
                 setResult(
                     //#line 254 LPGParser.g
@@ -1571,6 +1691,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 128:  optTerminalAlias ::= $Empty
             //
             case 128: {
+               if constexpr (probe) { *found = true; break; }
                //#line 260 "LPGParser.g"
                 setResult(nullptr);
             break;
@@ -1579,6 +1700,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 129:  optTerminalAlias ::= produces name
             //
             case 129: {
+               if constexpr (probe) { *found = true; break; }
                //#line 260 "LPGParser.g"
                 setResult(
                     //#line 260 LPGParser.g
@@ -1595,6 +1717,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 130:  terminal_symbol ::= SYMBOL
             //
             case 130: {
+               if constexpr (probe) { *found = true; break; }
                //#line 262 "LPGParser.g"
                 setResult(
                     //#line 262 LPGParser.g
@@ -1607,6 +1730,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 131:  terminal_symbol ::= MACRO_NAME
             //
             case 131: {
+               if constexpr (probe) { *found = true; break; }
                //#line 268 "LPGParser.g"
                 setResult(
                     //#line 268 LPGParser.g
@@ -1624,6 +1748,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 133:  types_segment ::= type_declarations
             //
             case 133: {
+               if constexpr (probe) { *found = true; break; }
                //#line 274 "LPGParser.g"
                 setResult(
                     //#line 274 LPGParser.g
@@ -1636,6 +1761,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 134:  types_segment ::= types_segment type_declarations
             //
             case 134: {
+               if constexpr (probe) { *found = true; break; }
                //#line 274 "LPGParser.g"
                 ((type_declarationsList*)getRhsSym(1))->addElement((type_declarations *)getRhsSym(2));
             break;
@@ -1644,6 +1770,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 135:  type_declarations ::= SYMBOL produces barSymbolList opt_action_segment
             //
             case 135: {
+               if constexpr (probe) { *found = true; break; }
                //#line 276 "LPGParser.g"
                 setResult(
                     //#line 276 LPGParser.g
@@ -1664,6 +1791,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 136:  barSymbolList ::= SYMBOL
             //
             case 136: {
+               if constexpr (probe) { *found = true; break; }
                //#line 277 "LPGParser.g"
                 setResult(
                     //#line 277 LPGParser.g
@@ -1676,6 +1804,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 137:  barSymbolList ::= barSymbolList |$ SYMBOL
             //
             case 137: {
+               if constexpr (probe) { *found = true; break; }
                //#line 277 "LPGParser.g"
                 ((SYMBOLList*)getRhsSym(1))->addElement( _automatic_ast_pool << new ASTNodeToken(getRhsIToken(3)));
             break;
@@ -1684,6 +1813,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 138:  predecessor_segment ::= $Empty
             //
             case 138: {
+               if constexpr (probe) { *found = true; break; }
                //#line 280 "LPGParser.g"
                 setResult(
                     //#line 280 LPGParser.g
@@ -1696,6 +1826,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 139:  predecessor_segment ::= predecessor_segment symbol_pair
             //
             case 139: {
+               if constexpr (probe) { *found = true; break; }
                //#line 280 "LPGParser.g"
                 ((symbol_pairList*)getRhsSym(1))->addElement((symbol_pair *)getRhsSym(2));
             break;
@@ -1704,6 +1835,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 140:  symbol_pair ::= SYMBOL SYMBOL
             //
             case 140: {
+               if constexpr (probe) { *found = true; break; }
                //#line 282 "LPGParser.g"
                 setResult(
                     //#line 282 LPGParser.g
@@ -1720,6 +1852,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 141:  recover_segment ::= $Empty
             //
             case 141: {
+               if constexpr (probe) { *found = true; break; }
                //#line 285 "LPGParser.g"
                 setResult(
                     //#line 285 LPGParser.g
@@ -1732,6 +1865,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 142:  recover_segment ::= recover_segment recover_symbol
             //
             case 142: {
+               if constexpr (probe) { *found = true; break; }
                //#line 285 "LPGParser.g"
                 setResult((SYMBOLList*)getRhsSym(1));
             break;
@@ -1740,6 +1874,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 143:  recover_symbol ::= SYMBOL
             //
             case 143: {
+               if constexpr (probe) { *found = true; break; }
                //#line 287 "LPGParser.g"
                 setResult(
                     //#line 287 LPGParser.g
@@ -1752,6 +1887,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 144:  END_KEY_OPT ::= $Empty
             //
             case 144: {
+               if constexpr (probe) { *found = true; break; }
                //#line 294 "LPGParser.g"
                 setResult(nullptr);
             break;
@@ -1760,6 +1896,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 145:  END_KEY_OPT ::= END_KEY
             //
             case 145: {
+               if constexpr (probe) { *found = true; break; }
                //#line 295 "LPGParser.g"
                 setResult(
                     //#line 295 LPGParser.g
@@ -1772,6 +1909,7 @@ using namespace LPGParser_top_level_ast;
             // Rule 146:  action_segment_list ::= $Empty
             //
             case 146: {
+               if constexpr (probe) { *found = true; break; }
                //#line 297 "LPGParser.g"
                 setResult(
                     //#line 297 LPGParser.g
@@ -1784,11 +1922,12 @@ using namespace LPGParser_top_level_ast;
             // Rule 147:  action_segment_list ::= action_segment_list action_segment
             //
             case 147: {
+               if constexpr (probe) { *found = true; break; }
                //#line 298 "LPGParser.g"
                 ((action_segmentList*)getRhsSym(1))->addElement((action_segment *)getRhsSym(2));
             break;
             }
-    //#line 368 "btParserTemplateF.gi
+    //#line 393 "btParserTemplateF.gi
 
     
             default:
@@ -1797,3 +1936,13 @@ using namespace LPGParser_top_level_ast;
         return;
     }
 
+     void LPGParser::ruleAction(int ruleNumber)
+    {
+        ruleAction<false>(ruleNumber, nullptr);
+    }
+
+     const unsigned char* LPGParser::getRuleActionMap()
+    {
+        static const std::vector<unsigned char> map = findRuleActions(this, LPGParserprs::NUM_RULES);
+        return map.data();
+    }
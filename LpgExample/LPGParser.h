@@ -1,15 +1,16 @@
 
-    //#line 163 "btParserTemplateF.gi
+    //#line 180 "btParserTemplateF.gi
 
 #pragma once
 
 #include <iostream>
 #include "AstPoolHolder.h"
-#include "BacktrackingParser.h"
+#include "BacktrackingParserT.h"
 #include "DeterministicParser.h"
 #include "diagnose.h"
 #include "ErrorToken.h"
 #include "Exception.h"
+#include "GeneratedParseTable.h"
 #include "IAbstractArrayList.h"
 #include "IAst.h"
 #include "IAstVisitor.h"
@@ -37,7 +38,7 @@ namespace LPGParser_top_level_ast {
 }
 
  
-    //#line 190 "btParserTemplateF.gi
+    //#line 208 "btParserTemplateF.gi
 
  struct LPGParser :public Object ,public RuleAction
 {
@@ -49,7 +50,7 @@ namespace LPGParser_top_level_ast {
     }
      bool unimplementedSymbolsWarning = false;
 
-     inline static ParseTable* prsTable = new LPGParserprs();
+     inline static ParseTable* prsTable = new GeneratedParseTable<LPGParserprs>();
      ParseTable* getParseTable() { return prsTable; }
 
      BacktrackingParser* btParser = nullptr;
@@ -125,7 +126,7 @@ namespace LPGParser_top_level_ast {
     {
         try
         {
-            btParser = new BacktrackingParser(prsStream, prsTable,  this);
+            btParser = new BacktrackingParserT<LPGParserprs, LPGParser>(prsStream, prsTable,  this);
         }
         catch (NotBacktrackParseTableException& e)
         {
@@ -198,7 +199,14 @@ namespace LPGParser_top_level_ast {
 
         return nullptr;
     }
+     //
+     // The actions of the rules, or, with probe, whether a rule has one
+     // (see findRuleActions).
+     //
+     template <bool probe>
+     void ruleAction(int ruleNumber, bool* found);
      void ruleAction(int ruleNumber);
+     const unsigned char* getRuleActionMap();
     //
     // Additional entry points, if any
     //
@@ -215,7 +223,7 @@ std::unordered_multimap<std::wstring, LPGParser_top_level_ast::nonTerm*>  _non_t
 std::unordered_multimap<std::wstring, LPGParser_top_level_ast::terminal*>  _terms;
 std::vector<LPGParser_top_level_ast::ASTNodeToken*>  _macro_name_symbo;
  
-    //#line 364 "btParserTemplateF.gi
+    //#line 389 "btParserTemplateF.gi
 
 };
 
@@ -1,14 +1,41 @@
 ﻿// LpgExample.cpp : 此文件包含 "main" 函数。程序执行将在此处开始并结束。
 //
 
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <string>
 
+#include "DirectCodeGenerator.h"
+#include "GeneratedParseTable.h"
 #include "LPGLexer.h"
 #include "LPGParser.h"
 #include "LPGParser_top_level_ast.h"
 using namespace  LPGParser_top_level_ast;
-int main()
+//
+// LpgExample -direct <directory>
+//
+// Write LPGLexerdirect.h, the terminal actions of the lexer coded as
+// switch blocks (see DirectCodeGenerator), to directory. Run it again
+// whenever LPGLexerprs.h is regenerated.
+//
+static int writeDirectCode(const std::string& directory)
 {
+    std::ofstream out(directory + "/LPGLexerdirect.h");
+    GeneratedParseTable<LPGLexerprs> table;
+    if (!out || !DirectCodeGenerator::generate(&table, "LPGLexerprs", "LPGLexerdirect", out))
+    {
+        std::cout << "Cannot write " << directory << "/LPGLexerdirect.h" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 2 && strcmp(argv[1], "-direct") == 0)
+        return writeDirectCode(argv[2]);
+
 	LPGLexer lexer; // Create the lexer
 	lexer.reset(LR"(E:\LPG2\lpg2\src\jikespg.g)", 8);
 	//lexer.reset(LR"(C:\Users\kuafu\source\repos\lpgRuntimeCpp\LpgExample\LpgExample.cpp)", 4);
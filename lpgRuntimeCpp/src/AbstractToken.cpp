@@ -7,6 +7,7 @@
 
 #include "Adjunct.h"
 #include "LexStream.h"
+#include "PrsStream.h"
 
 AbstractToken::AbstractToken(IPrsStream* iPrsStream, int startOffset, int endOffset, int kind)
 {
@@ -16,6 +17,16 @@ AbstractToken::AbstractToken(IPrsStream* iPrsStream, int startOffset, int endOff
 	this->kind = kind;
 }
 
+//
+// A token of a PrsStream has an entry in its TokenStore, to be kept up to
+// date when its kind or its offsets are set.
+//
+void AbstractToken::updateStore()
+{
+	if (store != nullptr)
+		store->updateToken(this);
+}
+
 int AbstractToken::getKind()
 {
 	return kind;
@@ -24,6 +35,7 @@ int AbstractToken::getKind()
 void AbstractToken::setKind(int kind)
 {
 	this->kind = kind;
+	updateStore();
 }
 
 int AbstractToken::getStartOffset()
@@ -34,6 +46,7 @@ int AbstractToken::getStartOffset()
 void AbstractToken::setStartOffset(int start_offset)
 {
 	this->startOffset = start_offset;
+	updateStore();
 }
 
 int AbstractToken::getEndOffset()
@@ -44,6 +57,7 @@ int AbstractToken::getEndOffset()
 void AbstractToken::setEndOffset(int endOffset)
 {
 	this->endOffset = endOffset;
+	updateStore();
 }
 
 int AbstractToken::getTokenIndex()
@@ -1,5 +1,6 @@
 #pragma once
 #include "IToken.h"
+struct PrsStream;
 struct AbstractToken :
   public   IToken
 {
@@ -8,7 +9,9 @@ struct AbstractToken :
         endOffset = 0,
         tokenIndex = 0,
         adjunctIndex = 0;
+     bool pooled = false; // allocated in the token pool of a PrsStream, not with new
      IPrsStream* iPrsStream = nullptr;
+     PrsStream* store = nullptr; // the PrsStream whose TokenStore has the token, set when it is added
 
      AbstractToken() {}
       AbstractToken(IPrsStream* iPrsStream, int startOffset, int endOffset, int kind);
@@ -36,5 +39,8 @@ struct AbstractToken :
       int getEndColumn();
 
       std::wstring toString();
+
+private:
+      void updateStore();
 };
 
@@ -8,5 +8,7 @@ struct
     Adjunct(IPrsStream* prsStream, int startOffset, int endOffset, int kind);
     std::vector<IToken*> getFollowingAdjuncts();
     std::vector<IToken*> getPrecedingAdjuncts();
+    AdjunctRange getFollowingAdjunctRange() { return {}; }
+    AdjunctRange getPrecedingAdjunctRange() { return {}; }
 };
 
@@ -0,0 +1,107 @@
+#pragma once
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "tuple.h"
+
+struct IToken;
+
+//
+// The adjuncts first..last-1 of a PrsStream (the comments that follow a
+// token, say), seen in place in the tuple of adjuncts of the stream:
+//
+//     for (IToken* comment : token->getPrecedingAdjunctRange())
+//         ...
+//
+// Nothing is allocated or copied. The range is only valid while the
+// adjuncts of the stream stay as they are: until the stream is reset, or
+// relexed from before last.
+//
+// A token or stream that only has the vector functions gets a range over a
+// copy of its adjuncts (see copyOf), which the range keeps alive.
+//
+struct AdjunctRange
+{
+    Tuple<IToken*>* adjuncts = nullptr;
+    int first = 0,
+        last = 0;
+
+    AdjunctRange() {}
+
+    AdjunctRange(Tuple<IToken*>* adjuncts, int first, int last) : adjuncts(adjuncts), first(first), last(last) {}
+
+    static AdjunctRange copyOf(const std::vector<IToken*>& slice)
+    {
+        AdjunctRange range;
+        if (!slice.empty())
+        {
+            range.copy = std::make_shared<Tuple<IToken*>>(static_cast<unsigned>(slice.size()));
+            for (IToken* adjunct : slice)
+                range.copy->add(adjunct);
+            range.adjuncts = range.copy.get();
+            range.last = static_cast<int>(slice.size());
+        }
+        return range;
+    }
+
+    struct iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = IToken*;
+        using difference_type = int;
+        using pointer = IToken**;
+        using reference = IToken*&;
+
+        Tuple<IToken*>* adjuncts;
+        int index;
+
+        IToken* operator*() const { return (*adjuncts)[index]; }
+
+        iterator& operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            index++;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const { return index == other.index; }
+
+        bool operator!=(const iterator& other) const { return index != other.index; }
+    };
+
+    iterator begin() const { return { adjuncts, first }; }
+
+    iterator end() const { return { adjuncts, last }; }
+
+    int size() const { return last - first; }
+
+    bool empty() const { return last <= first; }
+
+    IToken* operator[](int i) const { return (*adjuncts)[first + i]; }
+
+    //
+    // A copy of the adjuncts, for the functions that return them in a
+    // vector.
+    //
+    std::vector<IToken*> toVector() const
+    {
+        std::vector<IToken*> slice;
+        if (!empty())
+        {
+            slice.reserve(size());
+            for (IToken* adjunct : *this)
+                slice.push_back(adjunct);
+        }
+        return slice;
+    }
+
+private:
+    std::shared_ptr<Tuple<IToken*>> copy;
+};
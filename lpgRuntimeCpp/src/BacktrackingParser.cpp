@@ -1,17 +1,34 @@
 #include "BacktrackingParser.h"
 
+#include <climits>
+
+#include "BacktrackingParserT.h"
 #include "ConfigurationElement.h"
 #include "ConfigurationStack.h"
 #include "ErrorToken.h"
 #include "Exception.h"
+#include "ILexStream.h"
 #include "IPrsStream.h"
 #include "IToken.h"
 #include "Monitor.h"
 #include "ParseErrorCodes.h"
 #include "ParseTable.h"
+#include "PrsStream.h"
 #include "RecoveryParser.h"
 #include "RuleAction.h"
 
+//
+// The size to expect of the tuple tokens: the length of the stream or,
+// while its tokens are lexed on demand, of its input, as no token is
+// shorter than a character.
+//
+unsigned BacktrackingParser::estimateTokens()
+{
+	if (prsStream != nullptr && prsStream->tokenSource != nullptr && prsStream->getILexStream() != nullptr)
+		return prsStream->getILexStream()->getStreamLength() + 2;
+	return tokStream->getStreamLength();
+}
+
 int BacktrackingParser::getMarkerToken(int marker_kind, int start_token_index)
 {
 	if (marker_kind == 0)
@@ -39,7 +56,7 @@ int BacktrackingParser::getMarkerToken(int marker_kind, int start_token_index)
 
 int BacktrackingParser::getToken(int i)
 {
-	return tokens->get(locationStack[stateStackTop + (i - 1)]);
+	return tokens->get(frameLocation(stateStackTop + (i - 1)));
 }
 
 int BacktrackingParser::getCurrentRule()
@@ -66,7 +83,7 @@ int BacktrackingParser::getLastToken(int i)
 {
 	int l = (i >= prs->rhs(currentAction)
 		         ? lastToken
-		         : tokens->get(locationStack[stateStackTop + i] - 1));
+		         : tokens->get(frameLocation(stateStackTop + i) - 1));
 	return tokStream->getLastRealToken(l);
 }
 
@@ -86,6 +103,7 @@ void BacktrackingParser::reset(Monitor* monitor, TokenStream* tokStream)
 {
 	this->monitor = monitor;
 	this->tokStream = tokStream;
+	this->prsStream = dynamic_cast<PrsStream*>(tokStream);
 	reset();
 }
 
@@ -105,6 +123,9 @@ void BacktrackingParser::reset(Monitor* monitor, TokenStream* tokStream, ParseTa
 	ERROR_SYMBOL = prs->getErrorSymbol();
 	ACCEPT_ACTION = prs->getAcceptAction();
 	ERROR_ACTION = prs->getErrorAction();
+	laCache.reset(prs->getMaxLa() > 1);
+	unitReductions.reset(this->prs, ra != nullptr ? ra->getRuleActionMap() : nullptr);
+	trialUnitReductions.reset(this->prs, nullptr, true);
 
 	if (!prs->isValidForParser()) throw BadParseSymFileException();
 	if (!prs->getBacktrack()) throw NotBacktrackParseTableException();
@@ -170,7 +191,6 @@ void BacktrackingParser::reallocateOtherStacks(int start_token_index)
 	{
 		this->actionStack.Resize(Stacks::stateStack.Size());
 		Stacks::locationStack.Resize(Stacks::stateStack.Size());
-		Stacks::parseStack.Resize(Stacks::stateStack.Size());
 
 		actionStack[0] = 0;
 		locationStack[0] = start_token_index;
@@ -179,7 +199,6 @@ void BacktrackingParser::reallocateOtherStacks(int start_token_index)
 	{
 		this->actionStack.Resize(Stacks::stateStack.Size());
 		Stacks::locationStack.Resize(Stacks::stateStack.Size());
-		Stacks::parseStack.Resize(Stacks::stateStack.Size());
 	}
 	return;
 }
@@ -268,7 +287,7 @@ Object* BacktrackingParser::fuzzyParseEntry(int marker_kind, int max_error_count
 	int first_token = tokStream->peek(),
 	    start_token = first_token,
 	    marker_token = getMarkerToken(marker_kind, first_token);
-	tokens = std::make_shared<IntTuple>(tokStream->getStreamLength());
+	tokens = std::make_shared<IntTuple>(estimateTokens());
 	tokens->add(tokStream->getPrevious(first_token));
 
 	int error_token = backtrackParse(action, marker_token);
@@ -320,6 +339,29 @@ Object* BacktrackingParser::parseEntry(int marker_kind)
 	return parseEntry(marker_kind, 0);
 }
 
+int BacktrackingParser::recognizeEntry(int marker_kind)
+{
+	action->reset();
+	tokStream->reset(); // Position at first token.
+	reallocateStateStack();
+	stateStackTop = 0;
+	stateStack[0] = START_STATE;
+
+	//
+	// The actions are still recorded: backtracking restores the action
+	// list of a configuration when it abandons a path.
+	//
+	int error_token = backtrackParse(action, getMarkerToken(marker_kind, tokStream->peek()));
+
+	//
+	// backtrackParse also returns 0 when the monitor cancels it, which
+	// would read as accepted here.
+	//
+	if (monitor != nullptr && monitor->isCancelled())
+		return tokStream->getPrevious(tokStream->peek());
+	return error_token;
+}
+
 Object* BacktrackingParser::parseEntry(int marker_kind, int max_error_count)
 {
 	action->reset();
@@ -341,7 +383,7 @@ Object* BacktrackingParser::parseEntry(int marker_kind, int max_error_count)
 	// it up to the "Stream" implementer to define the predecessor
 	// of the first token as he sees fit.
 	//
-	tokens = std::make_shared<IntTuple>(tokStream->getStreamLength());
+	tokens = std::make_shared<IntTuple>(estimateTokens());
 	tokens->add(tokStream->getPrevious(tokStream->peek()));
 
 	int start_token_index = tokStream->peek(),
@@ -403,86 +445,17 @@ Object* BacktrackingParser::parseEntry(int marker_kind, int max_error_count)
 
 void BacktrackingParser::process_reductions()
 {
-	do
-	{
-		stateStackTop -= (prs->rhs(currentAction) - 1);
-		ra->ruleAction(currentAction);
-		currentAction = prs->ntAction(stateStack[stateStackTop], prs->lhs(currentAction));
-		//if(currentAction <= NUM_RULES)
-		//System.err.println("Goto-reducing by rule " + currentAction);              
-	}
-	while (currentAction <= NUM_RULES);
-	//System.err.println("Goto state " + prs->originalState(currentAction));
-	return;
+	processReductionsWith(*prs, ra);
 }
 
 Object* BacktrackingParser::parseActions(int marker_kind)
 {
-	int ti = -1,
-	    curtok;
-	lastToken = tokens->get(++ti);
-	curtok = tokens->get(++ti);
-	allocateOtherStacks();
-
-	//
-	// Reparse the input...
-	//
-	stateStackTop = -1;
-	currentAction = START_STATE;
-
-	for (int i = 0; i < action->size(); i++)
-	{
-		//
-		// if the parser needs to stop processing, it may do so here.
-		//
-		if (monitor != nullptr && monitor->isCancelled())
-			return nullptr;
-
-		stateStack[++stateStackTop] = currentAction;
-		locationStack[stateStackTop] = ti;
-
-		currentAction = action->get(i);
-		if (currentAction <= NUM_RULES) // a reduce action?
-		{
-			//System.err.println("reducing by rule " + currentAction);              
-			stateStackTop--; // make reduction look like shift-reduction
-			process_reductions();
-		}
-		else // a shift or shift-reduce action
-		{
-			if (tokStream->getKind(curtok) > NT_OFFSET)
-			{
-				auto badtok = (ErrorToken*)((IPrsStream*)tokStream)->getIToken(curtok);
-				throw BadParseException(badtok->getErrorToken()->getTokenIndex());
-				// parseStack[stateStackTop] = ra->prostheticAst[prs->getProsthesisIndex(tokStream->getKind(curtok))].create(tokStream->getIToken(curtok));
-			}
-			lastToken = curtok;
-			curtok = tokens->get(++ti);
-			if (currentAction > ERROR_ACTION) // a shift-reduce action?
-			{
-				currentAction -= ERROR_ACTION;
-				//System.err.println("Shift-reducing by rule " + currentAction + " on token " + tokStream->getName(lastToken));              
-				process_reductions();
-			}
-			//else System.err.println("Shifting on token " + tokStream->getName(lastToken) + " to state " + prs->originalState(currentAction));              
-		}
-	}
-
-	return parseStack[marker_kind == 0 ? 0 : 1];
+	return parseActionsWith(*prs, ra, marker_kind);
 }
 
 int BacktrackingParser::process_backtrack_reductions(int act)
 {
-	do
-	{
-		stateStackTop -= (prs->rhs(act) - 1);
-		act = prs->ntAction(stateStack[stateStackTop], prs->lhs(act));
-		//if(act <= NUM_RULES)
-		//System.err.println("*Goto-reducing by rule " + act);
-	}
-	while (act <= NUM_RULES);
-	//System.err.println("*Goto state " + prs->originalState(act));
-	return act;
+	return processBacktrackReductionsWith(*prs, act);
 }
 
 int BacktrackingParser::backtrackParse(Array<int>& stack_arg, int stack_top, IntSegmentedTuple* action_arg, int initial_token)
@@ -499,124 +472,7 @@ int BacktrackingParser::backtrackParse(Array<int>& stack_arg, int stack_top, Int
 
 int BacktrackingParser::backtrackParse(IntSegmentedTuple* action_arg, int initial_token)
 {
-	//
-	// Allocate configuration stack.
-	//
-	ConfigurationStack configuration_stack(prs);
-
-	//
-	// Keep parsing until we successfully reach the end of file or
-	// an error is encountered. The list of actions executed will
-	// be stored in the "action" tuple.
-	//
-	int error_token = 0,
-	    maxStackTop = stateStackTop,
-	    start_token = tokStream->peek(),
-	    curtok = (initial_token > 0 ? initial_token : tokStream->getToken()),
-	    current_kind = tokStream->getKind(curtok),
-	    act = tAction(stateStack[stateStackTop], current_kind);
-
-	//
-	// The main driver loop
-	//
-	for (;;)
-	{
-		//
-		// if the parser needs to stop processing,
-		// it may do so here.
-		//
-		if (monitor != nullptr && monitor->isCancelled())
-			return 0;
-
-		if (act <= NUM_RULES)
-		{
-			//System.err.println("*reducing by rule " + act);              
-			action_arg->add(act); // save this reduce action
-			stateStackTop--;
-			act = process_backtrack_reductions(act);
-		}
-		else if (act > ERROR_ACTION)
-		{
-			//System.err.println("*Shift-reducing by rule " + (act - ERROR_ACTION) + " on token " + tokStream->getName(curtok));
-			action_arg->add(act); // save this shift-reduce action
-			curtok = tokStream->getToken();
-			current_kind = tokStream->getKind(curtok);
-			act = process_backtrack_reductions(act - ERROR_ACTION);
-		}
-		else if (act < ACCEPT_ACTION)
-		{
-			//System.err.println("*Shifting on token " + tokStream->getName(curtok) + " to state " + prs->originalState(act));
-			action_arg->add(act); // save this shift action
-			curtok = tokStream->getToken();
-			current_kind = tokStream->getKind(curtok);
-		}
-		else if (act == ERROR_ACTION)
-		{
-			error_token = (error_token > curtok ? error_token : curtok);
-
-			auto configuration = configuration_stack.pop();
-			if (configuration == nullptr)
-				act = ERROR_ACTION;
-			else
-			{
-				action_arg->reset(configuration->action_length);
-				act = configuration->act;
-				curtok = configuration->curtok;
-				current_kind = tokStream->getKind(curtok);
-				tokStream->reset(curtok == initial_token
-					                 ? start_token
-					                 : tokStream->getNext(curtok));
-				stateStackTop = configuration->stack_top;
-				configuration->retrieveStack(stateStack);
-				//System.err.println("*Backtracking to state " + prs->originalState(stateStack[stateStackTop]) + " back on token (" + curtok + ") " + tokStream->getName(curtok));
-				continue;
-			}
-			break;
-		}
-		else if (act > ACCEPT_ACTION)
-		{
-			if (configuration_stack.findConfiguration(stateStack, stateStackTop, curtok))
-				act = ERROR_ACTION;
-			else
-			{
-				configuration_stack.push(stateStack, stateStackTop, act + 1, curtok, action_arg->size());
-				act = prs->baseAction(act);
-				maxStackTop = stateStackTop > maxStackTop ? stateStackTop : maxStackTop;
-			}
-			continue;
-		}
-		else break; // assert(act == ACCEPT_ACTION);
-		try
-		{
-			stateStack.at(++stateStackTop) = act;
-		}
-		catch (std::out_of_range&)
-		{
-			reallocateStateStack();
-			stateStack[stateStackTop] = act;
-		}
-
-		act = tAction(act, current_kind);
-	}
-
-	// System.out.println("****Max Number of configurations: " + configuration_stack.maxConfigurationSize());
-	// for (ConfigurationElement configuration = configuration_stack.pop();
-	//      configuration != nullptr;
-	//      configuration = configuration_stack.pop())
-	//        {
-	//System.out.println("    restart at position " + configuration->action_length +
-	//                   " on action " + configuration->act +
-	//                   " and token " + configuration->curtok +
-	//                   " with kind " + tokStream->getKind(configuration->curtok)
-	//                  );   
-	//        }
-	//
-	// System.out.println("****Number of elements in stack tree: " + configuration_stack.numStateElements());
-	// System.out.println("****Number of elements in stacks: " + configuration_stack.stacksSize());
-	// System.out.println("****Number of actions: " + action->size());
-	// System.out.println("****Max Stack Size = " + maxStackTop);
-	// System.out.flush();
-	return (act == ERROR_ACTION ? error_token : 0);
+	return backtrackParseWith(*prs, action_arg, initial_token);
 }
 
 void BacktrackingParser::backtrackParseUpToError(int initial_token, int error_token)
@@ -731,10 +587,14 @@ bool BacktrackingParser::repairable(int error_token)
 	//
 	// Keep parsing until we successfully reach the end of file or
 	// an error is encountered. The list of actions executed will
-	// be stored in the "action" tuple.
+	// be stored in the "action" tuple. final_token starts out
+	// unreachable: not the length of the stream, which grows as the
+	// stream is read when its tokens are lexed on demand (see
+	// PrsStream::tokenSource).
 	//
+	const int unreachable = INT_MAX;
 	int start_token = tokStream->peek(),
-	    final_token = tokStream->getStreamLength(), // unreachable
+	    final_token = unreachable,
 	    curtok = 0,
 	    current_kind = ERROR_SYMBOL,
 	    act = tAction(stateStack[stateStackTop], current_kind);
@@ -804,7 +664,7 @@ bool BacktrackingParser::repairable(int error_token)
 			// tokens to reach another potential recovery point past the
 			// original error token.
 			//
-			if ((curtok > error_token) && (final_token == tokStream->getStreamLength()))
+			if ((curtok > error_token) && (final_token == unreachable))
 			{
 				//
 				// If the ERROR_SYMBOL is a valid Action Adjunct in the state
@@ -918,18 +778,12 @@ int BacktrackingParser::errorRepair(IPrsStream* stream, int recovery_token, int
 
 int BacktrackingParser::lookahead(int act, int token)
 {
-	act = prs->lookAhead(act - LA_STATE_OFFSET, tokStream->getKind(token));
-	return (act > LA_STATE_OFFSET
-		        ? lookahead(act, tokStream->getNext(token))
-		        : act);
+	return lookaheadWith(*prs, act, token);
 }
 
 int BacktrackingParser::tAction(int act, int sym)
 {
-	act = prs->tAction(act, sym);
-	return (act > LA_STATE_OFFSET
-		        ? lookahead(act, tokStream->peek())
-		        : act);
+	return tActionWith(*prs, act, sym);
 }
 void BacktrackingParser::reset(TokenStream* tokStream)
 {
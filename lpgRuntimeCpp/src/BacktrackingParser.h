@@ -1,6 +1,9 @@
 #pragma once
 #include "ObjectTuple.h"
+#include "LookaheadCache.h"
+#include "PrsStream.h"
 #include "Stacks.h"
+#include "UnitReductions.h"
 
 class ParseTableProxy;
 struct IPrsStream;
@@ -26,6 +29,18 @@ BacktrackingParser :
     int lastToken,
         currentAction;
     TokenStream* tokStream = nullptr;
+
+    //
+    // tokStream, if it is a PrsStream, whose getKind the driver loops then
+    // call without a virtual call; otherwise nullptr.
+    //
+    PrsStream* prsStream = nullptr;
+
+    int kindOf(int token)
+    {
+        return prsStream != nullptr ? prsStream->getKind(token) : tokStream->getKind(token);
+    }
+
     ParseTableProxy* prs = nullptr;
     RuleAction* ra = nullptr;
     IntSegmentedTuple* action = new IntSegmentedTuple(10, 1024); // IntTuple(1 << 20),
@@ -41,6 +56,8 @@ BacktrackingParser :
     int markerTokenIndex = 0;
     int getMarkerToken(int marker_kind, int start_token_index);
 
+    unsigned estimateTokens();
+
     //
     // Override the getToken function in Stacks.
     //
@@ -69,7 +86,7 @@ BacktrackingParser :
     {
         reset(nullptr, tokStream, prs, ra);
     }
-    ~BacktrackingParser();
+    virtual ~BacktrackingParser();
     BacktrackingParser();
 
     BacktrackingParser(TokenStream* tokStream, ParseTable* prs, RuleAction* ra);
@@ -148,6 +165,21 @@ BacktrackingParser :
     //
     Object* parseEntry(int marker_kind, int max_error_count);
 
+    //
+    // Recognition only: run the backtracking automaton on the input, without
+    // calling the rule actions and without the final replay of the actions
+    // (parseActions) or any error recovery. Returns 0 if the input is
+    // accepted; otherwise, the token on which the error was detected (see
+    // backtrackParse), or the current token if the monitor cancelled the
+    // parse, as DeterministicParser::recognize does.
+    //
+    int recognize()
+    {
+        return recognizeEntry(0);
+    }
+
+    virtual int recognizeEntry(int marker_kind);
+
     //
     // Process reductions and continue...
     //
@@ -157,7 +189,7 @@ BacktrackingParser :
     // Now do the final parse of the input based on the actions in
     // the list "action" and the sequence of tokens in list "tokens".
     //
-    Object* parseActions(int marker_kind);
+    virtual Object* parseActions(int marker_kind);
 
     //
     // Process reductions and continue...
@@ -179,7 +211,7 @@ BacktrackingParser :
     // the parse was succesful, then the tuple "action" contains the
     // successful sequence of actions that was executed.
     //
-    int backtrackParse(IntSegmentedTuple* action_arg, int initial_token);
+    virtual int backtrackParse(IntSegmentedTuple* action_arg, int initial_token);
 
     void backtrackParseUpToError(int initial_token, int error_token);
 
@@ -191,6 +223,18 @@ BacktrackingParser :
 
     int errorRepair(IPrsStream* stream, int recovery_token, int error_token);
 
+    //
+    // Lookahead resolutions already computed for this parse table.
+    //
+    LookaheadCache laCache;
+
+    //
+    // Chains of unit reductions skipped by process_reductions (those
+    // without action) and by process_backtrack_reductions (all of them).
+    //
+    UnitReductions unitReductions;
+    UnitReductions trialUnitReductions;
+
     //
     // keep looking ahead until we compute a valid action
     //
@@ -203,6 +247,20 @@ BacktrackingParser :
     // is yielded by peek().
     //
     int tAction(int act, int sym);
+
+    //
+    // The driver loops, defined in BacktrackingParserT.h. They read the
+    // lookups and constants (tAction, NUM_RULES, ...) of table: *prs for
+    // the functions of this class, the ParseTableT of its Prs for a
+    // BacktrackingParserT. The rule actions are those of actions (see
+    // applyRuleAction).
+    //
+    template <class Table> int lookaheadWith(Table& table, int act, int token);
+    template <class Table> int tActionWith(Table& table, int act, int sym);
+    template <class Table, class Actions> void processReductionsWith(Table& table, Actions* actions);
+    template <class Table> int processBacktrackReductionsWith(Table& table, int act);
+    template <class Table, class Actions> Object* parseActionsWith(Table& table, Actions* actions, int marker_kind);
+    template <class Table> int backtrackParseWith(Table& table, IntSegmentedTuple* action_arg, int initial_token);
 };
 
 
@@ -0,0 +1,323 @@
+#pragma once
+#include "BacktrackingParser.h"
+#include "ConfigurationElement.h"
+#include "ConfigurationStack.h"
+#include "ErrorToken.h"
+#include "Exception.h"
+#include "IPrsStream.h"
+#include "Monitor.h"
+#include "ParseTableT.h"
+#include "RuleAction.h"
+#include "TokenStream.h"
+
+//
+// The driver loops of BacktrackingParser, written once for the tables
+// whose lookups and constants are only known at run time (ParseTableProxy)
+// and for those known at compile time (ParseTableT). The member functions
+// of BacktrackingParser call them with *prs and ra; BacktrackingParserT,
+// below, with the ParseTableT of its Prs and its Actions, so that the
+// compiler can inline the lookups, fold the constants and call the rule
+// actions without a virtual call.
+//
+
+//
+// keep looking ahead until we compute a valid action
+//
+template <class Table>
+int BacktrackingParser::lookaheadWith(Table& table, int act, int token)
+{
+    return laCache.lookahead(tokStream, table.LA_STATE_OFFSET, act, token,
+                             [&table](int la_state, int sym) { return table.lookAhead(la_state, sym); });
+}
+
+//
+// Compute the next action defined on act and sym. If this
+// action requires more lookahead, these lookahead symbols
+// are in the token stream beginning at the next token that
+// is yielded by peek().
+//
+template <class Table>
+int BacktrackingParser::tActionWith(Table& table, int act, int sym)
+{
+    act = table.tAction(act, sym);
+    if (table.MAX_LA > 1 && act > table.LA_STATE_OFFSET)
+        return lookaheadWith(table, act, tokStream->peek());
+    return act;
+}
+
+//
+// Process reductions and continue...
+//
+template <class Table, class Actions>
+void BacktrackingParser::processReductionsWith(Table& table, Actions* actions)
+{
+    do
+    {
+        stateStackTop -= (table.rhs(currentAction) - 1);
+        applyRuleAction(actions, currentAction);
+        int state = frameState(stateStackTop),
+            symbol = table.lhs(currentAction);
+        currentAction = unitReductions.collapse(state, symbol, table.ntAction(state, symbol),
+                                                [&table](int s, int a) { return table.ntAction(s, a); },
+                                                [&table](int rule) { return table.lhs(rule); });
+    }
+    while (currentAction <= table.NUM_RULES);
+}
+
+//
+// Process reductions and continue...
+//
+template <class Table>
+int BacktrackingParser::processBacktrackReductionsWith(Table& table, int act)
+{
+    do
+    {
+        stateStackTop -= (table.rhs(act) - 1);
+        int state = stateStack[stateStackTop],
+            symbol = table.lhs(act);
+        act = trialUnitReductions.collapse(state, symbol, table.ntAction(state, symbol),
+                                           [&table](int s, int a) { return table.ntAction(s, a); },
+                                           [&table](int rule) { return table.lhs(rule); });
+    }
+    while (act <= table.NUM_RULES);
+    return act;
+}
+
+//
+// Now do the final parse of the input based on the actions in
+// the list "action" and the sequence of tokens in list "tokens".
+//
+template <class Table, class Actions>
+Object* BacktrackingParser::parseActionsWith(Table& table, Actions* actions, int marker_kind)
+{
+    int ti = -1,
+        curtok;
+    lastToken = tokens->get(++ti);
+    curtok = tokens->get(++ti);
+    allocateOtherStacks();
+
+    //
+    // Reparse the input...
+    //
+    stateStackTop = -1;
+    currentAction = table.START_STATE;
+
+    for (int i = 0; i < action->size(); i++)
+    {
+        //
+        // if the parser needs to stop processing, it may do so here.
+        //
+        if (monitor != nullptr && monitor->isCancelled())
+            return nullptr;
+
+        frameState(++stateStackTop) = currentAction;
+        frameLocation(stateStackTop) = ti;
+
+        currentAction = action->get(i);
+        if (currentAction <= table.NUM_RULES) // a reduce action?
+        {
+            stateStackTop--; // make reduction look like shift-reduction
+            processReductionsWith(table, actions);
+        }
+        else // a shift or shift-reduce action
+        {
+            if (kindOf(curtok) > table.NT_OFFSET)
+            {
+                auto badtok = (ErrorToken*)((IPrsStream*)tokStream)->getIToken(curtok);
+                throw BadParseException(badtok->getErrorToken()->getTokenIndex());
+            }
+            lastToken = curtok;
+            curtok = tokens->get(++ti);
+            if (currentAction > table.ERROR_ACTION) // a shift-reduce action?
+            {
+                currentAction -= table.ERROR_ACTION;
+                processReductionsWith(table, actions);
+            }
+        }
+    }
+
+    return frameSym(marker_kind == 0 ? 0 : 1);
+}
+
+//
+// Parse the input until either the parse completes successfully or
+// an error is encountered. This function returns an integer that
+// represents the last action that was executed by the parser. If
+// the parse was succesful, then the tuple "action" contains the
+// successful sequence of actions that was executed.
+//
+template <class Table>
+int BacktrackingParser::backtrackParseWith(Table& table, IntSegmentedTuple* action_arg, int initial_token)
+{
+    //
+    // Allocate configuration stack.
+    //
+    ConfigurationStack configuration_stack(prs);
+
+    //
+    // Keep parsing until we successfully reach the end of file or
+    // an error is encountered. The list of actions executed will
+    // be stored in the "action" tuple.
+    //
+    int error_token = 0,
+        start_token = tokStream->peek(),
+        curtok = (initial_token > 0 ? initial_token : tokStream->getToken()),
+        current_kind = kindOf(curtok),
+        act = tActionWith(table, stateStack[stateStackTop], current_kind);
+
+    //
+    // The main driver loop
+    //
+    for (;;)
+    {
+        //
+        // if the parser needs to stop processing,
+        // it may do so here.
+        //
+        if (monitor != nullptr && monitor->isCancelled())
+            return 0;
+
+        if (act <= table.NUM_RULES)
+        {
+            action_arg->add(act); // save this reduce action
+            stateStackTop--;
+            act = processBacktrackReductionsWith(table, act);
+        }
+        else if (act > table.ERROR_ACTION)
+        {
+            action_arg->add(act); // save this shift-reduce action
+            curtok = tokStream->getToken();
+            current_kind = kindOf(curtok);
+            act = processBacktrackReductionsWith(table, act - table.ERROR_ACTION);
+        }
+        else if (act < table.ACCEPT_ACTION)
+        {
+            action_arg->add(act); // save this shift action
+            curtok = tokStream->getToken();
+            current_kind = kindOf(curtok);
+        }
+        else if (act == table.ERROR_ACTION)
+        {
+            error_token = (error_token > curtok ? error_token : curtok);
+
+            auto configuration = configuration_stack.pop();
+            if (configuration == nullptr)
+                act = table.ERROR_ACTION;
+            else
+            {
+                action_arg->reset(configuration->action_length);
+                act = configuration->act;
+                curtok = configuration->curtok;
+                current_kind = kindOf(curtok);
+                tokStream->reset(curtok == initial_token
+                                     ? start_token
+                                     : tokStream->getNext(curtok));
+                stateStackTop = configuration->stack_top;
+                configuration->retrieveStack(stateStack);
+                continue;
+            }
+            break;
+        }
+        else if (act > table.ACCEPT_ACTION)
+        {
+            if (configuration_stack.findConfiguration(stateStack, stateStackTop, curtok))
+                act = table.ERROR_ACTION;
+            else
+            {
+                configuration_stack.push(stateStack, stateStackTop, act + 1, curtok, action_arg->size());
+                act = table.baseAction(act);
+            }
+            continue;
+        }
+        else break; // assert(act == ACCEPT_ACTION);
+
+        if (++stateStackTop >= stateStack.Size())
+            reallocateStateStack();
+        stateStack[stateStackTop] = act;
+
+        act = tActionWith(table, act, current_kind);
+    }
+
+    return (act == table.ERROR_ACTION ? error_token : 0);
+}
+
+//
+// BacktrackingParser specialized at compile time on a generated parse
+// table class Prs (e.g. JavaParserprs) and on the concrete rule action
+// class Actions (e.g. JavaParser).
+//
+// When it is reset with a Prs, it runs the backtracking driver loop and
+// the final replay of the actions above with the ParseTableT of Prs, and
+// dispatches the rule actions with a qualified call to Actions::ruleAction,
+// so Actions should be the most derived class that implements ruleAction.
+// With a table of another class (e.g. a BinaryParseTable or a
+// ParseTableLayout), it runs those of BacktrackingParser, over the table
+// it was given.
+//
+// Error recovery (RecoveryParser, errorRepair, ...) is inherited as is from
+// BacktrackingParser, so a BacktrackingParserT can be used anywhere a
+// BacktrackingParser* is expected.
+//
+template <class Prs, class Actions>
+struct BacktrackingParserT :
+    public BacktrackingParser
+{
+    typedef ParseTableT<Prs> Table;
+
+    static_assert(Table::BACKTRACK, "Regenerate the parse table with the -BACKTRACK option");
+
+    Table table;
+    Actions* actions = nullptr;
+
+    //
+    // true if the parser was reset with a Prs.
+    //
+    bool specialized = false;
+
+    BacktrackingParserT() = default;
+
+    BacktrackingParserT(TokenStream* tokStream, Actions* ra)
+    {
+        reset(nullptr, tokStream, Table::instance(), ra);
+    }
+
+    BacktrackingParserT(TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(nullptr, tokStream, prs, ra);
+    }
+
+    BacktrackingParserT(Monitor* monitor, TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(monitor, tokStream, prs, ra);
+    }
+
+    using BacktrackingParser::reset;
+
+    void reset(Monitor* monitor, TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        specialized = dynamic_cast<Prs*>(prs) != nullptr;
+        if (specialized)
+            table.prepare(prs);
+        BacktrackingParser::reset(monitor, tokStream, prs, ra);
+        this->actions = ra;
+    }
+
+    void reset(TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(nullptr, tokStream, prs, ra);
+    }
+
+    Object* parseActions(int marker_kind) override
+    {
+        return specialized
+                   ? parseActionsWith(table, actions, marker_kind)
+                   : BacktrackingParser::parseActions(marker_kind);
+    }
+
+    int backtrackParse(IntSegmentedTuple* action_arg, int initial_token) override
+    {
+        return specialized
+                   ? backtrackParseWith(table, action_arg, initial_token)
+                   : BacktrackingParser::backtrackParse(action_arg, initial_token);
+    }
+};
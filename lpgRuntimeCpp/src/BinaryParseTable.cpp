@@ -0,0 +1,430 @@
+#include "BinaryParseTable.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "Exception.h"
+#include "IcuUtil.h"
+#include "ParseTableProxy.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//
+// A read-only memory mapping of a whole file.
+//
+struct BinaryParseTable::MappedFile
+{
+    const char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#endif
+
+    bool open(const std::wstring& fileName)
+    {
+#ifdef _WIN32
+        file = CreateFileW(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+            return false;
+        size = static_cast<size_t>(file_size.QuadPart);
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+            return false;
+        data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        return data != nullptr;
+#else
+        int fd = ::open(IcuUtil::ws2s(fileName).c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat statbuf;
+        if (fstat(fd, &statbuf) != 0 || statbuf.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        size = static_cast<size_t>(statbuf.st_size);
+        void* address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED)
+            return false;
+        data = static_cast<const char*>(address);
+        return true;
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifdef _WIN32
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+#else
+        if (data) munmap(const_cast<char*>(data), size);
+#endif
+    }
+};
+
+namespace
+{
+    void align(std::vector<char>& buffer)
+    {
+        while (buffer.size() % 8 != 0)
+            buffer.push_back(0);
+    }
+
+    template <typename T>
+    void append(std::vector<char>& buffer, const T& value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void appendValues(std::vector<char>& buffer, const std::vector<int>& values, int width)
+    {
+        for (int value : values)
+        {
+            if (width == sizeof(signed char))
+                append(buffer, static_cast<signed char>(value));
+            else if (width == sizeof(short))
+                append(buffer, static_cast<short>(value));
+            else append(buffer, static_cast<int>(value));
+        }
+    }
+
+    BadParseTableFileException badFile(const std::wstring& fileName, const char* reason)
+    {
+        return BadParseTableFileException(IcuUtil::ws2s(fileName) + ": " + reason);
+    }
+}
+
+void BinaryParseTable::write(ParseTable* prs, const std::wstring& fileName)
+{
+    if (prs->get_baseCheck_length() == 0 || prs->get_baseAction_length() == 0 ||
+        prs->get_termCheck_length() == 0 || prs->get_termAction_length() == 0)
+        throw badFile(fileName, "the parse table does not report the length of its arrays");
+    if (prs->get_rhs_data() != prs->get_baseCheck_data() || prs->get_lhs_data() != prs->get_baseAction_data())
+        throw badFile(fileName, "rhs and lhs must share the storage of baseCheck and baseAction");
+
+    //
+    // Collect the arrays of the table.
+    //
+    std::vector<int> values[NUM_SECTIONS];
+    auto collect = [&](Section section, int length, auto element)
+    {
+        values[section].resize(length);
+        for (int i = 0; i < length; i++)
+            values[section][i] = element(i);
+    };
+    collect(IS_NULLABLE, prs->get_isNullable_length(), [&](int i) { return (int)prs->get_isNullable_data()[i]; });
+    collect(PROSTHESES_INDEX, prs->get_prosthesesIndex_length(), [&](int i) { return prs->get_prosthesesIndex_data()[i]; });
+    collect(IS_KEYWORD, prs->get_isKeyword_length(), [&](int i) { return (int)prs->get_isKeyword_data()[i]; });
+    collect(BASE_CHECK, prs->get_baseCheck_length(), [&](int i) { return prs->get_baseCheck_data()[i]; });
+    collect(BASE_ACTION, prs->get_baseAction_length(), [&](int i) { return prs->get_baseAction_data()[i]; });
+    collect(TERM_CHECK, prs->get_termCheck_length(), [&](int i) { return prs->get_termCheck_data()[i]; });
+    collect(TERM_ACTION, prs->get_termAction_length(), [&](int i) { return prs->get_termAction_data()[i]; });
+    collect(ASB, prs->get_asb_length(), [&](int i) { return prs->asb(i); });
+    collect(ASR, prs->get_asr_length(), [&](int i) { return prs->asr(i); });
+    collect(NASB, prs->get_nasb_length(), [&](int i) { return prs->nasb(i); });
+    collect(NASR, prs->get_nasr_length(), [&](int i) { return prs->nasr(i); });
+    collect(TERMINAL_INDEX, prs->get_terminalIndex_length(), [&](int i) { return prs->terminalIndex(i); });
+    collect(NONTERMINAL_INDEX, prs->get_nonterminalIndex_length(), [&](int i) { return prs->nonterminalIndex(i); });
+    collect(SCOPE_PREFIX, prs->get_scopePrefix_length(), [&](int i) { return prs->scopePrefix(i); });
+    collect(SCOPE_SUFFIX, prs->get_scopeSuffix_length(), [&](int i) { return prs->scopeSuffix(i); });
+    collect(SCOPE_LHS, prs->get_scopeLhs_length(), [&](int i) { return prs->scopeLhs(i); });
+    collect(SCOPE_LA, prs->get_scopeLa_length(), [&](int i) { return prs->scopeLa(i); });
+    collect(SCOPE_STATE_SET, prs->get_scopeStateSet_length(), [&](int i) { return prs->scopeStateSet(i); });
+    collect(SCOPE_RHS, prs->get_scopeRhs_length(), [&](int i) { return prs->scopeRhs(i); });
+    collect(SCOPE_STATE, prs->get_scopeState_length(), [&](int i) { return prs->scopeState(i); });
+    collect(IN_SYMB, prs->get_inSymb_length(), [&](int i) { return prs->inSymb(i); });
+
+    std::vector<uint32_t> name_offsets;
+    std::string name_text;
+    for (int i = 0; i < prs->get_name_length(); i++)
+    {
+        name_offsets.push_back(static_cast<uint32_t>(name_text.size()));
+        name_text += IcuUtil::ws2s(prs->name(i));
+    }
+    name_offsets.push_back(static_cast<uint32_t>(name_text.size()));
+
+    int constant_values[NUM_CONSTANTS];
+    constant_values[ERROR_SYMBOL] = prs->getErrorSymbol();
+    constant_values[SCOPE_UBOUND] = prs->getScopeUbound();
+    constant_values[SCOPE_SIZE] = prs->getScopeSize();
+    constant_values[MAX_NAME_LENGTH] = prs->getMaxNameLength();
+    constant_values[NUM_STATES] = prs->getNumStates();
+    constant_values[NT_OFFSET] = prs->getNtOffset();
+    constant_values[LA_STATE_OFFSET] = prs->getLaStateOffset();
+    constant_values[MAX_LA] = prs->getMaxLa();
+    constant_values[NUM_RULES] = prs->getNumRules();
+    constant_values[NUM_NONTERMINALS] = prs->getNumNonterminals();
+    constant_values[NUM_SYMBOLS] = prs->getNumSymbols();
+    constant_values[START_STATE] = prs->getStartState();
+    constant_values[IDENTIFIER_SYMBOL] = prs->getIdentifier_SYMBOL();
+    constant_values[EOFT_SYMBOL] = prs->getEoftSymbol();
+    constant_values[EOLT_SYMBOL] = prs->getEoltSymbol();
+    constant_values[ACCEPT_ACTION] = prs->getAcceptAction();
+    constant_values[ERROR_ACTION] = prs->getErrorAction();
+    constant_values[BACKTRACK] = prs->getBacktrack();
+    constant_values[IS_VALID_FOR_PARSER] = prs->isValidForParser();
+
+    //
+    // Lay out the file: header, constants, section table, then the data.
+    //
+    std::vector<SectionEntry> entries;
+    for (int id = 0; id < NUM_SECTIONS; id++)
+    {
+        if (id == NAME ? name_offsets.size() > 1 : !values[id].empty())
+            entries.push_back({ static_cast<uint32_t>(id), 0, 0, 0 });
+    }
+
+    Header header = { MAGIC, VERSION, BYTE_ORDER_MARK, NUM_CONSTANTS, static_cast<uint32_t>(entries.size()) };
+    std::vector<char> buffer;
+    append(buffer, header);
+    for (int value : constant_values)
+        append(buffer, value);
+    size_t entries_offset = buffer.size();
+    buffer.resize(buffer.size() + entries.size() * sizeof(SectionEntry));
+
+    for (auto& entry : entries)
+    {
+        align(buffer);
+        entry.offset = static_cast<uint32_t>(buffer.size());
+        if (entry.id == NAME)
+        {
+            entry.width = sizeof(char);
+            entry.length = static_cast<uint32_t>(name_offsets.size() - 1);
+            for (uint32_t offset : name_offsets)
+                append(buffer, offset);
+            buffer.insert(buffer.end(), name_text.begin(), name_text.end());
+        }
+        else
+        {
+            auto& section = values[entry.id];
+            //
+            // The char arrays keep width 1 so that they can be handed out
+            // in place by get_isNullable_data() and get_isKeyword_data(),
+            // and prosthesesIndex keeps width 4 for get_prosthesesIndex_data().
+            //
+            entry.width = (entry.id == IS_NULLABLE || entry.id == IS_KEYWORD
+                               ? sizeof(char)
+                               : entry.id == PROSTHESES_INDEX
+                               ? sizeof(int)
+                               : CompactIntArray::widthOf(section.data(), static_cast<int>(section.size())));
+            entry.length = static_cast<uint32_t>(section.size());
+            appendValues(buffer, section, entry.width);
+        }
+    }
+    std::memcpy(&buffer[entries_offset], entries.data(), entries.size() * sizeof(SectionEntry));
+
+    FILE* pFile = nullptr;
+#ifdef _WIN32
+    _wfopen_s(&pFile, fileName.c_str(), L"wb");
+#else
+    pFile = fopen(IcuUtil::ws2s(fileName).c_str(), "wb");
+#endif
+    if (!pFile)
+        throw badFile(fileName, "cannot open the file for writing");
+    size_t count = fwrite(buffer.data(), 1, buffer.size(), pFile);
+    fclose(pFile);
+    if (count != buffer.size())
+        throw badFile(fileName, "cannot write the file");
+}
+
+std::shared_ptr<BinaryParseTable> BinaryParseTable::load(const std::wstring& fileName)
+{
+    std::shared_ptr<BinaryParseTable> table(new BinaryParseTable());
+    table->file = new MappedFile();
+    if (!table->file->open(fileName))
+        throw badFile(fileName, "cannot map the file");
+
+    const char* data = table->file->data;
+    size_t size = table->file->size;
+
+    Header header;
+    if (size < sizeof(Header))
+        throw badFile(fileName, "truncated header");
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != MAGIC)
+        throw badFile(fileName, "not a parse table file");
+    if (header.byteOrder != BYTE_ORDER_MARK)
+        throw badFile(fileName, "the file was written on a machine with a different byte order");
+    if (header.version != VERSION || header.numConstants != NUM_CONSTANTS)
+        throw badFile(fileName, "unsupported parse table file version");
+
+    size_t entries_offset = sizeof(Header) + NUM_CONSTANTS * sizeof(int);
+    if (size < entries_offset + header.numSections * sizeof(SectionEntry))
+        throw badFile(fileName, "truncated section table");
+    std::memcpy(table->constants, data + sizeof(Header), sizeof(table->constants));
+
+    for (uint32_t i = 0; i < header.numSections; i++)
+    {
+        SectionEntry entry;
+        std::memcpy(&entry, data + entries_offset + i * sizeof(SectionEntry), sizeof(SectionEntry));
+        if (entry.id >= NUM_SECTIONS ||
+            (entry.width != sizeof(signed char) && entry.width != sizeof(short) && entry.width != sizeof(int)))
+            throw badFile(fileName, "bad section entry");
+        if ((entry.id == IS_NULLABLE || entry.id == IS_KEYWORD || entry.id == NAME) && entry.width != sizeof(char))
+            throw badFile(fileName, "bad section entry");
+
+        uint64_t end = (entry.id == NAME
+                            ? entry.offset + (uint64_t(entry.length) + 1) * sizeof(uint32_t)
+                            : entry.offset + uint64_t(entry.length) * entry.width);
+        if (entry.offset % 8 != 0 || end > size)
+            throw badFile(fileName, "section out of bounds");
+
+        if (entry.id == NAME)
+        {
+            table->nameOffsets = reinterpret_cast<const uint32_t*>(data + entry.offset);
+            table->nameText = data + end;
+            table->nameCount = entry.length;
+            if (end + table->nameOffsets[entry.length] > size)
+                throw badFile(fileName, "section out of bounds");
+            for (uint32_t name = 0; name < entry.length; name++)
+            {
+                if (table->nameOffsets[name] > table->nameOffsets[name + 1])
+                    throw badFile(fileName, "bad name offsets");
+            }
+        }
+        else
+        {
+            CompactIntArray& section = table->sections[entry.id];
+            section.data = data + entry.offset;
+            section.width = entry.width;
+            section.length = entry.length;
+        }
+    }
+
+    if (table->sections[BASE_CHECK].length == 0 || table->sections[BASE_ACTION].length == 0 ||
+        table->sections[TERM_CHECK].length == 0 || table->sections[TERM_ACTION].length == 0)
+        throw badFile(fileName, "missing parse table arrays");
+    table->validate(fileName);
+
+    return table;
+}
+
+//
+// The parsers index the arrays of a table with rule numbers, symbols and
+// states bounded by its constants, and read a row of terminal actions,
+// one entry per terminal symbol, at the offset given by baseAction for a
+// state or by a lookahead action. Check that the arrays hold all of these
+// indices, so that a table file cannot make them read out of bounds.
+// The states are only known when baseCheck identifies them (see
+// DenseActionRows::states); the error recovery arrays may be missing.
+//
+void BinaryParseTable::validate(const std::wstring& fileName)
+{
+    for (int constant : { NT_OFFSET, NUM_RULES, NUM_NONTERMINALS, NUM_SYMBOLS, NUM_STATES, LA_STATE_OFFSET, ACCEPT_ACTION })
+    {
+        if (constants[constant] < 0)
+            throw badFile(fileName, "bad parse table constant");
+    }
+
+    auto require = [&](Section section, int64_t length, bool optional)
+    {
+        if (sections[section].length < length && !(optional && sections[section].length == 0))
+            throw badFile(fileName, "a section is too short for the constants of the table");
+    };
+    require(BASE_CHECK, int64_t(constants[NUM_RULES]) + 1, false);
+    require(BASE_ACTION, std::max(int64_t(constants[NUM_RULES]) + 1, int64_t(constants[ACCEPT_ACTION])), false);
+    require(TERM_CHECK, sections[TERM_ACTION].length, false);
+    require(IS_NULLABLE, int64_t(constants[NUM_SYMBOLS]) + 1, true);
+    require(PROSTHESES_INDEX, int64_t(constants[NUM_NONTERMINALS]) + 1, true);
+    require(IS_KEYWORD, int64_t(constants[NT_OFFSET]) + 1, true);
+    require(TERMINAL_INDEX, int64_t(constants[NT_OFFSET]) + 1, true);
+    require(NONTERMINAL_INDEX, int64_t(constants[NUM_NONTERMINALS]) + 1, true);
+    require(ASB, int64_t(constants[NUM_STATES]) + 1, true);
+    require(NASB, int64_t(constants[NUM_STATES]) + 1, true);
+    require(IN_SYMB, int64_t(constants[NUM_STATES]) + 1, true);
+
+    const CompactIntArray& base_check = sections[BASE_CHECK];
+    const CompactIntArray& base_action = sections[BASE_ACTION];
+    const CompactIntArray& term_action = sections[TERM_ACTION];
+    int64_t row_limit = std::min(int64_t(sections[TERM_CHECK].length) - constants[NT_OFFSET],
+                                 int64_t(term_action.length));
+    auto requireRow = [&](int64_t offset)
+    {
+        if (offset < 0 || offset >= row_limit)
+            throw badFile(fileName, "a row of terminal actions is out of bounds");
+    };
+    for (int i = 0; i < term_action.length; i++)
+    {
+        if (term_action[i] > constants[LA_STATE_OFFSET])
+            requireRow(int64_t(term_action[i]) - constants[LA_STATE_OFFSET]);
+    }
+    for (int state = constants[NUM_RULES] + 1; state < constants[ACCEPT_ACTION] && state < base_check.length; state++)
+    {
+        if (base_check[state] < 0)
+            requireRow(base_action[state]);
+    }
+}
+
+BinaryParseTable::~BinaryParseTable()
+{
+    delete file;
+}
+
+ParseTableProxy* BinaryParseTable::createProxy()
+{
+    return new ParseTableProxy(this);
+}
+
+std::wstring BinaryParseTable::name(int index)
+{
+    if (index < 0 || index >= nameCount)
+        return {};
+    return IcuUtil::s2ws(std::string(nameText + nameOffsets[index], nameText + nameOffsets[index + 1]));
+}
+
+signed int* BinaryParseTable::widen(Section section)
+{
+    CompactIntArray& array = sections[section];
+    if (array.length == 0)
+        return nullptr;
+    if (array.width == sizeof(int))
+        return const_cast<signed int*>(static_cast<const signed int*>(array.data));
+
+    std::lock_guard<std::mutex> guard(widenLock);
+    if (widened[section].empty())
+    {
+        widened[section].resize(array.length);
+        for (int i = 0; i < array.length; i++)
+            widened[section][i] = array[i];
+    }
+    return widened[section].data();
+}
+
+char* BinaryParseTable::chars(Section section)
+{
+    return const_cast<char*>(static_cast<const char*>(sections[section].data));
+}
+
+char* BinaryParseTable::get_isNullable_data() { return chars(IS_NULLABLE); }
+signed int* BinaryParseTable::get_prosthesesIndex_data() { return widen(PROSTHESES_INDEX); }
+char* BinaryParseTable::get_isKeyword_data() { return chars(IS_KEYWORD); }
+signed int* BinaryParseTable::get_baseCheck_data() { return widen(BASE_CHECK); }
+signed int* BinaryParseTable::get_baseAction_data() { return widen(BASE_ACTION); }
+signed int* BinaryParseTable::get_termCheck_data() { return widen(TERM_CHECK); }
+signed int* BinaryParseTable::get_termAction_data() { return widen(TERM_ACTION); }
+
+bool BinaryParseTable::get_compact_arrays(CompactIntArray& baseCheck, CompactIntArray& baseAction,
+                                          CompactIntArray& termCheck, CompactIntArray& termAction)
+{
+    baseCheck = sections[BASE_CHECK];
+    baseAction = sections[BASE_ACTION];
+    termCheck = sections[TERM_CHECK];
+    termAction = sections[TERM_ACTION];
+    return true;
+}
@@ -0,0 +1,263 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "CompactIntArray.h"
+#include "ParseTable.h"
+
+class ParseTableProxy;
+
+//
+// A ParseTable read from a binary table file mapped read-only in memory.
+//
+// The file is produced by BinaryParseTable::write from any ParseTable that
+// reports the length of its arrays (the generated *prs classes do). All
+// the processes that load the same file share a single page-cache copy of
+// it, and a grammar can be updated without recompiling the parser.
+//
+// File layout (version 1, all fields in the byte order of the writer):
+//
+//     Header          magic "LPGT", version, byte order mark,
+//                     number of constants, number of sections
+//     int32[]         the constants, in the order of enum Constant
+//     SectionEntry[]  one entry per array present in the table
+//     ...             the array data, each one aligned on 8 bytes
+//
+// Integer arrays are stored with the narrowest element width that holds
+// all of their values (see CompactIntArray). The names are stored as an
+// array of (length + 1) uint32 offsets followed by their UTF-8 text.
+//
+struct BinaryParseTable :public ParseTable
+{
+    constexpr static uint32_t MAGIC = 0x5447504C; // "LPGT"
+    constexpr static uint32_t VERSION = 1;
+    constexpr static uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    enum Constant
+    {
+        ERROR_SYMBOL,
+        SCOPE_UBOUND,
+        SCOPE_SIZE,
+        MAX_NAME_LENGTH,
+        NUM_STATES,
+        NT_OFFSET,
+        LA_STATE_OFFSET,
+        MAX_LA,
+        NUM_RULES,
+        NUM_NONTERMINALS,
+        NUM_SYMBOLS,
+        START_STATE,
+        IDENTIFIER_SYMBOL,
+        EOFT_SYMBOL,
+        EOLT_SYMBOL,
+        ACCEPT_ACTION,
+        ERROR_ACTION,
+        BACKTRACK,
+        IS_VALID_FOR_PARSER,
+        NUM_CONSTANTS
+    };
+
+    enum Section
+    {
+        IS_NULLABLE,
+        PROSTHESES_INDEX,
+        IS_KEYWORD,
+        BASE_CHECK,
+        BASE_ACTION,
+        TERM_CHECK,
+        TERM_ACTION,
+        ASB,
+        ASR,
+        NASB,
+        NASR,
+        TERMINAL_INDEX,
+        NONTERMINAL_INDEX,
+        SCOPE_PREFIX,
+        SCOPE_SUFFIX,
+        SCOPE_LHS,
+        SCOPE_LA,
+        SCOPE_STATE_SET,
+        SCOPE_RHS,
+        SCOPE_STATE,
+        IN_SYMB,
+        NAME,
+        NUM_SECTIONS
+    };
+
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t numConstants;
+        uint32_t numSections;
+    };
+
+    struct SectionEntry
+    {
+        uint32_t id;
+        uint32_t width;
+        uint32_t length;
+        uint32_t offset;
+    };
+
+    //
+    // Write prs to the file fileName. Throws BadParseTableFileException if
+    // the table does not report the length of its arrays or if the file
+    // cannot be written.
+    //
+    static void write(ParseTable* prs, const std::wstring& fileName);
+
+    //
+    // Map the file fileName. Throws BadParseTableFileException if the file
+    // cannot be mapped or is not a valid table file of this version, or if
+    // its arrays are too short for the indices that the parsers compute
+    // from its constants and its actions (see validate).
+    //
+    static std::shared_ptr<BinaryParseTable> load(const std::wstring& fileName);
+
+    //
+    // Build a ParseTableProxy that reads the mapped arrays in place.
+    // The proxy must not outlive this table.
+    //
+    ParseTableProxy* createProxy();
+
+    ~BinaryParseTable();
+
+    int baseCheck(int index) override { return sections[BASE_CHECK][index]; }
+    int rhs(int index) override { return sections[BASE_CHECK][index]; }
+    int baseAction(int index) override { return sections[BASE_ACTION][index]; }
+    int lhs(int index) override { return sections[BASE_ACTION][index]; }
+    int termCheck(int index) override { return sections[TERM_CHECK][index]; }
+    int termAction(int index) override { return sections[TERM_ACTION][index]; }
+    int asb(int index) override { return get(ASB, index); }
+    int asr(int index) override { return get(ASR, index); }
+    int nasb(int index) override { return get(NASB, index); }
+    int nasr(int index) override { return get(NASR, index); }
+    int terminalIndex(int index) override { return get(TERMINAL_INDEX, index); }
+    int nonterminalIndex(int index) override { return get(NONTERMINAL_INDEX, index); }
+    int scopePrefix(int index) override { return get(SCOPE_PREFIX, index); }
+    int scopeSuffix(int index) override { return get(SCOPE_SUFFIX, index); }
+    int scopeLhs(int index) override { return get(SCOPE_LHS, index); }
+    int scopeLa(int index) override { return get(SCOPE_LA, index); }
+    int scopeStateSet(int index) override { return get(SCOPE_STATE_SET, index); }
+    int scopeRhs(int index) override { return get(SCOPE_RHS, index); }
+    int scopeState(int index) override { return get(SCOPE_STATE, index); }
+    int inSymb(int index) override { return get(IN_SYMB, index); }
+    std::wstring name(int index) override;
+
+    int originalState(int state) override { return -baseCheck(state); }
+    int asi(int state) override { return asb(originalState(state)); }
+    int nasi(int state) override { return nasb(originalState(state)); }
+    int inSymbol(int state) override { return inSymb(originalState(state)); }
+
+    int ntAction(int state, int sym) override
+    {
+        return baseAction(state + sym);
+    }
+    int tAction(int state, int sym) override
+    {
+        int i = baseAction(state),
+            k = i + sym;
+        return termAction(termCheck(k) == sym ? k : i);
+    }
+    int lookAhead(int la_state, int sym) override
+    {
+        int k = la_state + sym;
+        return termAction(termCheck(k) == sym ? k : la_state);
+    }
+
+    int getErrorSymbol() override { return constants[ERROR_SYMBOL]; }
+    int getScopeUbound() override { return constants[SCOPE_UBOUND]; }
+    int getScopeSize() override { return constants[SCOPE_SIZE]; }
+    int getMaxNameLength() override { return constants[MAX_NAME_LENGTH]; }
+    int getNumStates() override { return constants[NUM_STATES]; }
+    int getNtOffset() override { return constants[NT_OFFSET]; }
+    int getLaStateOffset() override { return constants[LA_STATE_OFFSET]; }
+    int getMaxLa() override { return constants[MAX_LA]; }
+    int getNumRules() override { return constants[NUM_RULES]; }
+    int getNumNonterminals() override { return constants[NUM_NONTERMINALS]; }
+    int getNumSymbols() override { return constants[NUM_SYMBOLS]; }
+    int getStartState() override { return constants[START_STATE]; }
+    int getStartSymbol() override { return lhs(0); }
+    int getEoftSymbol() override { return constants[EOFT_SYMBOL]; }
+    int getEoltSymbol() override { return constants[EOLT_SYMBOL]; }
+    int getAcceptAction() override { return constants[ACCEPT_ACTION]; }
+    int getErrorAction() override { return constants[ERROR_ACTION]; }
+    bool isNullable(int symbol) override { return get(IS_NULLABLE, symbol) != 0; }
+    bool isValidForParser() override { return constants[IS_VALID_FOR_PARSER] != 0; }
+    bool getBacktrack() override { return constants[BACKTRACK] != 0; }
+    int getIdentifier_SYMBOL() override { return constants[IDENTIFIER_SYMBOL]; }
+
+    char* get_isNullable_data() override;
+    signed int* get_prosthesesIndex_data() override;
+    char* get_isKeyword_data() override;
+    signed int* get_baseCheck_data() override;
+    signed int* get_rhs_data() override { return get_baseCheck_data(); }
+    signed int* get_baseAction_data() override;
+    signed int* get_lhs_data() override { return get_baseAction_data(); }
+    signed int* get_termCheck_data() override;
+    signed int* get_termAction_data() override;
+
+    int get_baseCheck_length() override { return sections[BASE_CHECK].length; }
+    int get_baseAction_length() override { return sections[BASE_ACTION].length; }
+    int get_termCheck_length() override { return sections[TERM_CHECK].length; }
+    int get_termAction_length() override { return sections[TERM_ACTION].length; }
+    int get_isNullable_length() override { return sections[IS_NULLABLE].length; }
+    int get_prosthesesIndex_length() override { return sections[PROSTHESES_INDEX].length; }
+    int get_isKeyword_length() override { return sections[IS_KEYWORD].length; }
+    int get_asb_length() override { return sections[ASB].length; }
+    int get_asr_length() override { return sections[ASR].length; }
+    int get_nasb_length() override { return sections[NASB].length; }
+    int get_nasr_length() override { return sections[NASR].length; }
+    int get_terminalIndex_length() override { return sections[TERMINAL_INDEX].length; }
+    int get_nonterminalIndex_length() override { return sections[NONTERMINAL_INDEX].length; }
+    int get_scopePrefix_length() override { return sections[SCOPE_PREFIX].length; }
+    int get_scopeSuffix_length() override { return sections[SCOPE_SUFFIX].length; }
+    int get_scopeLhs_length() override { return sections[SCOPE_LHS].length; }
+    int get_scopeLa_length() override { return sections[SCOPE_LA].length; }
+    int get_scopeStateSet_length() override { return sections[SCOPE_STATE_SET].length; }
+    int get_scopeRhs_length() override { return sections[SCOPE_RHS].length; }
+    int get_scopeState_length() override { return sections[SCOPE_STATE].length; }
+    int get_inSymb_length() override { return sections[IN_SYMB].length; }
+    int get_name_length() override { return nameCount; }
+
+    bool get_compact_arrays(CompactIntArray& baseCheck, CompactIntArray& baseAction,
+                            CompactIntArray& termCheck, CompactIntArray& termAction) override;
+
+private:
+    BinaryParseTable() = default;
+
+    struct MappedFile;
+    MappedFile* file = nullptr;
+
+    int constants[NUM_CONSTANTS] = {};
+    CompactIntArray sections[NUM_SECTIONS];
+    const uint32_t* nameOffsets = nullptr;
+    const char* nameText = nullptr;
+    int nameCount = 0;
+
+    //
+    // Element index of section, or 0 if the section is missing or index is
+    // out of its bounds.
+    //
+    int get(Section section, int index)
+    {
+        return ((unsigned) index < (unsigned) sections[section].length ? sections[section][index] : 0);
+    }
+
+    void validate(const std::wstring& fileName);
+
+    //
+    // The get_*_data() functions of ParseTable return "signed int" arrays.
+    // Narrowed sections are widened into these buffers the first time they
+    // are requested. (The "char" sections are always stored with width 1.)
+    //
+    std::mutex widenLock;
+    std::vector<signed int> widened[NUM_SECTIONS];
+    signed int* widen(Section section);
+    char* chars(Section section);
+};
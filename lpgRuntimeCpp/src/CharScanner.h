@@ -0,0 +1,358 @@
+#pragma once
+#include <type_traits>
+
+//
+// Scans of runs of characters that the lexers do not need to see one at a
+// time: white space, the bodies of line and block comments, and the line
+// feeds that the streams index to compute line numbers. With SSE2
+// or AVX2 (chosen at compile time, unless LPG_NO_SIMD is defined), 16 or 32
+// bytes of the input are tested at once; otherwise, and at the end of the
+// input, the characters are tested one at a time.
+//
+// The functions work on the characters of a LexStream (wchar_t) or on the
+// bytes of a Utf8LexStream (char). They only stop on ASCII characters, so
+// that in UTF-8 input the offset that they return is always at the
+// beginning of a character.
+//
+// White space is ' ', HT, LF, CR and FF, and a control character is a
+// character below ' '. The character 0xFFFF, which the lexers take as the
+// end of the file, ends a comment.
+//
+#if !defined(LPG_NO_SIMD) && defined(__AVX2__)
+#define LPG_CHAR_SCANNER_AVX2
+#include <immintrin.h>
+#elif !defined(LPG_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define LPG_CHAR_SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2))
+#include <intrin.h>
+#endif
+
+namespace CharScanner
+{
+    namespace detail
+    {
+        template <typename Char>
+        bool isWhitespace(Char ch)
+        {
+            auto c = static_cast<std::make_unsigned_t<Char>>(ch);
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+        }
+
+        //
+        // A control character other than HT and FF, or 0xFFFF.
+        //
+        template <typename Char>
+        bool endsLine(Char ch)
+        {
+            auto c = static_cast<std::make_unsigned_t<Char>>(ch);
+            return (c < ' ' && c != '\t' && c != '\f') || (sizeof(Char) > 1 && c == 0xFFFF);
+        }
+
+        //
+        // A '*', a control character other than white space, or 0xFFFF.
+        //
+        template <typename Char>
+        bool endsBlock(Char ch)
+        {
+            auto c = static_cast<std::make_unsigned_t<Char>>(ch);
+            return c == '*' || (c < ' ' && !isWhitespace(ch)) || (sizeof(Char) > 1 && c == 0xFFFF);
+        }
+
+#if defined(LPG_CHAR_SCANNER_AVX2)
+        using Vec = __m256i;
+        constexpr int BYTES = 32;
+        constexpr unsigned FULL = 0xFFFFFFFFu;
+
+        inline Vec load(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+        inline unsigned bits(Vec v) { return static_cast<unsigned>(_mm256_movemask_epi8(v)); }
+        inline Vec either(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+        inline Vec andNot(Vec a, Vec b) { return _mm256_andnot_si256(b, a); } // a & ~b
+        inline Vec same(Vec a, Vec b) { return _mm256_cmpeq_epi8(a, b); }     // bytewise a == b
+
+        template <int N> Vec set(int c)
+        {
+            return N == 1 ? _mm256_set1_epi8(static_cast<char>(c))
+                 : N == 2 ? _mm256_set1_epi16(static_cast<short>(c))
+                 : _mm256_set1_epi32(c);
+        }
+        template <int N> Vec eq(Vec v, int c)
+        {
+            return N == 1 ? _mm256_cmpeq_epi8(v, set<1>(c))
+                 : N == 2 ? _mm256_cmpeq_epi16(v, set<2>(c))
+                 : _mm256_cmpeq_epi32(v, set<4>(c));
+        }
+        template <int N> Vec below(Vec v, int c) // unsigned v < c
+        {
+            return N == 1 ? _mm256_cmpeq_epi8(_mm256_subs_epu8(v, set<1>(c - 1)), _mm256_setzero_si256())
+                 : N == 2 ? _mm256_cmpeq_epi16(_mm256_subs_epu16(v, set<2>(c - 1)), _mm256_setzero_si256())
+                 : _mm256_and_si256(_mm256_cmpgt_epi32(set<4>(c), v), _mm256_cmpgt_epi32(v, set<4>(-1)));
+        }
+        template <int N> Vec sub(Vec a, Vec b)
+        {
+            return N == 1 ? _mm256_sub_epi8(a, b) : N == 2 ? _mm256_sub_epi16(a, b) : _mm256_sub_epi32(a, b);
+        }
+        inline Vec zero() { return _mm256_setzero_si256(); }
+        inline void store(void* p, Vec v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+#elif defined(LPG_CHAR_SCANNER_SSE2)
+        using Vec = __m128i;
+        constexpr int BYTES = 16;
+        constexpr unsigned FULL = 0xFFFFu;
+
+        inline Vec load(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+        inline unsigned bits(Vec v) { return static_cast<unsigned>(_mm_movemask_epi8(v)); }
+        inline Vec either(Vec a, Vec b) { return _mm_or_si128(a, b); }
+        inline Vec andNot(Vec a, Vec b) { return _mm_andnot_si128(b, a); } // a & ~b
+        inline Vec same(Vec a, Vec b) { return _mm_cmpeq_epi8(a, b); }     // bytewise a == b
+
+        template <int N> Vec set(int c)
+        {
+            return N == 1 ? _mm_set1_epi8(static_cast<char>(c))
+                 : N == 2 ? _mm_set1_epi16(static_cast<short>(c))
+                 : _mm_set1_epi32(c);
+        }
+        template <int N> Vec eq(Vec v, int c)
+        {
+            return N == 1 ? _mm_cmpeq_epi8(v, set<1>(c))
+                 : N == 2 ? _mm_cmpeq_epi16(v, set<2>(c))
+                 : _mm_cmpeq_epi32(v, set<4>(c));
+        }
+        template <int N> Vec below(Vec v, int c) // unsigned v < c
+        {
+            return N == 1 ? _mm_cmpeq_epi8(_mm_subs_epu8(v, set<1>(c - 1)), _mm_setzero_si128())
+                 : N == 2 ? _mm_cmpeq_epi16(_mm_subs_epu16(v, set<2>(c - 1)), _mm_setzero_si128())
+                 : _mm_and_si128(_mm_cmplt_epi32(v, set<4>(c)), _mm_cmpgt_epi32(v, set<4>(-1)));
+        }
+        template <int N> Vec sub(Vec a, Vec b)
+        {
+            return N == 1 ? _mm_sub_epi8(a, b) : N == 2 ? _mm_sub_epi16(a, b) : _mm_sub_epi32(a, b);
+        }
+        inline Vec zero() { return _mm_setzero_si128(); }
+        inline void store(void* p, Vec v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+#endif
+
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+        inline int firstBit(unsigned mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<int>(index);
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+
+        //
+        // The bit of the first byte of each character of size N in a mask.
+        //
+        template <int N> constexpr unsigned firstBytes()
+        {
+            return N == 1 ? 0xFFFFFFFFu : N == 2 ? 0x55555555u : 0x11111111u;
+        }
+
+        template <int N> Vec whitespace(Vec v)
+        {
+            return either(either(eq<N>(v, ' '), eq<N>(v, '\t')),
+                          either(either(eq<N>(v, '\n'), eq<N>(v, '\r')), eq<N>(v, '\f')));
+        }
+        template <int N> Vec endOfFile(Vec v)
+        {
+            return N == 1 ? andNot(v, v) : eq<N>(v, 0xFFFF); // no byte is 0xFFFF
+        }
+#endif
+
+        //
+        // Return the offset of the first character in chars[i..end) for
+        // which stop holds, or end. stops(v) is the mask of the bytes of
+        // the characters in v for which stop holds.
+        //
+        template <typename Char, typename Stops, typename Stop>
+        int find(const Char* chars, int i, int end, Stops stops, Stop stop)
+        {
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+            constexpr int LANES = BYTES / sizeof(Char);
+            for (; i + LANES <= end; i += LANES)
+            {
+                unsigned mask = stops(load(chars + i));
+                if (mask != 0)
+                    return i + firstBit(mask) / static_cast<int>(sizeof(Char));
+            }
+#endif
+            while (i < end && !stop(chars[i]))
+                i++;
+            return i;
+        }
+    }
+
+    //
+    // Return the offset of the first character in chars[i..end) that is
+    // not white space, or end.
+    //
+    template <typename Char>
+    int skipWhitespace(const Char* chars, int i, int end)
+    {
+        using namespace detail;
+        return find(chars, i, end,
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+                    [](Vec v) { return ~bits(whitespace<sizeof(Char)>(v)) & FULL; },
+#else
+                    nullptr,
+#endif
+                    [](Char c) { return !isWhitespace(c); });
+    }
+
+    //
+    // Return the offset of the first character in chars[i..end) that may
+    // end a line comment: a control character other than HT and FF
+    // (in particular LF and CR), or 0xFFFF. Return end if there is none.
+    //
+    template <typename Char>
+    int findLineEnd(const Char* chars, int i, int end)
+    {
+        using namespace detail;
+        return find(chars, i, end,
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+                    [](Vec v)
+                    {
+                        constexpr int N = sizeof(Char);
+                        return bits(either(andNot(below<N>(v, ' '), either(eq<N>(v, '\t'), eq<N>(v, '\f'))), endOfFile<N>(v)));
+                    },
+#else
+                    nullptr,
+#endif
+                    [](Char c) { return endsLine(c); });
+    }
+
+    //
+    // Return the offset of the '*' of the first "*/" in chars[i..end), of
+    // the first control character other than white space, or 0xFFFF, that
+    // comes before it, or end.
+    //
+    template <typename Char>
+    int findBlockCommentEnd(const Char* chars, int i, int end)
+    {
+        using namespace detail;
+        for (;;)
+        {
+            i = find(chars, i, end,
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+                     [](Vec v)
+                     {
+                         constexpr int N = sizeof(Char);
+                         return bits(either(either(eq<N>(v, '*'), andNot(below<N>(v, ' '), whitespace<N>(v))), endOfFile<N>(v)));
+                     },
+#else
+                     nullptr,
+#endif
+                     [](Char c) { return endsBlock(c); });
+            if (i >= end || chars[i] != '*' || (i + 1 < end && chars[i + 1] == '/'))
+                return i;
+            i++;
+        }
+    }
+
+    //
+    // Return the number of line feeds in chars[i..end).
+    //
+    template <typename Char>
+    int countNewlines(const Char* chars, int i, int end)
+    {
+        using namespace detail;
+        int count = 0;
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+        //
+        // Each lane of sums counts the line feeds seen in that lane (a match
+        // is -1), and is added to count before it can overflow.
+        //
+        using Lane = std::make_unsigned_t<Char>;
+        constexpr int N = sizeof(Char),
+                      LANES = BYTES / N,
+                      ROUNDS = (N == 1 ? 255 : N == 2 ? 65535 : 1 << 20);
+        while (i + LANES <= end)
+        {
+            Vec sums = zero();
+            for (int round = 0; round < ROUNDS && i + LANES <= end; round++, i += LANES)
+                sums = sub<N>(sums, eq<N>(load(chars + i), '\n'));
+
+            Lane lanes[LANES];
+            store(lanes, sums);
+            for (int k = 0; k < LANES; k++)
+                count += lanes[k];
+        }
+#endif
+        for (; i < end; i++)
+            count += (chars[i] == '\n');
+        return count;
+    }
+
+    //
+    // Write the offsets of the line feeds in chars[i..end) to offsets, which
+    // must have room for them (see countNewlines), and return their number.
+    //
+    template <typename Char>
+    int findNewlines(const Char* chars, int i, int end, int* offsets)
+    {
+        using namespace detail;
+        int* next = offsets;
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+        constexpr int N = sizeof(Char),
+                      LANES = BYTES / N;
+        for (; i + LANES <= end; i += LANES)
+        {
+            for (unsigned mask = bits(eq<N>(load(chars + i), '\n')) & firstBytes<N>(); mask != 0; mask &= mask - 1)
+                *next++ = i + firstBit(mask) / N;
+        }
+#endif
+        for (; i < end; i++)
+        {
+            if (chars[i] == '\n')
+                *next++ = i;
+        }
+        return static_cast<int>(next - offsets);
+    }
+
+    //
+    // Write the offsets of the line feeds in chars[i..end) into an array,
+    // after its first elements: resize(n) must set the size of the array
+    // to n, keeping its first elements, and return them (see
+    // Tuple::Contiguous). With vectors, the input is processed in blocks
+    // that stay in the cache between the count of their line feeds and the
+    // writing of their offsets; otherwise, the array is grown as needed in
+    // a single pass.
+    //
+    template <typename Char, typename Resize>
+    void indexNewlines(const Char* chars, int i, int end, int first, Resize resize)
+    {
+        int length = first;
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+        constexpr int BLOCK = 1 << 14;
+        while (i < end)
+        {
+            int block_end = (end - i > BLOCK ? i + BLOCK : end),
+                count = countNewlines(chars, i, block_end);
+            if (count > 0)
+            {
+                findNewlines(chars, i, block_end, resize(length + count) + length);
+                length += count;
+            }
+            i = block_end;
+        }
+#else
+        int capacity = first;
+        int* offsets = resize(capacity);
+        for (; i < end; i++)
+        {
+            if (chars[i] == '\n')
+            {
+                if (length == capacity)
+                    offsets = resize(capacity = capacity * 2 + 64);
+                offsets[length++] = i;
+            }
+        }
+#endif
+        resize(length);
+    }
+}
@@ -0,0 +1,56 @@
+#include "CompactIntArray.h"
+
+#include <climits>
+
+namespace
+{
+    template <typename T>
+    void convert(const signed int* values, int length, std::vector<char>& storage)
+    {
+        storage.resize(length * sizeof(T));
+        T* target = reinterpret_cast<T*>(storage.data());
+        for (int i = 0; i < length; i++)
+            target[i] = static_cast<T>(values[i]);
+    }
+}
+
+int CompactIntArray::widthOf(const signed int* values, int length)
+{
+    int min = 0,
+        max = 0;
+    for (int i = 0; i < length; i++)
+    {
+        if (values[i] < min) min = values[i];
+        if (values[i] > max) max = values[i];
+    }
+
+    if (min >= SCHAR_MIN && max <= SCHAR_MAX)
+        return sizeof(signed char);
+    if (min >= SHRT_MIN && max <= SHRT_MAX)
+        return sizeof(short);
+    return sizeof(int);
+}
+
+CompactIntArray CompactIntArray::narrow(const signed int* values, int length, Cache& cache)
+{
+    CompactIntArray view(values, length);
+    if (values == nullptr || length <= 0)
+        return view;
+
+    int width = widthOf(values, length);
+    if (width == sizeof(int))
+        return view;
+
+    std::lock_guard<std::mutex> guard(cache.lock);
+    auto& storage = cache.copies[std::make_pair(values, length)];
+    if (storage.empty())
+    {
+        if (width == sizeof(signed char))
+            convert<signed char>(values, length, storage);
+        else convert<short>(values, length, storage);
+    }
+
+    view.data = storage.data();
+    view.width = width;
+    return view;
+}
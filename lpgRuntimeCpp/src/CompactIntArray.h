@@ -0,0 +1,101 @@
+#pragma once
+#include <climits>
+#include <map>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//
+// Read-only view of a parse table array stored with the narrowest element
+// type that can hold all of its values: signed char, short or int.
+//
+// The generated *prs classes store every table as "signed int", although
+// most of them fit in 16 bits and the check arrays usually fit in 8 bits.
+// ParseTableProxy narrows its hot arrays when it loads a table, which cuts
+// the cache footprint of tAction/ntAction/lookAhead by a factor of 2 to 4.
+//
+// Narrowed copies are kept by the table whose arrays they are (see
+// ParseTable::compactArrays): an array is only converted once, no matter
+// how many parsers are built over its table, and the copy is freed with
+// the table.
+//
+struct CompactIntArray
+{
+    const void* data = nullptr;
+    int width = sizeof(int);
+    int length = 0;
+
+    CompactIntArray() = default;
+
+    //
+    // A view of the original (unnarrowed) array.
+    //
+    CompactIntArray(const signed int* values, int length) : data(values), length(length)
+    {
+    }
+
+    //
+    // Width-specialized accessor.
+    //
+    template <typename T>
+    int at(int index) const { return static_cast<const T*>(data)[index]; }
+
+    int operator[](int index) const
+    {
+        return withElementType(width, [this, index](auto element) { return at<decltype(element)>(index); });
+    }
+
+    //
+    // Call body with a value of the element type of an array of the given
+    // width, and return its result.
+    //
+    template <typename Body>
+    static int withElementType(int width, Body body)
+    {
+        switch (width)
+        {
+        case sizeof(signed char):
+            return body(static_cast<signed char>(0));
+        case sizeof(short):
+            return body(static_cast<short>(0));
+        default:
+            return body(0);
+        }
+    }
+
+    //
+    // The narrowed copies of the arrays of one table, keyed on the array
+    // and its length. A copy of the cache starts empty.
+    //
+    struct Cache
+    {
+        std::mutex lock;
+        std::map<std::pair<const signed int*, int>, std::vector<char>> copies;
+
+        Cache() = default;
+        Cache(const Cache&) {}
+        Cache& operator=(const Cache&) { return *this; }
+    };
+
+    //
+    // Number of bytes needed to hold every element of values (1, 2 or 4).
+    //
+    static int widthOf(const signed int* values, int length);
+
+    //
+    // Return a view of values using the narrowest element type, whose copy
+    // is kept in cache. When the length is unknown (0), the original array
+    // is used as is.
+    //
+    static CompactIntArray narrow(const signed int* values, int length, Cache& cache);
+};
+
+//
+// The narrowest of signed char, short and int that holds every value in
+// [-bound, bound], for tables whose bounds are known at compile time (see
+// ParseTableT).
+//
+template <int Bound>
+using NarrowestInt = std::conditional_t<Bound <= SCHAR_MAX, signed char,
+                                        std::conditional_t<Bound <= SHRT_MAX, short, int>>;
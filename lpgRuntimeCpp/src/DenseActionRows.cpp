@@ -0,0 +1,220 @@
+#include "DenseActionRows.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "ParseTable.h"
+
+namespace
+{
+    std::mutex registry_lock;
+    std::map<ParseTable*, std::shared_ptr<DenseActionRows>> registry;
+
+    //
+    // The terminal action of state on sym, computed on the compressed
+    // tables. When the table reports the length of its arrays, a check
+    // index beyond the end of termCheck is treated as a mismatch.
+    //
+    int compressedAction(ParseTable* prs, int state, int sym)
+    {
+        int check_length = prs->get_termCheck_length();
+        if (check_length == 0)
+            return prs->tAction(state, sym);
+
+        const signed int* base_action = prs->get_baseAction_data();
+        const signed int* term_check = prs->get_termCheck_data();
+        const signed int* term_action = prs->get_termAction_data();
+        int i = base_action[state],
+            k = i + sym;
+        return term_action[k < check_length && term_check[k] == sym ? k : i];
+    }
+
+    //
+    // Number of terminals that have an explicit entry in the row of state.
+    //
+    int explicitActions(ParseTable* prs, int state, int width)
+    {
+        int check_length = prs->get_termCheck_length();
+        const signed int* base_action = prs->get_baseAction_data();
+        const signed int* term_check = prs->get_termCheck_data();
+        int count = 0;
+        for (int sym = 0; sym < width; sym++)
+        {
+            int k = base_action[state] + sym;
+            if ((check_length == 0 || k < check_length) && term_check[k] == sym)
+                count++;
+        }
+        return count;
+    }
+
+    //
+    // The rows of the state numbers first..last. The numbers that are
+    // not in states get error actions.
+    //
+    std::shared_ptr<DenseActionRows> expand(ParseTable* prs, const std::vector<int>& states, int first, int last)
+    {
+        auto rows = std::make_shared<DenseActionRows>();
+        rows->width = prs->getNtOffset() + 1;
+        if (first > last)
+            return rows;
+        rows->firstState = first;
+        rows->count = last - first + 1;
+        rows->actions.assign(size_t(rows->count) * rows->width, prs->getErrorAction());
+        for (int state : states)
+        {
+            if (state < first || state > last)
+                continue;
+            int* row = &rows->actions[size_t(state - first) * rows->width];
+            for (int sym = 0; sym < rows->width; sym++)
+                row[sym] = compressedAction(prs, state, sym);
+        }
+        return rows;
+    }
+
+    //
+    // The range of state numbers, within byte_budget bytes of rows, with
+    // the greatest total weight, trimmed to the states that have a weight.
+    //
+    std::shared_ptr<DenseActionRows> heaviestRange(ParseTable* prs, const std::vector<int>& weight,
+                                                   size_t byte_budget)
+    {
+        int n = static_cast<int>(weight.size()),
+            length = static_cast<int>(std::min(byte_budget / DenseActionRows::rowSize(prs), size_t(n)));
+        long long sum = 0,
+                  best = 0;
+        int best_first = 0;
+        for (int state = 0; state < n && length > 0; state++)
+        {
+            sum += weight[state];
+            if (state >= length)
+                sum -= weight[state - length];
+            if (sum > best)
+            {
+                best = sum;
+                best_first = std::max(0, state - length + 1);
+            }
+        }
+
+        int first = best_first,
+            last = (best > 0 ? best_first + length - 1 : -1);
+        while (first <= last && weight[first] == 0)
+            first++;
+        while (last >= first && weight[last] == 0)
+            last--;
+        std::vector<int> states = DenseActionRows::states(prs);
+        for (int state = first; state <= last; state++)
+        {
+            if (weight[state] > 0)
+                states.push_back(state);
+        }
+        return expand(prs, states, first, last);
+    }
+}
+
+size_t DenseActionRows::rowSize(ParseTable* prs)
+{
+    return (prs->getNtOffset() + 1) * sizeof(int);
+}
+
+std::vector<int> DenseActionRows::states(ParseTable* prs)
+{
+    //
+    // A state is identified by the offset of its goto row in baseAction,
+    // so that state numbers lie between NUM_RULES and ACCEPT_ACTION.
+    // When the table carries the error recovery maps, baseCheck[state] is
+    // the negated original state number, which identifies the states
+    // exactly. Otherwise, use the offsets that are the target of a shift
+    // or goto action (this may include a few unused offsets).
+    //
+    int num_rules = prs->getNumRules(),
+        accept_action = prs->getAcceptAction();
+    const signed int* base_check = prs->get_baseCheck_data();
+    int check_length = prs->get_baseCheck_length();
+    std::vector<int> result;
+    if (check_length > num_rules + 1)
+    {
+        for (int state = num_rules + 1; state < accept_action && state < check_length; state++)
+        {
+            if (base_check[state] < 0)
+                result.push_back(state);
+        }
+        return result;
+    }
+
+    std::vector<bool> is_target(accept_action, false);
+    is_target[prs->getStartState()] = true;
+    const signed int* term_action = prs->get_termAction_data();
+    for (int i = 0, n = prs->get_termAction_length(); i < n; i++)
+    {
+        if (term_action[i] > num_rules && term_action[i] < accept_action)
+            is_target[term_action[i]] = true;
+    }
+    const signed int* base_action = prs->get_baseAction_data();
+    for (int i = num_rules + 1, n = prs->get_baseAction_length(); i < n; i++)
+    {
+        if (base_action[i] > num_rules && base_action[i] < accept_action)
+            is_target[base_action[i]] = true;
+    }
+    for (int state = num_rules + 1; state < accept_action; state++)
+    {
+        if (is_target[state])
+            result.push_back(state);
+    }
+    return result;
+}
+
+std::shared_ptr<DenseActionRows> DenseActionRows::fromStates(ParseTable* prs, const std::vector<int>& states)
+{
+    int accept_action = prs->getAcceptAction(),
+        first = accept_action,
+        last = -1;
+    for (int state : states)
+    {
+        if (state >= 0 && state < accept_action)
+        {
+            first = std::min(first, state);
+            last = std::max(last, state);
+        }
+    }
+
+    //
+    // A state of the range that is not given still needs its row.
+    //
+    std::vector<int> expanded = DenseActionRows::states(prs);
+    expanded.insert(expanded.end(), states.begin(), states.end());
+    return expand(prs, expanded, first, last);
+}
+
+std::shared_ptr<DenseActionRows> DenseActionRows::fromProfile(ParseTable* prs, const std::vector<int>& visits,
+                                                              size_t byte_budget)
+{
+    std::vector<int> weight(prs->getAcceptAction());
+    for (int state = 0; state < static_cast<int>(visits.size()) && state < prs->getAcceptAction(); state++)
+        weight[state] = visits[state];
+    return heaviestRange(prs, weight, byte_budget);
+}
+
+std::shared_ptr<DenseActionRows> DenseActionRows::fromBudget(ParseTable* prs, size_t byte_budget)
+{
+    int width = prs->getNtOffset() + 1;
+    std::vector<int> weight(prs->getAcceptAction());
+    for (int state : states(prs))
+        weight[state] = explicitActions(prs, state, width);
+    return heaviestRange(prs, weight, byte_budget);
+}
+
+void DenseActionRows::install(ParseTable* prs, std::shared_ptr<DenseActionRows> rows)
+{
+    std::lock_guard<std::mutex> guard(registry_lock);
+    if (rows)
+        registry[prs] = rows;
+    else registry.erase(prs);
+}
+
+std::shared_ptr<DenseActionRows> DenseActionRows::find(ParseTable* prs)
+{
+    std::lock_guard<std::mutex> guard(registry_lock);
+    auto it = registry.find(prs);
+    return (it == registry.end() ? nullptr : it->second);
+}
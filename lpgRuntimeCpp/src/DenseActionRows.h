@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+struct ParseTable;
+
+//
+// Optional acceleration layer for ParseTableProxy::tAction.
+//
+// The compressed terminal action table needs three dependent loads per
+// lookup: _baseAction[state], _termCheck[k] and _termAction[...]. For the
+// states selected here, the full row of terminal actions is expanded into
+// a dense [state][terminal] array, so that the lookup is a single load.
+// All the other states keep using the compressed tables.
+//
+// The rows are built once per table and installed in a process wide
+// registry. Every ParseTableProxy built afterwards over that table (and
+// thus DeterministicParser, BacktrackingParser and LexParser) picks them up
+// transparently, and so does every parser specialized on the table class
+// (DeterministicParserT, ...) reset afterwards (see ParseTableT):
+//
+//     DenseActionRows::install(prs, DenseActionRows::fromBudget(prs, 64 * 1024));
+//
+// Lexer tables are especially suitable because their terminal alphabet
+// (the character classes) is small, so that every state usually fits.
+//
+struct DenseActionRows
+{
+    //
+    // The rows of the state numbers firstState .. firstState + count - 1,
+    // one after the other, each with width entries (one for each terminal
+    // symbol 0..NT_OFFSET). The action of state on sym is
+    // actions[(state - firstState) * width + sym].
+    //
+    // LPG numbers a state by the offset of its goto row in baseAction, so
+    // the state numbers are not consecutive. The numbers in between, which
+    // are not states, have a row of error actions that is never read.
+    //
+    int firstState = 0;
+    int count = 0;
+    int width = 0;
+    std::vector<int> actions;
+
+    //
+    // The state numbers of prs.
+    //
+    static std::vector<int> states(ParseTable* prs);
+
+    //
+    // Expand the rows of the state numbers from the least to the greatest
+    // of the given states.
+    //
+    static std::shared_ptr<DenseActionRows> fromStates(ParseTable* prs, const std::vector<int>& states);
+
+    //
+    // Expand the range of state numbers, within byte_budget bytes, that
+    // the most visits fall in, as given by a profile of the number of
+    // visits per state (indexed by state number).
+    //
+    static std::shared_ptr<DenseActionRows> fromProfile(ParseTable* prs, const std::vector<int>& visits,
+                                                        size_t byte_budget);
+
+    //
+    // Without a profile, expand the range of state numbers, within
+    // byte_budget bytes, whose states have the most explicit terminal
+    // actions.
+    //
+    static std::shared_ptr<DenseActionRows> fromBudget(ParseTable* prs, size_t byte_budget);
+
+    //
+    // Bytes used by one row of the table prs.
+    //
+    static size_t rowSize(ParseTable* prs);
+
+    //
+    // Register rows for prs (nullptr to remove them). Only the proxies
+    // built after this call use them (see above for the specialized
+    // parsers).
+    //
+    static void install(ParseTable* prs, std::shared_ptr<DenseActionRows> rows);
+
+    static std::shared_ptr<DenseActionRows> find(ParseTable* prs);
+};
@@ -1,5 +1,8 @@
 #pragma once
+#include "LookaheadCache.h"
+#include "PrsStream.h"
 #include "Stacks.h"
+#include "UnitReductions.h"
 #include "tuple.h"
 
 
@@ -12,7 +15,7 @@ struct Monitor;
 struct DeterministicParser :
     public Stacks
 {
-	~DeterministicParser();
+	virtual ~DeterministicParser();
     bool taking_actions = false;
     int markerKind = 0;
 
@@ -34,9 +37,32 @@ struct DeterministicParser :
     std::shared_ptr< IntTuple> action ;
 
     TokenStream*  tokStream=nullptr;
+
+    //
+    // tokStream, if it is a PrsStream, whose getKind the driver loops then
+    // call without a virtual call; otherwise nullptr.
+    //
+    PrsStream* prsStream = nullptr;
+
+    int kindOf(int token)
+    {
+        return prsStream != nullptr ? prsStream->getKind(token) : tokStream->getKind(token);
+    }
    
     RuleAction*  ra = nullptr;
     ParseTableProxy* prs = nullptr;
+    //
+    // Lookahead resolutions already computed for this parse table.
+    //
+    LookaheadCache laCache;
+
+    //
+    // Chains of unit reductions without action, skipped by processReductions,
+    // and chains of unit reductions skipped by recognizeReductions.
+    //
+    UnitReductions unitReductions;
+    UnitReductions trialUnitReductions;
+
     //
     // keep looking ahead until we compute a valid action
     //
@@ -66,6 +92,28 @@ struct DeterministicParser :
     //
     void processReductions();
 
+    //
+    // Process reductions without actions and return the next action.
+    //
+    int recognizeReductions(int act);
+
+    //
+    // The driver loops, defined in DeterministicParserT.h. They read the
+    // lookups and constants (tAction, NUM_RULES, ...) of table: *prs for
+    // the functions of this class, the ParseTableT of its Prs for a
+    // DeterministicParserT. The rule actions are those of actions (see
+    // applyRuleAction).
+    //
+    template <class Table> int lookaheadWith(Table& table, int act, int token);
+    template <class Table> int tActionWith(Table& table, int act, int sym);
+    template <class Table> int tActionWith(Table& table, int act, std::vector<int>& sym, int index);
+    template <class Table, class Actions> void processReductionsWith(Table& table, Actions* actions);
+    template <class Table> int recognizeReductionsWith(Table& table, int act);
+    template <class Table> int recognizeEntryWith(Table& table, int marker_kind);
+    template <class Table, class Actions> Object* parseEntryWith(Table& table, Actions* actions, int marker_kind);
+    template <class Table, class Actions> Object* parseActionsWith(Table& table, Actions* actions);
+    template <class Table> int parseWith(Table& table, std::vector<int>& sym, int index);
+
     //
     // The following functions can be invoked only when the parser is
     // processing actions. Thus, they can be invoked when the parser
@@ -126,7 +174,21 @@ struct DeterministicParser :
     //
     //
     //
-    Object* parseEntry(int marker_kind);
+    virtual Object* parseEntry(int marker_kind);
+
+    //
+    // Recognition only: run the automaton on the input without calling
+    // the rule actions and without building the location and parse stacks.
+    // Returns 0 if the input is accepted; otherwise, the token on which
+    // the error was detected (or the current token, if the monitor
+    // cancelled the parse).
+    //
+    int recognize()
+    {
+        return recognizeEntry(0);
+    }
+
+    virtual int recognizeEntry(int marker_kind);
 
     //
     // This method is invoked when using the parser in an incremental mode
@@ -170,11 +232,11 @@ struct DeterministicParser :
     // proper configuration by initially invoking the method resetParser
     // prior to invoking this function.
     //
-    int parse(std::vector<int>& sym, int index);
+    virtual int parse(std::vector<int>& sym, int index);
 
     //
     // Now do the  parse of the input based on the actions in
     // the list "action" and the sequence of tokens in the token stream.
     //
-    Object* parseActions();
+    virtual Object* parseActions();
 };
@@ -0,0 +1,514 @@
+#pragma once
+#include "DeterministicParser.h"
+#include "Exception.h"
+#include "Monitor.h"
+#include "ParseTableT.h"
+#include "RuleAction.h"
+#include "TokenStream.h"
+
+//
+// The driver loops of DeterministicParser, written once for the tables
+// whose lookups and constants are only known at run time (ParseTableProxy)
+// and for those known at compile time (ParseTableT). The member functions
+// of DeterministicParser call them with *prs and ra; DeterministicParserT,
+// below, with the ParseTableT of its Prs and its Actions, so that the
+// compiler can inline the lookups, fold the constants and call the rule
+// actions without a virtual call.
+//
+
+//
+// keep looking ahead until we compute a valid action
+//
+template <class Table>
+int DeterministicParser::lookaheadWith(Table& table, int act, int token)
+{
+    return laCache.lookahead(tokStream, table.LA_STATE_OFFSET, act, token,
+                             [&table](int la_state, int sym) { return table.lookAhead(la_state, sym); });
+}
+
+//
+// Compute the next action defined on act and sym. If this
+// action requires more lookahead, these lookahead symbols
+// are in the token stream beginning at the next token that
+// is yielded by peek().
+//
+template <class Table>
+int DeterministicParser::tActionWith(Table& table, int act, int sym)
+{
+    act = table.tAction(act, sym);
+    if (table.MAX_LA > 1 && act > table.LA_STATE_OFFSET)
+        return lookaheadWith(table, act, tokStream->peek());
+    return act;
+}
+
+//
+// Compute the next action defined on act and the next k tokens
+// whose types are stored in the circular buffer sym starting at
+// location index.
+//
+template <class Table>
+int DeterministicParser::tActionWith(Table& table, int act, std::vector<int>& sym, int index)
+{
+    act = table.tAction(act, sym[index]);
+    if (table.MAX_LA > 1)
+    {
+        while (act > table.LA_STATE_OFFSET)
+        {
+            index = ((index + 1) % sym.size());
+            act = table.lookAhead(act - table.LA_STATE_OFFSET, sym[index]);
+        }
+    }
+    return act;
+}
+
+//
+// Process reductions and continue...
+//
+template <class Table, class Actions>
+void DeterministicParser::processReductionsWith(Table& table, Actions* actions)
+{
+    do
+    {
+        stateStackTop -= (table.rhs(currentAction) - 1);
+        applyRuleAction(actions, currentAction);
+        int state = frameState(stateStackTop),
+            symbol = table.lhs(currentAction);
+        currentAction = unitReductions.collapse(state, symbol, table.ntAction(state, symbol),
+                                                [&table](int s, int a) { return table.ntAction(s, a); },
+                                                [&table](int rule) { return table.lhs(rule); });
+    }
+    while (currentAction <= table.NUM_RULES);
+}
+
+//
+// Process reductions without actions and return the next action.
+//
+template <class Table>
+int DeterministicParser::recognizeReductionsWith(Table& table, int act)
+{
+    do
+    {
+        stateStackTop -= (table.rhs(act) - 1);
+        int state = stateStack[stateStackTop],
+            symbol = table.lhs(act);
+        act = trialUnitReductions.collapse(state, symbol, table.ntAction(state, symbol),
+                                           [&table](int s, int a) { return table.ntAction(s, a); },
+                                           [&table](int rule) { return table.lhs(rule); });
+    }
+    while (act <= table.NUM_RULES);
+    return act;
+}
+
+template <class Table>
+int DeterministicParser::recognizeEntryWith(Table& table, int marker_kind)
+{
+    //
+    // Reset the token stream and get the first token.
+    //
+    tokStream->reset();
+    int curtok,
+        current_kind;
+    if (marker_kind == 0)
+    {
+        curtok = tokStream->getToken();
+        current_kind = kindOf(curtok);
+    }
+    else
+    {
+        curtok = tokStream->getPrevious(tokStream->peek());
+        current_kind = marker_kind;
+    }
+
+    if (stateStack.Size() == 0)
+        reallocateStateStack(); // make initial allocation
+    stateStackTop = -1;
+    int act = table.START_STATE;
+
+    for (;;)
+    {
+        //
+        // if the parser needs to stop processing,
+        // it may do so here.
+        //
+        if (monitor != nullptr && monitor->isCancelled())
+            return curtok;
+
+        if (++stateStackTop >= stateStack.Size())
+            reallocateStateStack();
+        stateStack[stateStackTop] = act;
+
+        act = tActionWith(table, act, current_kind);
+
+        if (act <= table.NUM_RULES)
+        {
+            stateStackTop--; // make reduction look like a shift-reduce
+            act = recognizeReductionsWith(table, act);
+        }
+        else if (act > table.ERROR_ACTION)
+        {
+            curtok = tokStream->getToken();
+            current_kind = kindOf(curtok);
+            act = recognizeReductionsWith(table, act - table.ERROR_ACTION);
+        }
+        else if (act < table.ACCEPT_ACTION)
+        {
+            curtok = tokStream->getToken();
+            current_kind = kindOf(curtok);
+        }
+        else break;
+    }
+
+    return (act == table.ERROR_ACTION ? curtok : 0);
+}
+
+template <class Table, class Actions>
+Object* DeterministicParser::parseEntryWith(Table& table, Actions* actions, int marker_kind)
+{
+    //
+    // Indicate that we are running the regular parser and that it's
+    // ok to use the utility functions to query the parser.
+    //
+    taking_actions = true;
+
+    //
+    // Reset the token stream and get the first token.
+    //
+    tokStream->reset();
+    lastToken = tokStream->getPrevious(tokStream->peek());
+    int curtok,
+        current_kind;
+    if (marker_kind == 0)
+    {
+        curtok = tokStream->getToken();
+        current_kind = kindOf(curtok);
+    }
+    else
+    {
+        curtok = lastToken;
+        current_kind = marker_kind;
+    }
+
+    //
+    // Start parsing.
+    //
+    reallocateStacks(); // make initial allocation
+    stateStackTop = -1;
+    currentAction = table.START_STATE;
+
+    for (;;)
+    {
+        //
+        // if the parser needs to stop processing,
+        // it may do so here.
+        //
+        if (monitor != nullptr && monitor->isCancelled())
+        {
+            taking_actions = false; // indicate that we are done
+            return nullptr;
+        }
+
+        if (++stateStackTop >= frameStackSize())
+            reallocateStacks();
+        frameState(stateStackTop) = currentAction;
+        frameLocation(stateStackTop) = curtok;
+
+        currentAction = tActionWith(table, currentAction, current_kind);
+
+        if (currentAction <= table.NUM_RULES)
+        {
+            stateStackTop--; // make reduction look like a shift-reduce
+            processReductionsWith(table, actions);
+        }
+        else if (currentAction > table.ERROR_ACTION)
+        {
+            lastToken = curtok;
+            curtok = tokStream->getToken();
+            current_kind = kindOf(curtok);
+            currentAction -= table.ERROR_ACTION;
+            processReductionsWith(table, actions);
+        }
+        else if (currentAction < table.ACCEPT_ACTION)
+        {
+            lastToken = curtok;
+            curtok = tokStream->getToken();
+            current_kind = kindOf(curtok);
+        }
+        else break;
+    }
+
+    taking_actions = false; // indicate that we are done
+
+    if (currentAction == table.ERROR_ACTION)
+        throw BadParseException(curtok);
+
+    return frameSym(marker_kind == 0 ? 0 : 1);
+}
+
+template <class Table, class Actions>
+Object* DeterministicParser::parseActionsWith(Table& table, Actions* actions)
+{
+    //
+    // Indicate that we are processing actions now (for the incremental
+    // parser) and that it's ok to use the utility functions to query the
+    // parser.
+    //
+    taking_actions = true;
+
+    tokStream->reset();
+    lastToken = tokStream->getPrevious(tokStream->peek());
+    int curtok = (markerKind == 0 ? tokStream->getToken() : lastToken);
+
+    try
+    {
+        //
+        // Reparse the input...
+        //
+        stateStackTop = -1;
+        currentAction = table.START_STATE;
+
+        for (int i = 0; i < action->size(); i++)
+        {
+            //
+            // if the parser needs to stop processing, it may do so here.
+            //
+            if (monitor != nullptr && monitor->isCancelled())
+            {
+                taking_actions = false; // indicate that we are done
+                return nullptr;
+            }
+
+            frameState(++stateStackTop) = currentAction;
+            frameLocation(stateStackTop) = curtok;
+
+            currentAction = action->get(i);
+            if (currentAction <= table.NUM_RULES) // a reduce action?
+            {
+                stateStackTop--; // turn reduction into shift-reduction
+                processReductionsWith(table, actions);
+            }
+            else // a shift or shift-reduce action
+            {
+                lastToken = curtok;
+                curtok = tokStream->getToken();
+                if (currentAction > table.ERROR_ACTION) // a shift-reduce action?
+                {
+                    currentAction -= table.ERROR_ACTION;
+                    processReductionsWith(table, actions);
+                }
+            }
+        }
+    }
+    catch (std::exception&) // if any exception is thrown, indicate BadParse
+    {
+        taking_actions = false; // indicate that we are done.
+        throw BadParseException(curtok);
+    }
+
+    taking_actions = false; // indicate that we are done.
+
+    action = nullptr; // turn into garbage
+    return frameSym(markerKind == 0 ? 0 : 1);
+}
+
+//
+// Incremental LALR(k) entry point; see DeterministicParser::parse.
+//
+template <class Table>
+int DeterministicParser::parseWith(Table& table, std::vector<int>& sym, int index)
+{
+    //
+    // First, we save the current length of the action tuple, in
+    // case an error is encountered and we need to restore the
+    // original configuration.
+    //
+    // Next, we declara and initialize the variable pos which will
+    // be used to indicate the highest useful position in stateStack
+    // as we are simulating the actions induced by the next k input
+    // terminals in sym.
+    //
+    // The location stack will be used here as a temporary stack
+    // to simulate these actions. We initialize its first useful
+    // offset here.
+    //
+    int save_action_length = action->size(),
+        pos = stateStackTop,
+        location_top = stateStackTop - 1;
+
+    //
+    // When a reduce action is encountered, we compute all REDUCE
+    // and associated goto actions induced by the current token.
+    // Eventually, a SHIFT, SHIFT-REDUCE, ACCEPT or ERROR action is
+    // computed...
+    //
+    for (currentAction = tActionWith(table, stateStack[stateStackTop], sym, index);
+         currentAction <= table.NUM_RULES;
+         currentAction = tActionWith(table, currentAction, sym, index))
+    {
+        action->add(currentAction);
+        do
+        {
+            location_top -= (table.rhs(currentAction) - 1);
+            int state = (location_top > pos
+                             ? locationStack[location_top]
+                             : stateStack[location_top]);
+            currentAction = table.ntAction(state, table.lhs(currentAction));
+        }
+        while (currentAction <= table.NUM_RULES);
+
+        //
+        // ... Update the maximum useful position of the
+        // stateSTACK, push goto state into stack, and
+        // continue by compute next action on current symbol
+        // and reentering the loop...
+        //
+        pos = pos < location_top ? pos : location_top;
+        if (location_top + 1 >= locationStack.Size())
+            reallocateStacks();
+        locationStack[location_top + 1] = currentAction;
+    }
+
+    //
+    // At this point, we have a shift, shift-reduce, accept or error
+    // action. stateSTACK contains the configuration of the state stack
+    // prior to executing any action on the currenttoken. locationStack
+    // contains the configuration of the state stack after executing all
+    // reduce actions induced by the current token. The variable pos
+    // indicates the highest position in the stateSTACK that is still
+    // useful after the reductions are executed.
+    //
+    if (currentAction > table.ERROR_ACTION || // SHIFT-REDUCE action ?
+        currentAction < table.ACCEPT_ACTION) // SHIFT action ?
+    {
+        action->add(currentAction);
+        //
+        // If no error was detected, update the state stack with
+        // the info that was temporarily computed in the locationStack.
+        //
+        stateStackTop = location_top + 1;
+        for (int i = pos + 1; i <= stateStackTop; i++)
+            stateStack[i] = locationStack[i];
+
+        //
+        // If we have a shift-reduce, process it as well as
+        // the goto-reduce actions that follow it.
+        //
+        if (currentAction > table.ERROR_ACTION)
+        {
+            currentAction -= table.ERROR_ACTION;
+            do
+            {
+                stateStackTop -= (table.rhs(currentAction) - 1);
+                currentAction = table.ntAction(stateStack[stateStackTop],
+                                               table.lhs(currentAction));
+            }
+            while (currentAction <= table.NUM_RULES);
+        }
+
+        //
+        // Process the transition - either a shift action of
+        // if we started out with a shift-reduce, the GOTO
+        // action that follows it.
+        //
+        if (++stateStackTop >= stateStack.Size())
+            reallocateStacks();
+        stateStack[stateStackTop] = currentAction;
+    }
+    else if (currentAction == table.ERROR_ACTION)
+        action->reset(save_action_length); // restore original action state.
+    return currentAction;
+}
+
+//
+// DeterministicParser specialized at compile time on a generated parse
+// table class Prs (e.g. ExprParserprs) and on the concrete rule action
+// class Actions (e.g. ExprParser).
+//
+// When it is reset with a Prs, it runs the driver loops above with the
+// ParseTableT of Prs and dispatches the rule actions with a qualified
+// call to Actions::ruleAction, so Actions should be the most derived class
+// that implements ruleAction. With a table of another class (e.g. a
+// BinaryParseTable or a ParseTableLayout), it runs those of
+// DeterministicParser, over the table it was given.
+//
+// Everything else (the utility functions used by the rule actions, error
+// recovery, the ParseTable* given to diagnosis) is inherited from
+// DeterministicParser, so a DeterministicParserT can be used anywhere a
+// DeterministicParser* is expected.
+//
+template <class Prs, class Actions>
+struct DeterministicParserT :
+    public DeterministicParser
+{
+    typedef ParseTableT<Prs> Table;
+
+    static_assert(!Table::BACKTRACK, "Regenerate the parse table with the -NOBACKTRACK option");
+
+    Table table;
+    Actions* actions = nullptr;
+
+    //
+    // true if the parser was reset with a Prs.
+    //
+    bool specialized = false;
+
+    DeterministicParserT() = default;
+
+    DeterministicParserT(TokenStream* tokStream, Actions* ra)
+    {
+        reset(nullptr, tokStream, Table::instance(), ra);
+    }
+
+    DeterministicParserT(TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(nullptr, tokStream, prs, ra);
+    }
+
+    DeterministicParserT(Monitor* monitor, TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(monitor, tokStream, prs, ra);
+    }
+
+    using DeterministicParser::reset;
+
+    void reset(Monitor* monitor, TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        specialized = dynamic_cast<Prs*>(prs) != nullptr;
+        if (specialized)
+            table.prepare(prs);
+        DeterministicParser::reset(monitor, tokStream, prs, ra);
+        this->actions = ra;
+    }
+
+    void reset(TokenStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(nullptr, tokStream, prs, ra);
+    }
+
+    int recognizeEntry(int marker_kind) override
+    {
+        return specialized
+                   ? recognizeEntryWith(table, marker_kind)
+                   : DeterministicParser::recognizeEntry(marker_kind);
+    }
+
+    Object* parseEntry(int marker_kind) override
+    {
+        return specialized
+                   ? parseEntryWith(table, actions, marker_kind)
+                   : DeterministicParser::parseEntry(marker_kind);
+    }
+
+    Object* parseActions() override
+    {
+        return specialized
+                   ? parseActionsWith(table, actions)
+                   : DeterministicParser::parseActions();
+    }
+
+    int parse(std::vector<int>& sym, int index) override
+    {
+        return specialized
+                   ? parseWith(table, sym, index)
+                   : DeterministicParser::parse(sym, index);
+    }
+};
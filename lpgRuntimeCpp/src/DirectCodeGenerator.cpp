@@ -0,0 +1,149 @@
+#include "DirectCodeGenerator.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "DenseActionRows.h"
+#include "ParseTable.h"
+
+namespace
+{
+    struct Generator
+    {
+        ParseTable* prs;
+        std::ostream& out;
+        int check_length,
+            action_length,
+            nt_offset;
+        const signed int* term_check;
+        const signed int* term_action;
+
+        //
+        // Write the switch of the terminal actions of each row. rows maps
+        // the offset of a row in _termCheck/_termAction to the states (or
+        // lookahead states) that use it.
+        //
+        void writeSwitch(const char* function, const char* variable, const std::map<int, std::vector<int>>& rows,
+                         const char* fallback)
+        {
+            out << "    static int " << function << "(int " << variable << ", int sym)\n"
+                << "    {\n"
+                << "        switch (" << variable << ")\n"
+                << "        {\n";
+            for (auto& row : rows)
+            {
+                for (int state : row.second)
+                    out << "            case " << state << ":\n";
+
+                int base = row.first,
+                    default_action = term_action[base];
+                std::vector<int> syms;
+                for (int sym = 1; sym <= nt_offset; sym++)
+                {
+                    int k = base + sym;
+                    if (k < check_length && k < action_length && term_check[k] == sym && term_action[k] != default_action)
+                        syms.push_back(sym);
+                }
+
+                if (syms.empty())
+                {
+                    out << "                return " << default_action << ";\n";
+                    continue;
+                }
+                //
+                // Terminals that have the same action share their case.
+                //
+                std::map<int, std::vector<int>> groups;
+                for (int sym : syms)
+                    groups[term_action[base + sym]].push_back(sym);
+                std::vector<std::pair<int, int>> order; // (first terminal, action)
+                for (auto& group : groups)
+                    order.push_back({ group.second[0], group.first });
+                std::sort(order.begin(), order.end());
+
+                out << "                switch (sym)\n"
+                    << "                {\n";
+                for (auto& entry : order)
+                {
+                    auto& group = groups[entry.second];
+                    for (size_t i = 0; i < group.size(); i++)
+                        out << (i % 8 == 0 ? (i == 0 ? "                    " : "\n                    ") : " ")
+                            << "case " << group[i] << ":";
+                    out << " return " << entry.second << ";\n";
+                }
+                out << "                    default: return " << default_action << ";\n"
+                    << "                }\n";
+            }
+            out << "            default:\n"
+                << "            {\n"
+                << fallback
+                << "            }\n"
+                << "        }\n"
+                << "    }\n";
+        }
+    };
+}
+
+bool DirectCodeGenerator::generate(ParseTable* prs, const std::string& prsClass, const std::string& className,
+                                   std::ostream& out)
+{
+    int check_length = prs->get_termCheck_length(),
+        action_length = prs->get_termAction_length(),
+        base_action_length = prs->get_baseAction_length();
+    if (check_length == 0 || action_length == 0 || base_action_length == 0)
+        return false;
+
+    Generator generator{ prs, out, check_length, action_length, prs->getNtOffset(),
+                         prs->get_termCheck_data(), prs->get_termAction_data() };
+    const signed int* base_action = prs->get_baseAction_data();
+    int la_state_offset = prs->getLaStateOffset();
+
+    std::map<int, std::vector<int>> state_rows;
+    for (int state : DenseActionRows::states(prs))
+    {
+        if (state < base_action_length)
+            state_rows[base_action[state]].push_back(state);
+    }
+
+    std::set<int> la_states;
+    for (int i = 0; i < action_length; i++)
+    {
+        if (generator.term_action[i] > la_state_offset)
+            la_states.insert(generator.term_action[i] - la_state_offset);
+    }
+    std::map<int, std::vector<int>> la_rows;
+    for (int la_state : la_states)
+    {
+        if (la_state < check_length && la_state < action_length)
+            la_rows[la_state].push_back(la_state);
+    }
+
+    out << "#pragma once\n"
+        << "#include \"GeneratedParseTable.h\"\n"
+        << "#include \"" << prsClass << ".h\"\n"
+        << "\n"
+        << "//\n"
+        << "// Direct-coded terminal actions of " << prsClass << ", written by\n"
+        << "// DirectCodeGenerator. Do not edit: regenerate it with the table.\n"
+        << "//\n"
+        << "struct " << className << " :public GeneratedParseTable<" << prsClass << ">\n"
+        << "{\n"
+        << "    constexpr static bool DIRECT_CODED = true;\n"
+        << "\n";
+    generator.writeSwitch("directTAction", "state", state_rows,
+                          "                int i = _baseAction[state],\n"
+                          "                    k = i + sym;\n"
+                          "                return _termAction[_termCheck[k] == sym ? k : i];\n");
+    out << "\n";
+    generator.writeSwitch("directLookAhead", "la_state", la_rows,
+                          "                int k = la_state + sym;\n"
+                          "                return _termAction[_termCheck[k] == sym ? k : la_state];\n");
+    out << "\n"
+        << "    int tAction(int state, int sym) override { return directTAction(state, sym); }\n"
+        << "\n"
+        << "    int lookAhead(int la_state, int sym) override { return directLookAhead(la_state, sym); }\n"
+        << "};\n";
+    return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <ostream>
+#include <string>
+
+struct ParseTable;
+
+//
+// Generator of direct-coded terminal actions for a parse table.
+//
+// Given a ParseTable and the name of its generated *prs class, generate
+// writes a header that defines a class derived from the *prs class (as a
+// GeneratedParseTable, which reports the length of its arrays) in which
+// the terminal actions of each state, and of each lookahead state, are a
+// switch block instead of a lookup in the compressed _baseAction,
+// _termCheck and _termAction arrays (in the way re2c codes the states of a
+// lexer):
+//
+//     std::ofstream out("JavaLexerdirect.h");
+//     GeneratedParseTable<JavaLexerprs> table;
+//     DirectCodeGenerator::generate(&table, "JavaLexerprs", "JavaLexerdirect", out);
+//
+// JavaExample -direct, LpgExample -direct and ExampleExpr -direct are such
+// drivers; they wrote JavaLexerdirect.h and LPGLexerdirect.h, on which
+// JavaLexer and LPGLexer are specialized, and ExprParserdirect.h.
+//
+// The generated class marks itself with DIRECT_CODED, which ParseTableT
+// recognizes: the parsers and lexers specialized at compile time on it
+// (LexParserT<JavaLexerLpgLexStream, JavaLexerdirect, JavaLexer>,
+// DeterministicParserT<ExprParserdirect, ExprParser>, ...) have their
+// shift and reduce decisions inlined in the driver loop, and still call
+// the rule actions through the Actions class (RuleAction). It also
+// overrides the virtual tAction and lookAhead of ParseTable, so that it
+// can be used wherever the *prs class is.
+//
+// Goto actions (ntAction) are left to _baseAction: they are a single
+// unchecked load. The states that get a switch case are those of
+// DenseActionRows::states, which derives them from the shift and goto
+// actions when the table has no error recovery maps, as for the lexer
+// tables. Any other state falls back to the compressed tables, so that
+// the generated code is correct for any table.
+//
+struct DirectCodeGenerator
+{
+    //
+    // Write the header of class className, derived from prsClass, whose
+    // tables are those of prs. Returns false if prs does not report the
+    // length of its arrays.
+    //
+    static bool generate(ParseTable* prs, const std::string& prsClass, const std::string& className,
+                         std::ostream& out);
+};
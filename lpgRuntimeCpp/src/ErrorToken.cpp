@@ -25,3 +25,13 @@ std::vector<IToken*> ErrorToken::getFollowingAdjuncts()
 	return lastToken->getFollowingAdjuncts();
 }
 
+AdjunctRange ErrorToken::getPrecedingAdjunctRange()
+{
+	return firstToken->getPrecedingAdjunctRange();
+}
+
+AdjunctRange ErrorToken::getFollowingAdjunctRange()
+{
+	return lastToken->getFollowingAdjunctRange();
+}
+
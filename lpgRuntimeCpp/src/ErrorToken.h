@@ -38,5 +38,7 @@ struct ErrorToken :
 
     std::vector<IToken*> getPrecedingAdjuncts();
     std::vector<IToken*> getFollowingAdjuncts();
+    AdjunctRange getPrecedingAdjunctRange();
+    AdjunctRange getFollowingAdjunctRange();
 };
 
@@ -152,6 +152,27 @@ struct BadParseSymFileException :public std::exception
     }
     std::string toString() { return str; }
 };
+struct BadParseTableFileException :public std::exception
+{
+    /**
+     *
+     */
+    char const* what() const override
+    {
+        return  str.c_str();
+    }
+    std::string str;
+
+    BadParseTableFileException()
+    {
+        str = "BadParseTableFileException";
+    }
+    BadParseTableFileException(const std::string& str)
+    {
+        this->str = str;
+    }
+    std::string toString() { return str; }
+};
 struct TokenStreamNotIPrsStreamException :public std::exception
 {
     /**
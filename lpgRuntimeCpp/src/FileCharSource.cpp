@@ -0,0 +1,102 @@
+#include "FileCharSource.h"
+
+#include <sys/stat.h>
+#include <unicode/ucnv.h>
+
+#include "IcuUtil.h"
+
+FileCharSource::FileCharSource(const std::wstring& file_name) : bytes(CHUNK_SIZE)
+{
+	_wfopen_s(&file, file_name.c_str(), L"r");
+	if (file == nullptr)
+		return;
+
+	//
+	// A file has no more UTF-16 characters than it has bytes.
+	//
+	struct _stat32 statbuf;
+	if (_wstat32(file_name.c_str(), &statbuf) == 0)
+		length_hint = statbuf.st_size;
+}
+
+FileCharSource::~FileCharSource()
+{
+	if (converter != nullptr)
+		ucnv_close(converter);
+	if (file != nullptr)
+		fclose(file);
+}
+
+//
+// Read the next chunk of the file.
+//
+void FileCharSource::fill()
+{
+	size_t count = fread(bytes.data(), 1, bytes.size(), file);
+	next = bytes.data();
+	end = next + count;
+	at_end = (count < bytes.size());
+}
+
+//
+// Read the first chunk, and open the converter of the encoding that the
+// detector finds at its start, as getFileUnicodeContent does (see
+// IcuUtil::detectPrefixEncoding). The chunk is then converted as is.
+//
+bool FileCharSource::detect()
+{
+	static_assert(CHUNK_SIZE >= IcuUtil::DETECT_PREFIX_SIZE, "the first chunk holds the prefix of the file");
+
+	fill();
+	const std::string encoding = IcuUtil::detectPrefixEncoding(next, static_cast<int>(end - next));
+	UErrorCode status = U_ZERO_ERROR;
+	converter = ucnv_open(encoding.data(), &status);
+	if (U_FAILURE(status))
+	{
+		converter = nullptr;
+		return false;
+	}
+	return true;
+}
+
+int FileCharSource::read(wchar_t* buffer, int capacity)
+{
+	if (file == nullptr || failed)
+		return -1;
+	if (converter == nullptr && !detect())
+	{
+		failed = true;
+		return -1;
+	}
+
+	int count = 0;
+	while (count < capacity)
+	{
+		if (next == end)
+		{
+			//
+			// As in getFileUnicodeContent, the converter is not flushed:
+			// a character cut short by the end of the file is dropped.
+			//
+			if (at_end)
+				break;
+			fill();
+			continue;
+		}
+
+		//
+		// A character split at the end of a chunk is kept by the converter
+		// until the next chunk is converted.
+		//
+		UChar* target = reinterpret_cast<UChar*>(buffer + count);
+		UErrorCode status = U_ZERO_ERROR;
+		ucnv_toUnicode(converter, &target, reinterpret_cast<UChar*>(buffer + capacity), &next, end,
+		               nullptr, false, &status);
+		count = static_cast<int>(reinterpret_cast<wchar_t*>(target) - buffer);
+		if (status == U_BUFFER_OVERFLOW_ERROR)
+			break;
+		if (U_FAILURE(status))
+			return -1;
+	}
+	return count;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ICharSource.h"
+
+struct UConverter;
+
+//
+// The characters of a file, read CHUNK_SIZE bytes at a time and converted
+// to UTF-16 as they are read, so that the bytes of the whole file are
+// never held next to its characters.
+//
+// The encoding is the one IcuUtil::getFileUnicodeContent finds: the
+// detector is given the first IcuUtil::DETECT_PREFIX_SIZE bytes of the
+// file, which the first chunk holds, before it is converted (see detect),
+// and the characters read are the ones getFileUnicodeContent would return.
+//
+struct FileCharSource : public ICharSource
+{
+	constexpr static int CHUNK_SIZE = 1 << 16;
+
+	explicit FileCharSource(const std::wstring& file_name);
+	~FileCharSource() override;
+
+	FileCharSource(const FileCharSource&) = delete;
+	FileCharSource& operator=(const FileCharSource&) = delete;
+
+	bool isOpen() const { return file != nullptr; }
+
+	int read(wchar_t* buffer, int capacity) override;
+
+	int getLengthHint() override { return length_hint; }
+
+private:
+	FILE* file = nullptr;
+	int length_hint = 0;
+
+	std::vector<char> bytes;
+	const char* next = nullptr; // the bytes read but not converted yet are [next, end)
+	const char* end = nullptr;
+	bool at_end = false;        // the last chunk was read
+
+	UConverter* converter = nullptr;
+	bool failed = false;
+
+	void fill();
+	bool detect();
+};
@@ -0,0 +1,58 @@
+#pragma once
+#include <iterator>
+
+#include "ParseTable.h"
+
+//
+// A generated *prs class (e.g. JavaParserprs), with the number of elements
+// of its arrays, which ParseTable reports as 0 by default.
+//
+// The generated classes publish their tables as "inline static" arrays
+// whose length is known at compile time, but do not report it. The parser
+// and lexer templates create their table as a GeneratedParseTable<Prs>, so
+// that the runtime can narrow its arrays (ParseTableProxy), find its dense
+// rows (DenseActionRows) or write it out (BinaryParseTable). An array that
+// Prs does not have (e.g. _asb in a lexer table) has the length 0.
+//
+// It is a Prs, so the parsers specialized on Prs (DeterministicParserT,
+// BacktrackingParserT, LexParserT) recognize it as their table.
+//
+template <class Prs>
+struct GeneratedParseTable :
+    public Prs
+{
+#define LPG_ARRAY_LENGTH(array)                                                             \
+    template <class P>                                                                      \
+    static auto array##Length(int) -> decltype(static_cast<int>(std::size(P::_##array)))     \
+    {                                                                                       \
+        return static_cast<int>(std::size(P::_##array));                                    \
+    }                                                                                       \
+    template <class P>                                                                      \
+    static int array##Length(...) { return 0; }                                             \
+    int get_##array##_length() override { return array##Length<Prs>(0); }
+
+    LPG_ARRAY_LENGTH(baseCheck)
+    LPG_ARRAY_LENGTH(baseAction)
+    LPG_ARRAY_LENGTH(termCheck)
+    LPG_ARRAY_LENGTH(termAction)
+    LPG_ARRAY_LENGTH(isNullable)
+    LPG_ARRAY_LENGTH(prosthesesIndex)
+    LPG_ARRAY_LENGTH(isKeyword)
+    LPG_ARRAY_LENGTH(asb)
+    LPG_ARRAY_LENGTH(asr)
+    LPG_ARRAY_LENGTH(nasb)
+    LPG_ARRAY_LENGTH(nasr)
+    LPG_ARRAY_LENGTH(terminalIndex)
+    LPG_ARRAY_LENGTH(nonterminalIndex)
+    LPG_ARRAY_LENGTH(scopePrefix)
+    LPG_ARRAY_LENGTH(scopeSuffix)
+    LPG_ARRAY_LENGTH(scopeLhs)
+    LPG_ARRAY_LENGTH(scopeLa)
+    LPG_ARRAY_LENGTH(scopeStateSet)
+    LPG_ARRAY_LENGTH(scopeRhs)
+    LPG_ARRAY_LENGTH(scopeState)
+    LPG_ARRAY_LENGTH(inSymb)
+    LPG_ARRAY_LENGTH(name)
+
+#undef LPG_ARRAY_LENGTH
+};
@@ -14,6 +14,8 @@ struct IAst:public   Object, virtual  IGetToken
    
     virtual std::vector<IToken*> getPrecedingAdjuncts() = 0;
     virtual  std::vector<IToken*> getFollowingAdjuncts() = 0;
+    virtual AdjunctRange getPrecedingAdjunctRange() { return getLeftIToken()->getPrecedingAdjunctRange(); }
+    virtual AdjunctRange getFollowingAdjunctRange() { return getRightIToken()->getFollowingAdjunctRange(); }
     virtual  std::vector<IAst*> getChildren() = 0;
     virtual std::vector<IAst*> getAllChildren() = 0;
     virtual void accept(IAstVisitor* v) = 0;
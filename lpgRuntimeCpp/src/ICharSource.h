@@ -0,0 +1,17 @@
+#pragma once
+
+//
+// Where a LexStream reads the characters of its input from, a chunk at a
+// time, instead of receiving them all at once (see
+// LexStream::initialize(ICharSource&, ...) and FileCharSource). read
+// decodes at most capacity characters into buffer and returns how many it
+// decoded: 0 at the end of the input, -1 if the input cannot be decoded.
+// getLengthHint returns how many characters the input has at most, or 0
+// if it does not know.
+//
+struct ICharSource
+{
+	virtual ~ICharSource() = default;
+	virtual int read(wchar_t* buffer, int capacity) = 0;
+	virtual int getLengthHint() { return 0; }
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include "AdjunctRange.h"
 #include "TokenStream.h"
 #include "tuple.h"
 
@@ -110,6 +111,14 @@ struct IPrsStream :public  TokenStream
 
     virtual std::vector<IToken*> getPrecedingAdjuncts(int i) =0;
 
+    //
+    // The same adjuncts, seen in place (see AdjunctRange). A stream that
+    // does not override them gets a copy of the vectors above.
+    //
+    virtual AdjunctRange getFollowingAdjunctRange(int i) { return AdjunctRange::copyOf(getFollowingAdjuncts(i)); }
+
+    virtual AdjunctRange getPrecedingAdjunctRange(int i) { return AdjunctRange::copyOf(getPrecedingAdjuncts(i)); }
+
     virtual    IToken* getIToken(int i)=0;
 
     virtual    std::wstring getTokenText(int i)=0;
@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 
+#include "AdjunctRange.h"
 #include "Object.h"
 
 
@@ -39,6 +40,13 @@ struct IToken :public Object
   virtual     std::vector<IToken*>  getPrecedingAdjuncts()=0;
   virtual     std::vector<IToken*> getFollowingAdjuncts()=0;
 
+  //
+  // The same adjuncts, seen in place (see AdjunctRange). A token that does
+  // not override them gets a copy of the vectors above.
+  //
+  virtual     AdjunctRange getPrecedingAdjunctRange() { return AdjunctRange::copyOf(getPrecedingAdjuncts()); }
+  virtual     AdjunctRange getFollowingAdjunctRange() { return AdjunctRange::copyOf(getFollowingAdjuncts()); }
+
   virtual     ILexStream* getILexStream()=0;
    
 
@@ -57,7 +65,11 @@ struct IToken :public Object
   void* getExtData() const;
  
 private:
-	struct Data;
-	Data* d_ptr;
+	//
+	// Kept in the token itself, not allocated, so that a token owns nothing
+	// and the tokens in the pool of a PrsStream can be released without
+	// running their destructors.
+	//
+	void* extData = nullptr;
 };
 
@@ -0,0 +1,13 @@
+#pragma once
+
+//
+// Where a PrsStream gets more of its tokens when they are lexed on demand
+// (see PrsStream::setTokenSource and PullLexer). Each call to lexMore adds
+// at least one token to the stream and updates its length, until it adds
+// the end-of-file token and detaches itself from the stream.
+//
+struct ITokenSource
+{
+	virtual ~ITokenSource() = default;
+	virtual void lexMore() = 0;
+};
@@ -53,6 +53,14 @@ namespace IcuUtil
 	return pair<string, int>({}, 0);
 	}
 
+	std::string detectPrefixEncoding(const char* data, int len)
+	{
+		const pair<string, int> detectResult = detectTextEncoding(data, len < DETECT_PREFIX_SIZE ? len : DETECT_PREFIX_SIZE);
+		if (detectResult.second > 70)
+			return detectResult.first;
+		return getDefaultEncoding();
+	}
+
 	std::string ws2s(std::wstring const& wstr)
 	{
 
@@ -111,7 +119,7 @@ namespace IcuUtil
 			return  encoding;
 		struct _stat32 statbuf;
 		_wstat32(fileName, &statbuf);
-		const auto bufsize = statbuf.st_size;
+		const auto bufsize = (statbuf.st_size < DETECT_PREFIX_SIZE ? statbuf.st_size : DETECT_PREFIX_SIZE);
 		char* buf = new char[bufsize];
 
 		uint32_t count = fread(buf, 1, bufsize, pFile);
@@ -138,14 +146,7 @@ namespace IcuUtil
 		uint32_t count = fread(&holder[0], 1, bufsize, pFile);
 		fclose(pFile);
 		holder.resize(count);
-		const pair<string, int> detectResult = detectTextEncoding(&holder[0], count);
-		std::string strEncoding;
-		if (detectResult.second > 70)
-			strEncoding = detectResult.first;
-		else
-		{
-			strEncoding = getDefaultEncoding();
-		}
+		const std::string strEncoding = detectPrefixEncoding(&holder[0], count);
 		content.resize(bufsize);
 	
 		bool flush = false;
@@ -21,6 +21,16 @@ pair<string, int> detectFileEncoding(const wchar_t*);
 // ̽һıı
 pair<string, int> detectTextEncoding(const char *data, int len);
 
+// The encoding of a file is detected on its first DETECT_PREFIX_SIZE bytes
+// only, so that the detector does not go over the whole of a large file.
+constexpr int DETECT_PREFIX_SIZE = 1 << 16;
+
+// The encoding of a text that starts with data[0..len): the one that the
+// detector finds in its first DETECT_PREFIX_SIZE bytes, or the default
+// encoding if the detector is not confident. getFileUnicodeContent and
+// FileCharSource read a file in this encoding.
+std::string detectPrefixEncoding(const char* data, int len);
+
 // ȡϵͳĬϵı
 const string &getDefaultEncoding();
 
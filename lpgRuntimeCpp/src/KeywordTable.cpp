@@ -0,0 +1,98 @@
+#include "KeywordTable.h"
+
+#include <algorithm>
+
+bool KeywordTable::add(const std::vector<unsigned char>& kinds, int rule, int num_rules)
+{
+    if (rule == 0)
+        return true;
+    if (rule > num_rules || kinds.size() > MAX_LENGTH || keywords.size() == MAX_KEYWORDS)
+        return false;
+
+    Keyword keyword{};
+    std::copy(kinds.begin(), kinds.end(), keyword.kinds);
+    keyword.length = static_cast<int>(kinds.size());
+    keyword.rule = rule;
+    keywords.push_back(keyword);
+
+    first_lengths[kinds.front()] |= std::uint64_t(1) << keyword.length;
+    last_lengths[kinds.back()] |= std::uint64_t(1) << keyword.length;
+    return true;
+}
+
+//
+// Hash and displace: the keywords are hashed to buckets of about 4, and,
+// from the largest bucket to the smallest, a seed is found for each bucket
+// that sends its keywords to slots that are still free. If some bucket
+// has no such seed, the number of slots is doubled and we start again.
+//
+bool KeywordTable::layOut()
+{
+    int count = static_cast<int>(keywords.size());
+    std::vector<std::uint64_t> hashes(count);
+    for (int i = 0; i < count; i++)
+        hashes[i] = hash(keywords[i].kinds, keywords[i].length);
+
+    int bucket_bits = 0;
+    while ((1 << bucket_bits) * 4 < count)
+        bucket_bits++;
+    bucket_mask = (std::uint64_t(1) << bucket_bits) - 1;
+
+    std::vector<std::vector<int>> buckets(std::size_t(1) << bucket_bits);
+    for (int i = 0; i < count; i++)
+        buckets[hashes[i] & bucket_mask].push_back(i);
+    std::vector<int> order(buckets.size());
+    for (int b = 0; b < (int) order.size(); b++)
+        order[b] = b;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return buckets[a].size() > buckets[b].size(); });
+
+    int slot_bits = 1;
+    while ((1 << slot_bits) < count + count / 4)
+        slot_bits++;
+
+    for (int attempt = 0; attempt < 4; attempt++, slot_bits++)
+    {
+        slot_shift = 64 - slot_bits;
+        slots.assign(std::size_t(1) << slot_bits, -1);
+        seeds.assign(buckets.size(), 0);
+
+        bool placed = true;
+        std::vector<int> targets;
+        for (int b : order)
+        {
+            const std::vector<int>& bucket = buckets[b];
+            if (bucket.empty())
+                break;
+
+            bool found = false;
+            for (std::uint32_t seed = 0; seed < (1u << 16) && !found; seed++)
+            {
+                seeds[b] = seed;
+                targets.clear();
+                found = true;
+                for (int i : bucket)
+                {
+                    int target = slot(hashes[i]);
+                    if (slots[target] >= 0 || std::find(targets.begin(), targets.end(), target) != targets.end())
+                    {
+                        found = false;
+                        break;
+                    }
+                    targets.push_back(target);
+                }
+            }
+            if (!found)
+            {
+                placed = false;
+                break;
+            }
+            for (int k = 0; k < (int) bucket.size(); k++)
+                slots[targets[k]] = bucket[k];
+        }
+        if (placed)
+            return true;
+    }
+
+    return false;
+}
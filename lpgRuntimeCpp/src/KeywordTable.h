@@ -0,0 +1,226 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "CharScanner.h"
+
+//
+// A perfect hash table of the keywords of a keyword lexer (the KWLexer
+// generated from KeywordTemplateF.gi), that classifies an identifier with
+// a hash of its characters and a single compare, instead of running the
+// keyword automaton on each of its characters.
+//
+// The keywords are not given as strings: they are the sequences of
+// character kinds for which the loop of the lexer returns a rule, found by
+// a walk of its tables when the table is built. Characters that the lexer
+// maps to the same kind (the upper and lower case letters in LPGKWLexer)
+// thus make a single entry. To classify an identifier, its characters are
+// mapped to their kinds, one byte each, and:
+//
+//     . if no keyword has the length of the identifier and starts and
+//       ends with its first and last kinds, it is not a keyword;
+//
+//     . otherwise the kinds are hashed to a bucket, and the seed of the
+//       bucket (hash and displace) to the only slot where the identifier
+//       can be. The kinds, padded to MAX_LENGTH bytes, are then compared
+//       to those of the keyword in the slot a vector at a time (see
+//       CharScanner).
+//
+// find returns the rule that the automaton reduces, or 0, so that the
+// kind of the token is keywordKind[find(...)] as before. The table is not
+// enabled, and the automaton must be run, if a keyword is longer than
+// MAX_LENGTH, if there are more than MAX_KEYWORDS of them, or if the
+// lexer does not map all the characters above 127 to one kind.
+//
+struct KeywordTable
+{
+    constexpr static int MAX_LENGTH = 32,
+                         MAX_KEYWORDS = 1 << 16;
+
+    bool enabled = false;
+
+    struct Keyword
+    {
+        unsigned char kinds[MAX_LENGTH];
+        int length;
+        int rule;
+    };
+    std::vector<Keyword> keywords;
+
+    //
+    // The kinds of the characters. Bit n of first_lengths[k] (last_lengths[k])
+    // is set if a keyword of length n starts (ends) with kind k.
+    //
+    unsigned char ascii_kinds[128]{};
+    unsigned char other_kind = 0;
+    std::uint64_t first_lengths[256]{},
+                  last_lengths[256]{};
+
+    //
+    // The seed of each bucket, and the keyword in each slot (or -1).
+    //
+    std::vector<std::uint32_t> seeds;
+    std::vector<int> slots;
+    std::uint64_t bucket_mask = 0;
+    int slot_shift = 64;
+
+    template <typename KWLexer>
+    explicit KeywordTable(KWLexer& lexer)
+    {
+        for (int c = 0; c < 128; c++)
+        {
+            int kind = lexer.getKind(c);
+            if (kind < 0 || kind > 255)
+                return;
+            ascii_kinds[c] = static_cast<unsigned char>(kind);
+        }
+        int other = lexer.getKind(128);
+        if (other < 0 || other > 255)
+            return;
+        for (int c = 129; c <= 0xFFFF; c++)
+        {
+            if (lexer.getKind(c) != other)
+                return;
+        }
+        other_kind = static_cast<unsigned char>(other);
+
+        std::vector<int> alphabet;
+        for (int c = 0; c <= 128; c++)
+        {
+            int kind = (c < 128 ? ascii_kinds[c] : other_kind);
+            bool seen = false;
+            for (int k : alphabet)
+                seen = seen || (k == kind);
+            if (!seen)
+                alphabet.push_back(kind);
+        }
+
+        std::vector<unsigned char> prefix;
+        if (walk(lexer, KWLexer::START_STATE, alphabet, prefix) && layOut())
+            enabled = true;
+        else keywords.clear();
+    }
+
+    //
+    // Return the rule of the keyword chars[0..length), or 0 if it is not a
+    // keyword. length must be positive.
+    //
+    template <typename Char>
+    int find(const Char* chars, int length) const
+    {
+        if (length > MAX_LENGTH ||
+            ((first_lengths[kind(chars[0])] & last_lengths[kind(chars[length - 1])]) >> length & 1) == 0)
+            return 0;
+
+        unsigned char key[MAX_LENGTH] = {};
+        for (int i = 0; i < length; i++)
+            key[i] = kind(chars[i]);
+
+        int index = slots[slot(hash(key, length))];
+        if (index < 0)
+            return 0;
+        const Keyword& keyword = keywords[index];
+        if (keyword.length != length)
+            return 0;
+#if defined(LPG_CHAR_SCANNER_AVX2) || defined(LPG_CHAR_SCANNER_SSE2)
+        using namespace CharScanner::detail;
+        for (int i = 0; i < MAX_LENGTH; i += BYTES)
+        {
+            if (bits(same(load(key + i), load(keyword.kinds + i))) != FULL)
+                return 0;
+        }
+#else
+        if (std::memcmp(key, keyword.kinds, MAX_LENGTH) != 0)
+            return 0;
+#endif
+        return keyword.rule;
+    }
+
+private:
+    template <typename Char>
+    unsigned char kind(Char ch) const
+    {
+        auto c = static_cast<std::make_unsigned_t<Char>>(ch);
+        return (c < 128 ? ascii_kinds[c] : other_kind);
+    }
+
+    //
+    // Hash the kinds of a keyword (padded with zeros), 8 at a time.
+    //
+    static std::uint64_t hash(const unsigned char* kinds, int length)
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(length);
+        for (int i = 0; i < length; i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, kinds + i, 8);
+            h = (h ^ word) * 0x9E3779B97F4A7C15ull;
+            h ^= h >> 29;
+        }
+        return h ^ (h >> 32);
+    }
+
+    int slot(std::uint64_t h) const
+    {
+        std::uint64_t z = h ^ (seeds[h & bucket_mask] * 0xBF58476D1CE4E5B9ull);
+        z = (z ^ (z >> 31)) * 0x94D049BB133111EBull;
+        return static_cast<int>((z ^ (z >> 29)) >> slot_shift);
+    }
+
+    //
+    // Follow the loop of KWLexer::lexer from state, after the kinds in
+    // prefix, and add the keywords that start with prefix. Return false if
+    // the keywords cannot be put in the table.
+    //
+    template <typename KWLexer>
+    bool walk(KWLexer& lexer, int state, const std::vector<int>& alphabet, std::vector<unsigned char>& prefix)
+    {
+        if (prefix.size() > 0)
+        {
+            //
+            // The identifier ends here: the lexer reads the end of file.
+            //
+            int act = lexer.tAction(state, KWLexer::EOFT_SYMBOL);
+            for (int i = 0; act > KWLexer::NUM_RULES && act < KWLexer::ACCEPT_ACTION; i++)
+            {
+                if (i == MAX_LENGTH)
+                    return false;
+                act = lexer.tAction(act, KWLexer::EOFT_SYMBOL);
+            }
+            if (act > KWLexer::ERROR_ACTION)
+                act -= KWLexer::ERROR_ACTION;
+            if (act != KWLexer::ERROR_ACTION && !add(prefix, act, KWLexer::NUM_RULES))
+                return false;
+        }
+
+        for (int kind : alphabet)
+        {
+            int act = lexer.tAction(state, kind);
+            if (act > KWLexer::NUM_RULES && act < KWLexer::ACCEPT_ACTION) // Shift
+            {
+                if (prefix.size() == MAX_LENGTH)
+                    return false;
+                prefix.push_back(static_cast<unsigned char>(kind));
+                bool ok = walk(lexer, act, alphabet, prefix);
+                prefix.pop_back();
+                if (!ok)
+                    return false;
+            }
+            else if (act > KWLexer::ERROR_ACTION) // Shift-reduce: a keyword only if it ends here
+            {
+                prefix.push_back(static_cast<unsigned char>(kind));
+                bool ok = add(prefix, act - KWLexer::ERROR_ACTION, KWLexer::NUM_RULES);
+                prefix.pop_back();
+                if (!ok)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    bool add(const std::vector<unsigned char>& kinds, int rule, int num_rules);
+
+    bool layOut();
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 
+#include "LexerDfa.h"
 #include "tuple.h"
 
 
@@ -8,6 +9,7 @@ struct Monitor;
 struct RuleAction;
 struct ParseTable;
 struct ILexStream;
+class ParseTableProxy;
 
 struct LexParser
 {
@@ -22,19 +24,24 @@ struct LexParser
         NUM_RULES{};
 
     ILexStream* tokStream=nullptr;
-    ParseTable* prs = nullptr;
+    ParseTableProxy* prs = nullptr;
     RuleAction* ra = nullptr;
     IntTuple* action= nullptr;
     
 
     void reset(ILexStream* tokStream);
 
-    void reset(ILexStream* tokStream, ParseTable* prs, RuleAction* ra);
+    virtual void reset(ILexStream* tokStream, ParseTable* prs, RuleAction* ra);
 
     LexParser() {}
 
     LexParser(ILexStream* tokStream, ParseTable* prs, RuleAction* ra);
 
+    LexParser(const LexParser&) = delete;
+    LexParser& operator=(const LexParser&) = delete;
+
+    virtual ~LexParser();
+
     //
     // Stacks portion
     //
@@ -45,6 +52,18 @@ struct LexParser
     std::vector<int>  stack;
     std::vector<int>  locationStack;
     std::vector<int>  tempStack;
+
+    //
+    // The reduce and goto actions simulated by parseNextCharacter on the
+    // current character, replayed once the character is known to be valid.
+    //
+    std::vector<int>  reductions;
+
+    //
+    // The DFA that parseCharacters runs at the beginning of each token
+    // (see LexerDfa).
+    //
+    LexerDfa dfa;
 	
     void reallocateStacks();
 
@@ -108,7 +127,20 @@ struct LexParser
     //
     void parseCharacters();
 
-    void parseCharacters(Monitor* monitor);
+    void parseCharacters(Monitor* monitor) { lexCharacters(monitor, 0); }
+
+    //
+    // Create the tokens of the input from start_offset on. start_offset
+    // must be where a token, white space or a comment starts. Before each
+    // of them, curtok is where it starts and the monitor is asked whether
+    // to stop: that is how ParallelLexer stops the lexer of a chunk of the
+    // input at the end of the chunk.
+    //
+    // The entry points lexCharacters and lexNextToken are overridden by
+    // LexParserT, which specializes the per-character loops on the
+    // concrete stream, table and action classes.
+    //
+    virtual void lexCharacters(Monitor* monitor, int start_offset);
 
     //
     // This function takes as argument a configuration ([stack, stackTop], [tokStream, curtok])
@@ -135,7 +167,7 @@ struct LexParser
 
     bool scanNextToken(int start_offset);
 
-    bool lexNextToken(int end_offset);
+    virtual bool lexNextToken(int end_offset);
 
     //
     // This function takes as argument a configuration ([stack, stackTop], [tokStream, curtok])
@@ -149,5 +181,25 @@ struct LexParser
     // the list "action" and the sequence of tokens in the token stream.
     //
     void parseActions();
+
+    //
+    // The per-character loops, defined in LexParserT.h. They read the
+    // lookups and constants (tAction, NUM_RULES, ...) of table: *prs for
+    // the functions of this class, the ParseTableT of its Prs for a
+    // LexParserT. tokStream is a Stream (see LexStreamCalls), and the rule
+    // actions are those of actions (see applyRuleAction).
+    //
+    template <class Stream, class Table> int lookaheadWith(Table& table, int act, int token);
+    template <class Stream, class Table> int tActionWith(Table& table, int act, int sym);
+    template <class Stream, class Table, class Actions>
+    void lexCharactersWith(Table& table, Actions* actions, Monitor* monitor, int start_offset);
+    template <class Stream, class Table, class Actions>
+    void parseNextCharacterWith(Table& table, Actions* actions, int token, int kind);
+    template <class Stream, class Table, class Actions>
+    bool lexNextTokenWith(Table& table, Actions* actions, int end_offset);
+    template <class Stream, class Table, class Actions>
+    int lexNextCharacterWith(Table& table, Actions* actions, int act, int kind);
+    template <class Stream, class Table, class Actions>
+    void parseActionsWith(Table& table, Actions* actions);
 };
 
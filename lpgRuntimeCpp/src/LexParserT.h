@@ -0,0 +1,662 @@
+#pragma once
+#include <type_traits>
+
+#include "ILexStream.h"
+#include "LexParser.h"
+#include "Monitor.h"
+#include "ParseTableT.h"
+#include "RuleAction.h"
+
+//
+// The calls of the per-character loops to their character stream. They are
+// qualified with the concrete class Stream, so that none of them is a
+// virtual call, unless Stream is ILexStream itself.
+//
+template <class Stream>
+struct LexStreamCalls
+{
+    static_assert(std::is_base_of<ILexStream, Stream>::value, "LexStreamCalls expects an ILexStream");
+
+    constexpr static bool DYNAMIC = std::is_same<Stream, ILexStream>::value;
+
+    Stream* stream;
+
+    int getKind(int i)
+    {
+        if constexpr (DYNAMIC)
+            return stream->getKind(i);
+        else
+            return stream->Stream::getKind(i);
+    }
+
+    int getToken()
+    {
+        if constexpr (DYNAMIC)
+            return stream->getToken();
+        else
+            return stream->Stream::getToken();
+    }
+
+    int getNext(int i)
+    {
+        if constexpr (DYNAMIC)
+            return stream->getNext(i);
+        else
+            return stream->Stream::getNext(i);
+    }
+
+    int getPrevious(int i)
+    {
+        if constexpr (DYNAMIC)
+            return stream->getPrevious(i);
+        else
+            return stream->Stream::getPrevious(i);
+    }
+
+    int peek()
+    {
+        if constexpr (DYNAMIC)
+            return stream->peek();
+        else
+            return stream->Stream::peek();
+    }
+
+    void reset(int i)
+    {
+        if constexpr (DYNAMIC)
+            stream->reset(i);
+        else
+            stream->Stream::reset(i);
+    }
+
+    int getStreamLength()
+    {
+        if constexpr (DYNAMIC)
+            return stream->getStreamLength();
+        else
+            return stream->Stream::getStreamLength();
+    }
+};
+
+//
+// The per-character loops of LexParser, written once for the tables whose
+// lookups and constants are only known at run time (ParseTableProxy) and
+// for those known at compile time (ParseTableT). The member functions of
+// LexParser call them with ILexStream, *prs and ra; LexParserT, below, with
+// its Stream, the ParseTableT of its Prs and its Actions, so that the
+// compiler can inline the lookups, fold the constants and make no virtual
+// call.
+//
+
+//
+// keep looking ahead until we compute a valid action
+//
+template <class Stream, class Table>
+int LexParser::lookaheadWith(Table& table, int act, int token)
+{
+    LexStreamCalls<Stream> stream{ static_cast<Stream*>(tokStream) };
+    act = table.lookAhead(act - table.LA_STATE_OFFSET, stream.getKind(token));
+    return (act > table.LA_STATE_OFFSET
+                ? lookaheadWith<Stream>(table, act, stream.getNext(token))
+                : act);
+}
+
+//
+// Compute the next action defined on act and sym. If this
+// action requires more lookahead, these lookahead symbols
+// are in the token stream beginning at the next token that
+// is yielded by peek().
+//
+template <class Stream, class Table>
+int LexParser::tActionWith(Table& table, int act, int sym)
+{
+    act = table.tAction(act, sym);
+    if (table.MAX_LA > 1 && act > table.LA_STATE_OFFSET)
+        return lookaheadWith<Stream>(table, act, LexStreamCalls<Stream>{ static_cast<Stream*>(tokStream) }.peek());
+    return act;
+}
+
+template <class Stream, class Table, class Actions>
+void LexParser::lexCharactersWith(Table& table, Actions* actions, Monitor* monitor, int start_offset)
+{
+    LexStreamCalls<Stream> stream{ static_cast<Stream*>(tokStream) };
+
+    //
+    // Indicate that we are running the regular parser and that it's
+    // ok to use the utility functions to query the parser.
+    //
+    taking_actions = true;
+
+    resetTokenStream(start_offset);
+    lastToken = stream.getPrevious(curtok);
+
+    //
+    // Until it reaches the end-of-file token, this outer loop
+    // resets the parser and processes the next token.
+    //
+    while (current_kind != table.EOFT_SYMBOL)
+    {
+        //
+        // if the parser needs to stop processing,
+        // it may do so here.
+        //
+        if (monitor != nullptr && monitor->isCancelled())
+            break;
+
+        //
+        // Let the lexer process the white space and comments that start here.
+        //
+        int offset = applyScanSkippedTokens(actions, curtok);
+        if (offset != curtok)
+        {
+            lastToken = stream.getPrevious(offset);
+            stream.reset(offset);
+            curtok = stream.getToken();
+            current_kind = stream.getKind(curtok);
+            continue;
+        }
+
+        stateStackTop = -1;
+        currentAction = table.START_STATE;
+        starttok = curtok;
+
+        //
+        // Shift the characters of the regular prefix of the token with the DFA.
+        //
+        if (dfa.enabled)
+        {
+            dfa.scan(stateStackTop, currentAction, curtok, current_kind, lastToken, stack.data(),
+                     locationStack.data(),
+                     [&stream](int& token, int& kind)
+                     {
+                         token = stream.getToken();
+                         kind = stream.getKind(token);
+                     });
+        }
+
+        bool accepted = false;
+        for (;;)
+        {
+            if (++stateStackTop >= static_cast<int>(stack.size()))
+                reallocateStacks();
+            stack[stateStackTop] = currentAction;
+            locationStack[stateStackTop] = curtok;
+
+            //
+            // Compute the action on the next character. If it is a reduce action, we do not
+            // want to accept it until we are sure that the character in question can be parsed.
+            // What we are trying to avoid is a situation where curtok is not the EOF token
+            // but it yields a default reduce action in the current configuration even though
+            // it cannot ultimately be shifted; However, the state on top of the configuration also
+            // contains a valid reduce action on EOF which, if taken, would lead to the successful
+            // scanning of the token.
+            //
+            // Thus, if the character can be parsed, we proceed normally. Otherwise, we proceed
+            // as if we had reached the end of the file (end of the token, since we are really
+            // scanning).
+            //
+            parseNextCharacterWith<Stream>(table, actions, curtok, current_kind);
+            if (currentAction == table.ERROR_ACTION && current_kind != table.EOFT_SYMBOL) // if not successful try EOF
+            {
+                int save_next_token = stream.peek(); // save position after curtok
+                stream.reset(stream.getStreamLength() - 1); // point to the end of the input
+                parseNextCharacterWith<Stream>(table, actions, curtok, table.EOFT_SYMBOL);
+                stream.reset(save_next_token); // reset the stream for the next token after curtok.
+            }
+
+            //
+            // At this point, currentAction is either a Shift, Shift-Reduce, Accept or Error action.
+            //
+            if (currentAction > table.ERROR_ACTION) // Shift-reduce
+            {
+                lastToken = curtok;
+                curtok = stream.getToken();
+                current_kind = stream.getKind(curtok);
+                currentAction -= table.ERROR_ACTION;
+                do
+                {
+                    stateStackTop -= (table.rhs(currentAction) - 1);
+                    applyRuleAction(actions, currentAction);
+                    int lhs_symbol = table.lhs(currentAction);
+                    if (lhs_symbol == START_SYMBOL)
+                    {
+                        accepted = true;
+                        break;
+                    }
+                    currentAction = table.ntAction(stack[stateStackTop], lhs_symbol);
+                }
+                while (currentAction <= table.NUM_RULES);
+                if (accepted)
+                    break;
+            }
+            else if (currentAction < table.ACCEPT_ACTION) // Shift
+            {
+                lastToken = curtok;
+                curtok = stream.getToken();
+                current_kind = stream.getKind(curtok);
+            }
+            else
+            {
+                accepted = (currentAction == table.ACCEPT_ACTION);
+                break;
+            }
+        }
+        if (accepted)
+            continue;
+
+        //
+        // Whenever we reach this point, an error has been detected.
+        //
+        // If an error is detected on a single bad character,
+        // we advance to the next character before resuming the
+        // scan. However, if an error is detected after we start
+        // scanning a construct, we form a bad token out of the
+        // characters that have already been scanned and resume
+        // scanning on the character on which the problem was
+        // detected. In other words, in that case, we do not advance.
+        //
+        if (starttok == curtok)
+        {
+            if (current_kind == table.EOFT_SYMBOL)
+                break;
+            tokStream->reportLexicalError(starttok, curtok);
+            lastToken = curtok;
+            curtok = stream.getToken();
+            current_kind = stream.getKind(curtok);
+        }
+        else
+        {
+            tokStream->reportLexicalError(starttok, lastToken);
+        }
+    }
+
+    taking_actions = false; // indicate that we are done
+}
+
+template <class Stream, class Table, class Actions>
+void LexParser::parseNextCharacterWith(Table& table, Actions* actions, int token, int kind)
+{
+    int start_action = stack[stateStackTop],
+        pos = stateStackTop,
+        tempStackTop = stateStackTop - 1;
+
+    //
+    // Simulate the reduce and goto actions induced by the character on the
+    // temporary stack, and record them in reductions so that they need not
+    // be computed again when they are replayed below.
+    //
+    reductions.clear();
+    bool break_Scan = false;
+    for (currentAction = tActionWith<Stream>(table, start_action, kind);
+         currentAction <= table.NUM_RULES;
+         currentAction = tActionWith<Stream>(table, currentAction, kind))
+    {
+        do
+        {
+            reductions.push_back(currentAction);
+            int lhs_symbol = table.lhs(currentAction);
+            if (lhs_symbol == START_SYMBOL)
+            {
+                break_Scan = true;
+                break;
+            }
+            tempStackTop -= (table.rhs(currentAction) - 1);
+            int state = (tempStackTop > pos
+                             ? tempStack[tempStackTop]
+                             : stack[tempStackTop]);
+            currentAction = table.ntAction(state, lhs_symbol);
+        }
+        while (currentAction <= table.NUM_RULES);
+        if (break_Scan)
+            break;
+        if (tempStackTop + 1 >= static_cast<int>(stack.size()))
+            reallocateStacks();
+        //
+        // ... Update the maximum useful position of the stack,
+        // push goto state into (temporary) stack, and compute
+        // the next action on the current symbol ...
+        //
+        pos = pos < tempStackTop ? pos : tempStackTop;
+        tempStack[tempStackTop + 1] = currentAction;
+        reductions.push_back(currentAction);
+    }
+
+    //
+    // If no error was detected, we update the configuration up to the point prior to the
+    // shift or shift-reduce on the token by replaying the reduce and goto actions recorded
+    // above. In reductions, each chain of rules is followed by the goto state that it
+    // pushes (a state is greater than NUM_RULES), except for a final reduction to the
+    // START_SYMBOL. When the character is shifted right away, there is nothing to replay.
+    //
+    if (currentAction != table.ERROR_ACTION && !reductions.empty())
+    {
+        //
+        // Note that it is important that the global variable currentAction be used here when
+        // we are actually processing the rules. The reason being that the user-defined function
+        // ruleAction() may call functions defined in this class (such as getLastToken())
+        // which require that currentAction be properly initialized.
+        //
+        int next_action = currentAction;
+        bool chain_start = true;
+        for (int reduction : reductions)
+        {
+            if (reduction > table.NUM_RULES)
+            {
+                stack[++stateStackTop] = reduction;
+                locationStack[stateStackTop] = token;
+                chain_start = true;
+                continue;
+            }
+            if (chain_start)
+            {
+                stateStackTop--;
+                chain_start = false;
+            }
+            currentAction = reduction;
+            stateStackTop -= (table.rhs(currentAction) - 1);
+            applyRuleAction(actions, currentAction);
+            if (table.lhs(currentAction) == START_SYMBOL)
+            {
+                next_action = (starttok == token // null string reduction to START_SYMBOL is illegal
+                                   ? table.ERROR_ACTION
+                                   : table.ACCEPT_ACTION);
+                break;
+            }
+        }
+        currentAction = next_action;
+    }
+}
+
+template <class Stream, class Table, class Actions>
+bool LexParser::lexNextTokenWith(Table& table, Actions* actions, int end_offset)
+{
+    LexStreamCalls<Stream> stream{ static_cast<Stream*>(tokStream) };
+
+    //
+    // Indicate that we are going to run the incremental parser and that
+    // it's forbidden to use the utility functions to query the parser.
+    //
+    taking_actions = false;
+
+    stateStackTop = -1;
+    currentAction = table.START_STATE;
+    starttok = curtok;
+    action->reset();
+
+    for (;;)
+    {
+        if (++stateStackTop >= static_cast<int>(stack.size()))
+            reallocateStacks();
+        stack[stateStackTop] = currentAction;
+
+        //
+        // Compute the action on the next character; if the character is
+        // not parsable, proceed as if the end of the file (of the token)
+        // was reached (see lexCharactersWith).
+        //
+        currentAction = lexNextCharacterWith<Stream>(table, actions, currentAction, current_kind);
+        if (currentAction == table.ERROR_ACTION && current_kind != table.EOFT_SYMBOL) // if not successful try EOF
+        {
+            int save_next_token = stream.peek(); // save position after curtok
+            stream.reset(stream.getStreamLength() - 1); // point to the end of the input
+            currentAction = lexNextCharacterWith<Stream>(table, actions, stack[stateStackTop], table.EOFT_SYMBOL);
+            stream.reset(save_next_token); // reset the stream for the next token after curtok.
+        }
+
+        action->add(currentAction); // save the action
+
+        //
+        // At this point, currentAction is either a Shift, Shift-Reduce, Accept or Error action.
+        //
+        if (currentAction > table.ERROR_ACTION) //Shift-reduce
+        {
+            curtok = stream.getToken();
+            if (curtok > end_offset)
+                curtok = stream.getStreamLength();
+            current_kind = stream.getKind(curtok);
+            currentAction -= table.ERROR_ACTION;
+            do
+            {
+                int lhs_symbol = table.lhs(currentAction);
+                if (lhs_symbol == START_SYMBOL)
+                {
+                    parseActionsWith<Stream>(table, actions);
+                    return true;
+                }
+                stateStackTop -= (table.rhs(currentAction) - 1);
+                currentAction = table.ntAction(stack[stateStackTop], lhs_symbol);
+            }
+            while (currentAction <= table.NUM_RULES);
+        }
+        else if (currentAction < table.ACCEPT_ACTION) // Shift
+        {
+            curtok = stream.getToken();
+            if (curtok > end_offset)
+                curtok = stream.getStreamLength();
+            current_kind = stream.getKind(curtok);
+        }
+        else if (currentAction == table.ACCEPT_ACTION)
+            return true;
+        else
+            break; // ERROR_ACTION
+    }
+
+    //
+    // Whenever we reach this point, an error has been detected
+    // (see lexCharactersWith).
+    //
+    if (starttok == curtok)
+    {
+        if (current_kind == table.EOFT_SYMBOL)
+        {
+            action = nullptr; // turn into garbage!
+            return false;
+        }
+        lastToken = curtok;
+        tokStream->reportLexicalError(starttok, curtok);
+        curtok = stream.getToken();
+        if (curtok > end_offset)
+            curtok = stream.getStreamLength();
+        current_kind = stream.getKind(curtok);
+    }
+    else
+    {
+        lastToken = stream.getPrevious(curtok);
+        tokStream->reportLexicalError(starttok, lastToken);
+    }
+
+    return true;
+}
+
+template <class Stream, class Table, class Actions>
+int LexParser::lexNextCharacterWith(Table& table, Actions* actions, int act, int kind)
+{
+    int action_save = action->size(),
+        pos = stateStackTop,
+        tempStackTop = stateStackTop - 1;
+    act = tActionWith<Stream>(table, act, kind);
+    while (act <= table.NUM_RULES)
+    {
+        action->add(act);
+        bool break_Scan = false;
+        do
+        {
+            int lhs_symbol = table.lhs(act);
+            if (lhs_symbol == START_SYMBOL)
+            {
+                if (starttok == curtok) // null string reduction to START_SYMBOL is illegal
+                {
+                    act = table.ERROR_ACTION;
+                    break_Scan = true;
+                    break;
+                }
+                parseActionsWith<Stream>(table, actions);
+                return table.ACCEPT_ACTION;
+            }
+            tempStackTop -= (table.rhs(act) - 1);
+            int state = (tempStackTop > pos
+                             ? tempStack[tempStackTop]
+                             : stack[tempStackTop]);
+            act = table.ntAction(state, lhs_symbol);
+        }
+        while (act <= table.NUM_RULES);
+        if (break_Scan)
+            break;
+
+        if (tempStackTop + 1 >= static_cast<int>(stack.size()))
+            reallocateStacks();
+        //
+        // ... Update the maximum useful position of the stack,
+        // push goto state into (temporary) stack, and compute
+        // the next action on the current symbol ...
+        //
+        pos = pos < tempStackTop ? pos : tempStackTop;
+        tempStack[tempStackTop + 1] = act;
+        act = tActionWith<Stream>(table, act, kind);
+    }
+
+    //
+    // If an error was detected, we restore the original configuration.
+    // Otherwise, we update configuration up to the point prior to the
+    // shift or shift-reduce on the token.
+    //
+    if (act == table.ERROR_ACTION)
+        action->reset(action_save);
+    else
+    {
+        stateStackTop = tempStackTop + 1;
+        for (int i = pos + 1; i <= stateStackTop; i++) // update stack
+            stack[i] = tempStack[i];
+    }
+
+    return act;
+}
+
+template <class Stream, class Table, class Actions>
+void LexParser::parseActionsWith(Table& table, Actions* actions)
+{
+    LexStreamCalls<Stream> stream{ static_cast<Stream*>(tokStream) };
+
+    //
+    // Indicate that we are running the regular parser and that it's
+    // ok to use the utility functions to query the parser.
+    //
+    taking_actions = true;
+
+    curtok = starttok;
+    lastToken = stream.getPrevious(curtok);
+
+    //
+    // Reparse the input...
+    //
+    stateStackTop = -1;
+    currentAction = table.START_STATE;
+    for (int i = 0; i < action->size(); i++)
+    {
+        stack[++stateStackTop] = currentAction;
+        locationStack[stateStackTop] = curtok;
+
+        currentAction = action->get(i);
+        if (currentAction <= table.NUM_RULES) // a reduce action?
+            stateStackTop--; // turn reduction into shift-reduction
+        else // a shift or shift-reduce action
+        {
+            lastToken = curtok;
+            curtok = stream.getNext(curtok);
+            if (currentAction <= table.ERROR_ACTION) // a shift action?
+                continue;
+            currentAction -= table.ERROR_ACTION;
+        }
+
+        bool done = false;
+        do
+        {
+            stateStackTop -= (table.rhs(currentAction) - 1);
+            applyRuleAction(actions, currentAction);
+            int lhs_symbol = table.lhs(currentAction);
+            if (lhs_symbol == START_SYMBOL)
+            {
+                done = true;
+                break;
+            }
+            currentAction = table.ntAction(stack[stateStackTop], lhs_symbol);
+        }
+        while (currentAction <= table.NUM_RULES);
+        if (done)
+            break;
+    }
+
+    taking_actions = false; // indicate that we are done
+}
+
+//
+// LexParser specialized at compile time on the concrete character stream
+// class Stream (e.g. JavaLexer::JavaLexerLpgLexStream), on a generated
+// parse table class Prs (e.g. JavaLexerprs) and on the concrete rule
+// action class Actions (e.g. JavaLexer).
+//
+// When it is reset with a Prs, it runs the per-character loops above with
+// its Stream, the ParseTableT of Prs (so that a direct-coded table written
+// by DirectCodeGenerator plugs in as is) and its Actions. With a table of
+// another class (e.g. a BinaryParseTable or a ParseTableLayout), it runs
+// those of LexParser, over the table it was given.
+//
+// The lexer keeps passing its stream and itself to reset as usual: they
+// must be a Stream and an Actions. Everything else (the utility functions
+// used by the rule actions, the incremental entry points) is inherited from
+// LexParser, so a LexParserT can be used anywhere a LexParser* is expected.
+//
+template <class Stream, class Prs, class Actions>
+struct LexParserT :
+    public LexParser
+{
+    typedef ParseTableT<Prs> Table;
+
+    static_assert(std::is_base_of<ILexStream, Stream>::value, "LexParserT expects a concrete ILexStream");
+    static_assert(std::is_base_of<RuleAction, Actions>::value, "LexParserT expects a concrete RuleAction");
+
+    Table table;
+
+    //
+    // true if the parser was reset with a Prs.
+    //
+    bool specialized = false;
+
+    LexParserT() = default;
+
+    LexParserT(ILexStream* tokStream, Actions* ra)
+    {
+        reset(tokStream, Table::instance(), ra);
+    }
+
+    LexParserT(ILexStream* tokStream, ParseTable* prs, Actions* ra)
+    {
+        reset(tokStream, prs, ra);
+    }
+
+    using LexParser::reset;
+
+    void reset(ILexStream* tokStream, ParseTable* prs, RuleAction* ra) override
+    {
+        specialized = dynamic_cast<Prs*>(prs) != nullptr;
+        if (specialized)
+            table.prepare(prs);
+        LexParser::reset(tokStream, prs, ra);
+    }
+
+    Actions* ruleActions() { return static_cast<Actions*>(ra); }
+
+    void lexCharacters(Monitor* monitor, int start_offset) override
+    {
+        if (specialized)
+            lexCharactersWith<Stream>(table, ruleActions(), monitor, start_offset);
+        else LexParser::lexCharacters(monitor, start_offset);
+    }
+
+    bool lexNextToken(int end_offset) override
+    {
+        return specialized
+                   ? lexNextTokenWith<Stream>(table, ruleActions(), end_offset)
+                   : LexParser::lexNextToken(end_offset);
+    }
+};
@@ -2,9 +2,10 @@
 
 #include <iostream>
 
+#include "FileCharSource.h"
 #include "IMessageHandler.h"
 #include "IPrsStream.h"
-#include "IcuUtil.h"
+#include "PrsStream.h"
 #include "stringex.h"
 
 void LexStream::this_init()
@@ -40,27 +41,66 @@ LexStream::LexStream(shared_ptr_wstring inputChars, const std::wstring& file_nam
 
 void LexStream::initialize(const std::wstring& file_name)
 {
-	std::wstring buffer;
-	if(IcuUtil::getFileUnicodeContent(file_name.c_str(), buffer))
+	FileCharSource source(file_name);
+	if (!source.isOpen())
 	{
-		shared_ptr_wstring inputChars(std::move(buffer));
-		initialize(inputChars, inputChars.size(), file_name);
+		throw std::exception("can't open file:");
 	}
-	else
+	initialize(source, file_name);
+}
+
+void LexStream::initialize(ICharSource& source, const std::wstring& file_name)
+{
+	constexpr int CHUNK_SIZE = FileCharSource::CHUNK_SIZE;
+
+	//
+	// One more character than the hint, so that the read that finds the end
+	// of the input does not grow the array.
+	//
+	std::wstring buffer;
+	if (source.getLengthHint() > 0)
+		buffer.reserve(source.getLengthHint() + 1);
+	lineOffsets->Contiguous(1)[0] = -1;
+	for (;;)
 	{
-		throw std::exception("can't open file:");
+		int start = static_cast<int>(buffer.size()),
+		    room = static_cast<int>(buffer.capacity()) - start;
+		buffer.resize(start + (room > 0 && room < CHUNK_SIZE ? room : CHUNK_SIZE));
+		int count = source.read(&buffer[start], static_cast<int>(buffer.size()) - start);
+		if (count < 0)
+		{
+			throw std::exception("can't decode file:");
+		}
+		buffer.resize(start + count);
+		if (count == 0)
+			break;
+		CharScanner::indexNewlines(buffer.data(), start, start + count, lineOffsets->size(),
+		                           [this](int n) { return lineOffsets->Contiguous(n); });
 	}
-	
+
+	shared_ptr_wstring inputChars(std::move(buffer));
+	setInputChars(inputChars);
+	setStreamLength(inputChars.size());
+	setFileName(file_name);
 }
 
 void LexStream::computeLineOffsets(int offset)
 {
 	int line = getLineNumberOfCharAt(offset), // The line containing the offset character
 	    line_offset = lineOffsets->get(line); // the beginnning character of the line containing the offset character
-	lineOffsets->reset(line + 1);
-	for (int i = line_offset + 1; i < inputChars_.size(); i++)
-		if (inputChars_[i] == 0x0A) setLineOffset(i);
+	CharScanner::indexNewlines(inputChars_.data(), line_offset + 1, inputChars_.size(), line + 1,
+	                           [this](int n) { return lineOffsets->Contiguous(n); });
+	invalidatePositions();
 }
+
+void LexStream::invalidatePositions()
+{
+	positions.invalidate();
+	auto stream = dynamic_cast<PrsStream*>(prsStream);
+	if (stream != nullptr)
+		stream->invalidateTokenPositions();
+}
+
 void LexStream::setPrsStream(IPrsStream* prsStream)
 {
 	prsStream->setLexStream(this);
@@ -74,8 +114,7 @@ IPrsStream* LexStream::getPrsStream()
 
 int LexStream::getLineNumberOfCharAt(int i)
 {
-	int index = binarySearch(*(lineOffsets.get()),i);
-	return index < 0 ? -index : index == 0 ? 1 : index;
+	return positions.lineOf(*lineOffsets, i);
 }
 
 std::wstring LexStream::getName(int i)
@@ -137,6 +176,11 @@ IMessageHandler::Location LexStream::getLocation(int left_loc, int right_loc)
 void LexStream::reportLexicalError(int errorCode, int left_loc, int right_loc, int error_left_loc, int error_right_loc,
                                    const std::vector<std::wstring>& errorInfo)
 {
+	if (deferredErrors != nullptr)
+	{
+		deferredErrors->push_back({errorCode, left_loc, right_loc, error_left_loc, error_right_loc, errorInfo});
+		return;
+	}
 	if (errMsg == nullptr)
 	{
 		std::wstringex locationInfo = getFileName() + L":";
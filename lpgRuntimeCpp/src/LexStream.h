@@ -1,7 +1,11 @@
 #pragma once
+#include "CharScanner.h"
 #include "ILexStream.h"
 #include "ObjectTuple.h"
 #include "ParseErrorCodes.h"
+#include "PositionIndex.h"
+
+struct ICharSource;
 
 //
 // LexStream contains an array of characters as the input stream to be parsed.
@@ -25,10 +29,21 @@ struct LexStream :
 	
     int tab_ = DEFAULT_TAB;
 
+    //
+    // The line and the column of an offset (see PositionIndex).
+    //
+    PositionIndex positions;
+
     /**
      * @deprecated Use function getIPrsStream()
      */
-     /*  ... when not deprecated! */ IPrsStream* prsStream;
+     /*  ... when not deprecated! */ IPrsStream* prsStream = nullptr;
+
+    //
+    // Forget the lines and columns found for the offsets, and for the
+    // tokens of prsStream if it is a PrsStream.
+    //
+    void invalidatePositions();
 
      LexStream(int tab = DEFAULT_TAB)
      {
@@ -40,6 +55,12 @@ struct LexStream :
         initialize(file_name);
     }
 
+    LexStream(ICharSource& source, const std::wstring& file_name, int tab = DEFAULT_TAB)
+    {
+        this_tab(tab);
+        initialize(source, file_name);
+    }
+
     LexStream(shared_ptr_wstring inputChars, const std::wstring& file_name)
     {
         this_init();
@@ -79,6 +100,16 @@ struct LexStream :
 
     void initialize(const std::wstring& file_name);
 
+    //
+    // Read the input from source a chunk at a time, and index the line
+    // feeds of each chunk as it is read, while it is still in the cache.
+    // The characters are not kept in a bounded window: all of them are in
+    // a single array, as the tokens, the line offsets and the messages
+    // refer to them by their offset. Only what is held next to them while
+    // they are read is bounded (a chunk of bytes, for a FileCharSource).
+    //
+    void initialize(ICharSource& source, const std::wstring& file_name);
+
     void initialize(shared_ptr_wstring inputChars, const std::wstring& fileName)
     {
         initialize(inputChars, inputChars.size(), fileName);
@@ -105,12 +136,16 @@ struct LexStream :
         setFileName(fileName);
     }
 
+    //
+    // The offsets of the line feeds are found a vector of characters at a
+    // time and written into a contiguous array (see CharScanner).
+    //
     void computeLineOffsets()
     {
-        lineOffsets->reset();
-        setLineOffset(-1);
-        for (int i = 0; i < inputChars_.size(); i++)
-            if (inputChars_[i] == 0x0A) setLineOffset(i);
+        lineOffsets->Contiguous(1)[0] = -1;
+        CharScanner::indexNewlines(inputChars_.data(), 0, inputChars_.size(), 1,
+                                   [this](int n) { return lineOffsets->Contiguous(n); });
+        invalidatePositions();
     }
 
     /**
@@ -126,6 +161,7 @@ struct LexStream :
     {
         this->inputChars_ = inputChars;
         index = -1; // reset the start index to the beginning of the input
+        invalidatePositions();
     }
 
     shared_ptr_wstring getInputChars() { return inputChars_; }
@@ -137,11 +173,16 @@ struct LexStream :
     void setLineOffsets(std::shared_ptr< IntSegmentedTuple>& lineOffsets)
     {
 	    this->lineOffsets = lineOffsets;
+        invalidatePositions();
     }
 
     std::shared_ptr<IntSegmentedTuple> getLineOffsets() { return lineOffsets; }
 
-    void setTab(int tab) { this->tab_ = tab; }
+    void setTab(int tab)
+    {
+        this->tab_ = tab;
+        invalidatePositions();
+    }
 
     int getTab() { return tab_; }
 
@@ -159,6 +200,7 @@ struct LexStream :
     void setLineOffset(int i)
     {
         lineOffsets->add(i);
+        invalidatePositions();
     }
 
     /**
@@ -205,6 +247,16 @@ struct LexStream :
 
     int getIntValue(int i) { return inputChars_[i]; }
 
+    //
+    // Scans of the characters from offset i to the end of the stream, a
+    // vector of characters at a time (see CharScanner).
+    //
+    int skipWhitespace(int i) { return CharScanner::skipWhitespace(inputChars_.data(), i, streamLength_); }
+
+    int findLineEnd(int i) { return CharScanner::findLineEnd(inputChars_.data(), i, streamLength_); }
+
+    int findBlockCommentEnd(int i) { return CharScanner::findBlockCommentEnd(inputChars_.data(), i, streamLength_); }
+
     /**
      * @deprecated replaced by {@link #getLineCount()}
      *
@@ -214,20 +266,16 @@ struct LexStream :
 
     int getLineNumberOfCharAt(int i);
 
+    //
+    // The tabs before i on its line are expanded to the tab stops, every
+    // tab_ columns.
+    //
     int getColumnOfCharAt(int i)
     {
         int lineNo = getLineNumberOfCharAt(i),
             start = lineOffsets->get(lineNo - 1);
         if (start + 1 >= streamLength_) return 1;
-        for (int k = start + 1; k < i; k++)
-        {
-            if (inputChars_[k] == '\t')
-            {
-                int offset = (k - start) - 1;
-                start -= ((tab_ - 1) - offset % tab_);
-            }
-        }
-        return i - start;
+        return i - positions.expandedStart(inputChars_.data(), inputChars_.size(), *lineOffsets, tab_, start, i);
     }
 
     //
@@ -320,6 +368,26 @@ struct LexStream :
 
     IMessageHandler* getMessageHandler() { return errMsg; }
 
+    //
+    // The arguments of a call to reportLexicalError.
+    //
+    struct LexicalError
+    {
+        int errorCode,
+            left_loc,
+            right_loc,
+            error_left_loc,
+            error_right_loc;
+        std::vector<std::wstring> errorInfo;
+    };
+
+    //
+    // When it is not null, the lexical errors are added to deferredErrors
+    // instead of being reported, so that they can be reported later, and
+    // in order, on another stream of the same input (see ParallelLexer).
+    //
+    std::vector<LexicalError>* deferredErrors = nullptr;
+
     void makeToken(int startLoc, int endLoc, int kind);
 
     void reportLexicalError(int left_loc, int right_loc);
@@ -0,0 +1,128 @@
+#include "LexerDfa.h"
+
+#include <algorithm>
+
+#include "ParseTableProxy.h"
+
+void LexerDfa::reset(ParseTableProxy* prs, const unsigned char* action_map)
+{
+    if (this->prs == prs && table == prs->_prs && this->action_map == action_map)
+        return;
+
+    this->prs = prs;
+    table = prs->_prs;
+    this->action_map = action_map;
+    enabled = (action_map != nullptr);
+
+    START_STATE = prs->START_STATE;
+    LA_STATE_OFFSET = prs->LA_STATE_OFFSET;
+    EOFT_SYMBOL = prs->EOFT_SYMBOL;
+    ACCEPT_ACTION = prs->ACCEPT_ACTION;
+    ERROR_ACTION = prs->ERROR_ACTION;
+    START_SYMBOL = prs->getStartSymbol();
+    NUM_RULES = prs->NUM_RULES;
+
+    width = prs->NT_OFFSET + 1;
+    next.clear();
+    keep.clear();
+    stacks.clear();
+    depths.clear();
+    index.clear();
+    addState({ START_STATE });
+}
+
+int LexerDfa::addState(const std::vector<int>& states)
+{
+    auto found = index.find(states);
+    if (found != index.end())
+        return found->second;
+    if ((int) stacks.size() >= MAX_STATES)
+        return SLOW;
+
+    int state = (int) stacks.size();
+    index.emplace(states, state);
+    stacks.push_back(states);
+    depths.push_back((int) states.size());
+    next.resize(next.size() + width, UNKNOWN);
+    keep.resize(keep.size() + width, 0);
+    return state;
+}
+
+bool LexerDfa::skippable(int rule)
+{
+    return (action_map[rule >> 3] & (1 << (rule & 7))) == 0 && prs->lhs(rule) != START_SYMBOL;
+}
+
+int LexerDfa::compute(int state, int kind)
+{
+    int i = state * width + kind;
+    next[i] = SLOW;
+    if (kind == EOFT_SYMBOL || kind < 0 || kind >= width)
+        return SLOW;
+
+    //
+    // Follow the actions of LexParser::parseNextCharacter and of the loop
+    // of LexParser::parseCharacters on the stack of the state. As in the
+    // parser, a state popped by a reduction is not erased, since it is
+    // used again by a reduction by an empty rule.
+    //
+    std::vector<int> stack(stacks[state]);
+    int top = depths[state] - 1,
+        unchanged = depths[state];
+    stack.resize(MAX_DEPTH + 1);
+
+    int act = prs->tAction(stack[top], kind);
+    while (act <= NUM_RULES)
+    {
+        top--;
+        do
+        {
+            if (!skippable(act))
+                return SLOW;
+            top -= (prs->rhs(act) - 1);
+            if (top < 0)
+                return SLOW;
+            unchanged = std::min(unchanged, top + 1);
+            act = prs->ntAction(stack[top], prs->lhs(act));
+        }
+        while (act <= NUM_RULES);
+
+        if (++top >= MAX_DEPTH)
+            return SLOW;
+        stack[top] = act;
+        act = prs->tAction(act, kind);
+    }
+
+    if (act > LA_STATE_OFFSET)
+        return SLOW;
+    if (act > ERROR_ACTION) // Shift-reduce
+    {
+        act -= ERROR_ACTION;
+        do
+        {
+            if (!skippable(act))
+                return SLOW;
+            top -= (prs->rhs(act) - 1);
+            if (top < 0)
+                return SLOW;
+            unchanged = std::min(unchanged, top + 1);
+            act = prs->ntAction(stack[top], prs->lhs(act));
+        }
+        while (act <= NUM_RULES);
+    }
+    else if (act >= ACCEPT_ACTION) // Accept or Error
+        return SLOW;
+
+    if (top + 2 > MAX_DEPTH)
+        return SLOW;
+    stack.resize(top + 2);
+    stack[top + 1] = act;
+
+    int target = addState(stack);
+    if (target != SLOW)
+    {
+        next[i] = target;
+        keep[i] = (unsigned char) unchanged;
+    }
+    return target;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <map>
+#include <vector>
+
+struct ParseTable;
+class ParseTableProxy;
+
+//
+// A DFA that runs the regular part of a lexer grammar.
+//
+// Within a token, most characters (the letters of an identifier, the digits
+// of a number, the characters of a comment...) are shifted by the LALR(k)
+// lexer after a few reductions that have no action, and the configuration
+// reached depends only on the configuration before the character and on
+// its kind. Here the configurations of the lexer that start at the
+// beginning of a token are the states of a DFA, and a transition on a
+// character kind is computed once by simulating the reduce, goto and shift
+// actions of the automaton, and remembered. LexParser then runs the DFA in
+// a tight loop and returns to the LALR(k) automaton only when a transition
+// cannot be taken by the DFA, that is when the character:
+//
+//     . needs more lookahead,
+//     . induces a reduction by a rule that has an action, or to the start
+//       symbol (the end of the token),
+//     . is in error or is the end of file,
+//
+// or when the DFA is full. Those cases are then processed as before, from
+// the configuration that the DFA reached, so that the tokens produced are
+// exactly the same.
+//
+// The DFA is built lazily, as the characters are seen. It has at most
+// MAX_STATES states, which are configurations of at most MAX_DEPTH
+// states. It is used only if the rule action map of the lexer is known
+// (see RuleAction::getRuleActionMap).
+//
+struct LexerDfa
+{
+    constexpr static int MAX_STATES = 1024,
+                         MAX_DEPTH = 16;
+
+    constexpr static int UNKNOWN = -2, // the transition has not been computed yet
+                         SLOW = -1;    // the transition is left to the LALR(k) automaton
+
+    bool enabled = false;
+
+    //
+    // For DFA state s and character kind k, next[s * width + k] is the
+    // target state, UNKNOWN or SLOW, and keep[s * width + k] is the number
+    // of elements at the bottom of the stack that the transition leaves
+    // unchanged, along with their location. The other elements, except the
+    // top one, are located at the character.
+    //
+    int width = 0;
+    std::vector<int> next;
+    std::vector<unsigned char> keep;
+
+    //
+    // The stack of states of each DFA state. The last one is the current
+    // state of the automaton, which is not yet pushed.
+    //
+    std::vector<std::vector<int>> stacks;
+    std::vector<int> depths;
+    std::map<std::vector<int>, int> index;
+
+    ParseTable* table = nullptr;
+    ParseTableProxy* prs = nullptr;
+    const unsigned char* action_map = nullptr;
+    int START_STATE{},
+        LA_STATE_OFFSET{},
+        EOFT_SYMBOL{},
+        ACCEPT_ACTION{},
+        ERROR_ACTION{},
+        START_SYMBOL{},
+        NUM_RULES{};
+
+    //
+    // Start a new DFA for the table prs, unless the table and the action
+    // map are those of the current one.
+    //
+    void reset(ParseTableProxy* prs, const unsigned char* action_map);
+
+    //
+    // Compute the transition of state on kind.
+    //
+    int compute(int state, int kind);
+
+    //
+    // Run the DFA from the beginning of a token at curtok, updating curtok,
+    // current_kind and last_token as the characters are shifted. next(curtok,
+    // current_kind) moves to the next character of the stream. On return,
+    // the configuration reached is in stack, location_stack and stack_top,
+    // and current_action is the state to be pushed next, as in the loop of
+    // LexParser::parseCharacters.
+    //
+    template <typename Next>
+    void scan(int& stack_top, int& current_action, int& curtok, int& current_kind, int& last_token,
+              int* stack, int* location_stack, Next next)
+    {
+        int state = 0;
+        for (;;)
+        {
+            location_stack[depths[state] - 1] = curtok;
+
+            int i = state * width + current_kind,
+                target = this->next[i];
+            if (target == UNKNOWN)
+                target = compute(state, current_kind);
+            if (target < 0)
+                break;
+
+            for (int k = keep[i], depth = depths[target] - 1; k < depth; k++)
+                location_stack[k] = curtok;
+            last_token = curtok;
+            next(curtok, current_kind);
+            state = target;
+        }
+
+        const std::vector<int>& states = stacks[state];
+        int depth = depths[state];
+        for (int k = 0; k < depth - 1; k++)
+            stack[k] = states[k];
+        stack_top = depth - 2;
+        current_action = states[depth - 1];
+    }
+
+private:
+    int addState(const std::vector<int>& states);
+
+    bool skippable(int rule);
+};
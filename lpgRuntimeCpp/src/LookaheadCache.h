@@ -0,0 +1,109 @@
+#pragma once
+#include <vector>
+
+#include "TokenStream.h"
+
+//
+// Direct-mapped cache of LALR(k) lookahead resolutions.
+//
+// When a terminal action is a lookahead state (act > LA_STATE_OFFSET), the
+// parser walks prs->lookAhead over the next tokens until a real action is
+// found. The result only depends on the table, the lookahead state and the
+// kinds of the tokens examined, so it is remembered here, keyed on the
+// lookahead state and the sequence of kinds. A repeated question then costs
+// one probe (and a comparison of the kinds) instead of k dependent table
+// walks.
+//
+// Sequences longer than MAX_DEPTH kinds are not cached.
+//
+struct LookaheadCache
+{
+    constexpr static int SIZE = 512; // must be a power of 2
+    constexpr static int MAX_DEPTH = 4;
+
+    struct Entry
+    {
+        int laState = 0;
+        int depth = 0;
+        int kinds[MAX_DEPTH] = {};
+        int action = 0;
+    };
+
+    std::vector<Entry> entries;
+    unsigned long long hits = 0,
+                       misses = 0;
+
+    //
+    // Allocate (enabled) or release the cache, and forget every entry.
+    // The entries only depend on the parse table, so this is needed only
+    // when the table changes.
+    //
+    void reset(bool enabled)
+    {
+        entries.clear();
+        if (enabled)
+            entries.resize(SIZE);
+        hits = misses = 0;
+    }
+
+    static unsigned index(int la_state, int kind)
+    {
+        return (((unsigned) la_state * 31u + (unsigned) kind) * 2654435761u >> 23) & (SIZE - 1);
+    }
+
+    //
+    // Resolve the lookahead state act on the tokens starting at token.
+    // look_ahead(la_state, sym) is the lookAhead function of the table.
+    //
+    template <typename LookAhead>
+    int lookahead(TokenStream* tokStream, int la_state_offset, int act, int token, LookAhead look_ahead)
+    {
+        int kind = tokStream->getKind(token);
+        Entry* entry = nullptr;
+        if (!entries.empty())
+        {
+            entry = &entries[index(act, kind)];
+            if (entry->laState == act && entry->depth > 0 && entry->kinds[0] == kind)
+            {
+                int i = 1;
+                for (int t = token; i < entry->depth; i++)
+                {
+                    t = tokStream->getNext(t);
+                    if (tokStream->getKind(t) != entry->kinds[i])
+                        break;
+                }
+                if (i == entry->depth)
+                {
+                    hits++;
+                    return entry->action;
+                }
+            }
+            misses++;
+        }
+
+        int kinds[MAX_DEPTH],
+            depth = 0,
+            la_state = act;
+        for (;;)
+        {
+            if (depth < MAX_DEPTH)
+                kinds[depth] = kind;
+            depth++;
+            act = look_ahead(act - la_state_offset, kind);
+            if (act <= la_state_offset)
+                break;
+            token = tokStream->getNext(token);
+            kind = tokStream->getKind(token);
+        }
+
+        if (entry != nullptr && depth <= MAX_DEPTH)
+        {
+            entry->laState = la_state;
+            entry->depth = depth;
+            for (int i = 0; i < depth; i++)
+                entry->kinds[i] = kinds[i];
+            entry->action = act;
+        }
+        return act;
+    }
+};
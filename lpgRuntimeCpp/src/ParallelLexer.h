@@ -0,0 +1,392 @@
+#pragma once
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "AbstractToken.h"
+#include "LexParser.h"
+#include "LexStream.h"
+#include "Monitor.h"
+#include "PrsStream.h"
+
+//
+// Lex a large input with several threads, into the same tokens, adjuncts
+// and lexical errors as the sequential lexer.
+//
+// The input is split at line feeds into chunks, one per thread. Each chunk
+// is lexed by a lexer of its own into a PrsStream of its own, from the
+// beginning of its first line to the first token, white space or comment
+// that starts in the next chunk, and the offset where each of them starts
+// is recorded. Once the chunks are lexed, their tokens are moved in order
+// into the PrsStream of the lexer. Where the chunk before a chunk stopped
+// is where the sequential lexer would start a token:
+//
+//     . if the chunk also started a token there, its tokens from there on
+//       are those of the sequential lexer, and they are used;
+//
+//     . otherwise (the first line of the chunk starts in a block comment,
+//       say), the seam is lexed again, sequentially, from there, until it
+//       reaches an offset where a later chunk started a token.
+//
+// The lexical errors of the chunks are deferred (see
+// LexStream::deferredErrors), and those of the tokens that are used are
+// reported in order on the stream of the lexer.
+//
+// Lexer is a lexer generated from LexerTemplateF.gi, such as JavaLexer,
+// whose stream is a LexStream: a chunk is lexed by a
+// Lexer(input_chars, file_name, tab) with LexParser::lexCharacters. Its
+// rule actions must not keep any state from a token to the next (the
+// generated ones do not, unless printTokens is set). Each of these lexers
+// indexes the line feeds of the whole input (see CharScanner), which is
+// why the chunks are not made smaller than MIN_CHUNK_SIZE.
+//
+template <class Lexer>
+struct ParallelLexer
+{
+    constexpr static int MIN_CHUNK_SIZE = 1 << 16;
+
+    //
+    // Lex the input of lexer into prsStream with up to threads threads (by
+    // default, one per hardware thread), as lexer.lexer(monitor, prsStream)
+    // does. The monitor, if any, is asked from all the threads. Inputs too
+    // small to be split, and token streams that are not a PrsStream, are
+    // lexed sequentially.
+    //
+    static void lexer(Lexer& lexer, Monitor* monitor, IPrsStream* prsStream, int threads = 0)
+    {
+        LexStream* stream = static_cast<LexStream*>(lexer.getILexStream());
+        PrsStream* tokens = dynamic_cast<PrsStream*>(prsStream);
+        if (threads <= 0)
+            threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        std::vector<int> starts = split(stream, threads);
+        if (starts.size() < 2 || tokens == nullptr)
+        {
+            lexer.lexer(monitor, prsStream);
+            return;
+        }
+
+        lexer.initializeLexer(prsStream, 0, -1);
+        ParallelLexer parallel(stream, monitor, tokens, starts);
+        parallel.lexChunks();
+        stream->setStreamIndex(parallel.stitch());
+        lexer.addEOF(prsStream, stream->getStreamIndex());
+    }
+
+    //
+    // Split the input into chunks of at least MIN_CHUNK_SIZE characters
+    // that start at the beginning of a line, and return their starts.
+    //
+    static std::vector<int> split(LexStream* stream, int chunks)
+    {
+        const wchar_t* chars = stream->getInputChars().data();
+        int length = stream->getStreamLength(),
+            size = std::max(MIN_CHUNK_SIZE, length / chunks);
+
+        std::vector<int> starts{ 0 };
+        for (int k = 1; k < chunks; k++)
+        {
+            int i = std::max(starts.back() + size, static_cast<int>(static_cast<long long>(length) * k / chunks));
+            while (i < length && chars[i - 1] != L'\n')
+                i++;
+            if (i + MIN_CHUNK_SIZE / 2 > length)
+                break;
+            starts.push_back(i);
+        }
+        return starts;
+    }
+
+private:
+    //
+    // Where a token, white space or comment starts, with the numbers of
+    // tokens, adjuncts and lexical errors made before it.
+    //
+    struct Boundary
+    {
+        int offset,
+            tokens,
+            adjuncts,
+            errors;
+    };
+
+    //
+    // A run of a lexer over part of the input, which stops when asked to by
+    // the monitor and records the boundaries on the way. Only their offsets
+    // are kept (a few tokens of the run need them all): the tokens and
+    // adjuncts made before a boundary are those that start before it, and
+    // the errors those that were reported before the monitor was asked
+    // there (see checked).
+    //
+    struct Run : public Monitor
+    {
+        ParallelLexer* owner = nullptr;
+        Lexer* lexer = nullptr;
+        PrsStream tokens;
+        std::vector<LexStream::LexicalError> errors;
+        std::vector<int> boundaries,
+                         checked; // the first boundary after each error
+        int start = 0,
+            stop_offset = 0,
+            end = 0,
+            stream_index = 0;
+        bool seam = false,
+             stopped = false,
+             cancelled = false;
+
+        bool isCancelled() override
+        {
+            int offset = lexer->getParser()->curtok;
+            if (owner->monitor != nullptr && owner->monitor->isCancelled())
+                cancelled = true;
+            else if (offset >= stop_offset && (!seam || (offset > start && owner->boundary(offset) != nullptr)))
+                stopped = true;
+            else
+            {
+                boundaries.push_back(offset);
+                checked.resize(errors.size(), offset);
+                return false;
+            }
+            end = offset;
+            return true;
+        }
+
+        void lex(PrsStream* main)
+        {
+            LexStream* stream = static_cast<LexStream*>(lexer->getILexStream());
+            stream->deferredErrors = &errors;
+            stream->setPrsStream(&tokens);
+            tokens.kindMap = main->kindMap;
+            lexer->getParser()->lexCharacters(this, start);
+            stream_index = stream->getStreamIndex();
+            stream->deferredErrors = nullptr;
+        }
+
+        Boundary at(int offset)
+        {
+            return { offset, tokens.tokenStore.lowerBound(offset), tokens.adjunctStore.lowerBound(offset),
+                     static_cast<int>(std::upper_bound(checked.begin(), checked.end(), offset) - checked.begin()) };
+        }
+
+        Boundary last()
+        {
+            return { end, tokens.tokens.size(), tokens.adjuncts.size(), static_cast<int>(errors.size()) };
+        }
+    };
+
+    LexStream* stream;
+    Monitor* monitor;
+    PrsStream* prsStream;
+    std::vector<int> starts;
+    std::vector<std::unique_ptr<Lexer>> lexers;
+    std::vector<std::unique_ptr<Run>> chunks,
+                                      seams;
+
+    ParallelLexer(LexStream* stream, Monitor* monitor, PrsStream* prsStream, const std::vector<int>& starts) :
+        stream(stream), monitor(monitor), prsStream(prsStream), starts(starts)
+    {
+    }
+
+    ParallelLexer(const ParallelLexer&) = delete;
+    ParallelLexer& operator=(const ParallelLexer&) = delete;
+
+    ~ParallelLexer()
+    {
+        seams.clear(); // before their lexers
+        chunks.clear();
+    }
+
+    //
+    // Call work(k) for k in [0, count), on count threads: work(0) on this
+    // one. Rethrow the first exception, once they are all done.
+    //
+    template <class Work>
+    static void onThreads(int count, Work work)
+    {
+        std::vector<std::exception_ptr> failures(count);
+        auto run = [&](int k)
+        {
+            try
+            {
+                work(k);
+            }
+            catch (...)
+            {
+                failures[k] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int k = 1; k < count; k++)
+            threads.emplace_back(run, k);
+        run(0);
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto& failure : failures)
+        {
+            if (failure)
+                std::rethrow_exception(failure);
+        }
+    }
+
+    void lexChunks()
+    {
+        int count = static_cast<int>(starts.size());
+        lexers.resize(count);
+        std::vector<shared_ptr_wstring> input_chars(count, stream->getInputChars());
+        for (int k = 0; k < count; k++)
+        {
+            chunks.emplace_back(new Run());
+            chunks[k]->owner = this;
+            chunks[k]->start = starts[k];
+            chunks[k]->stop_offset = (k + 1 < count ? starts[k + 1] : stream->getStreamLength() + 1);
+        }
+
+        onThreads(count, [&](int k)
+        {
+            lexers[k].reset(new Lexer(input_chars[k], stream->getFileName(), stream->getTab()));
+            chunks[k]->lexer = lexers[k].get();
+            chunks[k]->lex(prsStream);
+        });
+    }
+
+    //
+    // The index of the chunk that contains offset.
+    //
+    int chunk(int offset)
+    {
+        return static_cast<int>(std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin()) - 1;
+    }
+
+    //
+    // Did the chunk that contains offset start a token, white space or
+    // comment there? If so, return the chunk.
+    //
+    Run* boundary(int offset)
+    {
+        Run* run = chunks[chunk(offset)].get();
+        return (std::binary_search(run->boundaries.begin(), run->boundaries.end(), offset) ? run : nullptr);
+    }
+
+    //
+    // The tokens and adjuncts that a run made between two of its
+    // boundaries, and where they go in the PrsStream.
+    //
+    struct Segment
+    {
+        Run* run;
+        Boundary from,
+                 to;
+        int tokens,
+            adjuncts;
+    };
+
+    //
+    // Move the tokens of the chunks, and of the seams lexed again, into the
+    // PrsStream, which keeps the pools they were allocated in, and report
+    // their errors. Return the index of the stream at the end.
+    //
+    // The segments are found first, and the stream made long enough for
+    // all of them. Then each segment is moved by a thread of its own: the
+    // entries of its tokens and adjuncts are copied to the stores of the
+    // PrsStream, and the token objects that were made, and the adjuncts,
+    // are given their index there.
+    //
+    int stitch()
+    {
+        std::vector<Segment> segments;
+        int tokens = prsStream->tokens.size(),
+            adjuncts = prsStream->adjuncts.size();
+        Run* run = chunks[0].get();
+        Boundary from = run->at(run->start);
+        for (;;)
+        {
+            Boundary to = run->last();
+            segments.push_back({ run, from, to, tokens, adjuncts });
+            tokens += to.tokens - from.tokens;
+            adjuncts += to.adjuncts - from.adjuncts;
+            if (!run->stopped)
+                break;
+
+            Run* next = boundary(run->end);
+            if (next != nullptr)
+            {
+                from = next->at(run->end);
+                run = next;
+                continue;
+            }
+
+            seams.emplace_back(new Run());
+            Run* seam = seams.back().get();
+            seam->owner = this;
+            seam->lexer = lexers[0].get();
+            seam->start = run->end;
+            seam->stop_offset = run->end;
+            seam->seam = true;
+            seam->lex(prsStream);
+            from = seam->at(seam->start);
+            run = seam;
+        }
+
+        prsStream->tokens.Resize(tokens);
+        prsStream->tokenStore.resize(tokens);
+        prsStream->adjuncts.Resize(adjuncts);
+        prsStream->adjunctStore.resize(adjuncts);
+        int count = static_cast<int>(std::min(segments.size(), chunks.size()));
+        onThreads(count, [&](int k)
+        {
+            for (int i = k; i < static_cast<int>(segments.size()); i += count)
+                move(segments[i]);
+        });
+
+        for (const Segment& segment : segments)
+        {
+            prsStream->adoptTokenPools(segment.run->tokens);
+            for (int e = segment.from.errors; e < segment.to.errors; e++)
+            {
+                const LexStream::LexicalError& error = segment.run->errors[e];
+                stream->reportLexicalError(error.errorCode, error.left_loc, error.right_loc,
+                                           error.error_left_loc, error.error_right_loc, error.errorInfo);
+            }
+        }
+        return segments.back().run->stream_index;
+    }
+
+    //
+    // Move the tokens and adjuncts of a segment to their place in the
+    // PrsStream, with the indices that makeToken and makeAdjunct would
+    // have given them there.
+    //
+    void move(const Segment& segment)
+    {
+        Run& run = *segment.run;
+        int token_shift = segment.tokens - segment.from.tokens,
+            adjunct_shift = segment.adjuncts - segment.from.adjuncts;
+        const TokenStore& store = run.tokens.tokenStore;
+        for (int i = segment.from.tokens; i < segment.to.tokens; i++)
+        {
+            IToken* token = run.tokens.tokens[i];
+            if (token != nullptr)
+            {
+                static_cast<AbstractToken*>(token)->iPrsStream = prsStream;
+                static_cast<AbstractToken*>(token)->store = prsStream;
+                token->setTokenIndex(i + token_shift);
+                token->setAdjunctIndex(token->getAdjunctIndex() + adjunct_shift);
+            }
+            prsStream->tokens[i + token_shift] = token;
+            prsStream->tokenStore.set(i + token_shift, store.kinds[i], store.startOffsets[i], store.endOffsets[i],
+                                      store.adjunctIndexes[i] + adjunct_shift);
+        }
+        for (int i = segment.from.adjuncts; i < segment.to.adjuncts; i++)
+        {
+            IToken* adjunct = run.tokens.adjuncts[i];
+            static_cast<AbstractToken*>(adjunct)->iPrsStream = prsStream;
+            static_cast<AbstractToken*>(adjunct)->store = prsStream;
+            adjunct->setTokenIndex(adjunct->getTokenIndex() + token_shift);
+            adjunct->setAdjunctIndex(i + adjunct_shift);
+            prsStream->adjuncts[i + adjunct_shift] = adjunct;
+            prsStream->adjunctStore.set(i + adjunct_shift, adjunct);
+        }
+    }
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
 
+#include "CompactIntArray.h"
+
 struct ParseTable
 {
 	virtual ~ParseTable() = default;
@@ -121,4 +123,54 @@ struct ParseTable
   virtual  signed int* get_termCheck_data() = 0;
 
   virtual   signed int* get_termAction_data() = 0;
+
+  //
+  // Number of elements in the arrays above. A table that does not
+  // report them (0) is used as is, without narrowing its arrays.
+  //
+  virtual int get_baseCheck_length() { return 0; }
+  virtual int get_baseAction_length() { return 0; }
+  virtual int get_termCheck_length() { return 0; }
+  virtual int get_termAction_length() { return 0; }
+
+  //
+  // Number of elements in the remaining tables, used when a table is
+  // written out (see BinaryParseTable). 0 means that the table does not
+  // have this array (e.g. the lexer tables have no recovery arrays).
+  //
+  virtual int get_isNullable_length() { return 0; }
+  virtual int get_prosthesesIndex_length() { return 0; }
+  virtual int get_isKeyword_length() { return 0; }
+  virtual int get_asb_length() { return 0; }
+  virtual int get_asr_length() { return 0; }
+  virtual int get_nasb_length() { return 0; }
+  virtual int get_nasr_length() { return 0; }
+  virtual int get_terminalIndex_length() { return 0; }
+  virtual int get_nonterminalIndex_length() { return 0; }
+  virtual int get_scopePrefix_length() { return 0; }
+  virtual int get_scopeSuffix_length() { return 0; }
+  virtual int get_scopeLhs_length() { return 0; }
+  virtual int get_scopeLa_length() { return 0; }
+  virtual int get_scopeStateSet_length() { return 0; }
+  virtual int get_scopeRhs_length() { return 0; }
+  virtual int get_scopeState_length() { return 0; }
+  virtual int get_inSymb_length() { return 0; }
+  virtual int get_name_length() { return 0; }
+
+  //
+  // A table whose arrays are already stored narrowed (e.g. a table
+  // mapped from a binary table file) returns them here, so that
+  // ParseTableProxy can use them in place instead of copying them.
+  //
+  virtual bool get_compact_arrays(CompactIntArray& /*baseCheck*/, CompactIntArray& /*baseAction*/,
+                                  CompactIntArray& /*termCheck*/, CompactIntArray& /*termAction*/)
+  {
+      return false;
+  }
+
+  //
+  // The narrowed copies of the arrays of this table that ParseTableProxy
+  // makes otherwise (see CompactIntArray::narrow), freed with the table.
+  //
+  CompactIntArray::Cache compactArrays;
 };
@@ -0,0 +1,170 @@
+#include "ParseTableLayout.h"
+
+#include <algorithm>
+
+#include "ParseTableProfile.h"
+
+namespace
+{
+    struct Row
+    {
+        int base;
+        unsigned visits;
+    };
+
+    void writeArray(std::ostream& out, const char* name, const std::vector<signed int>& values)
+    {
+        out << "inline static signed int " << name << "[] = {\n";
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            if (i % 10 == 0)
+                out << "            ";
+            out << values[i];
+            if (i + 1 < values.size())
+                out << (i % 10 == 9 ? ",\n" : ",");
+        }
+        out << "\n        };\n";
+    }
+}
+
+std::shared_ptr<ParseTableLayout> ParseTableLayout::fromProfile(ParseTable* prs, const ParseTableProfile& profile)
+{
+    int base_action_length = prs->get_baseAction_length(),
+        check_length = prs->get_termCheck_length(),
+        action_length = prs->get_termAction_length();
+    if (base_action_length == 0 || check_length == 0 || action_length == 0)
+        return nullptr;
+
+    const signed int* base_action = prs->get_baseAction_data();
+    const signed int* term_check = prs->get_termCheck_data();
+    const signed int* term_action = prs->get_termAction_data();
+    int nt_offset = prs->getNtOffset(),
+        la_state_offset = prs->getLaStateOffset();
+
+    auto layout = std::make_shared<ParseTableLayout>(prs);
+    layout->_baseAction.assign(base_action, base_action + base_action_length);
+
+    //
+    // Collect the visited rows. Several states may share a row.
+    //
+    std::map<int, unsigned> visits;
+    for (int state = 0; state < static_cast<int>(profile.stateVisits.size()) && state < base_action_length; state++)
+    {
+        if (profile.stateVisits[state] > 0)
+            visits[base_action[state]] += profile.stateVisits[state];
+    }
+    for (int la_state = 1; la_state < static_cast<int>(profile.lookaheadVisits.size()); la_state++)
+    {
+        if (profile.lookaheadVisits[la_state] > 0)
+            visits[la_state] += profile.lookaheadVisits[la_state];
+    }
+
+    std::vector<Row> rows;
+    for (auto& visit : visits)
+        rows.push_back({ visit.first, visit.second });
+    std::stable_sort(rows.begin(), rows.end(),
+                     [](const Row& a, const Row& b) { return a.visits > b.visits; });
+
+    //
+    // Pack the rows, most visited first, after the end of the original
+    // arrays: each row takes the first offset where its default slot and
+    // the slots of its explicit entries are all free. The slot of the
+    // default action gets a check value of 0, which no lookup on a terminal
+    // of another row can match.
+    //
+    int hot_start = std::max(check_length, action_length);
+    std::vector<bool> used;
+    std::vector<int> hot_check,
+                     hot_action,
+                     syms;
+    int hot_length = 0;
+    for (auto& row : rows)
+    {
+        syms.clear();
+        for (int sym = 1; sym <= nt_offset; sym++)
+        {
+            int k = row.base + sym;
+            if (k < check_length && term_check[k] == sym)
+                syms.push_back(sym);
+        }
+
+        int offset = 0;
+        for (;; offset++)
+        {
+            if (offset < static_cast<int>(used.size()) && used[offset])
+                continue;
+            bool fits = true;
+            for (int sym : syms)
+            {
+                if (offset + sym < static_cast<int>(used.size()) && used[offset + sym])
+                {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits)
+                break;
+        }
+
+        size_t size = static_cast<size_t>(offset) + nt_offset + 1;
+        if (used.size() < size)
+        {
+            used.resize(size, false);
+            hot_check.resize(size, 0);
+            hot_action.resize(size, 0);
+        }
+        used[offset] = true;
+        hot_action[offset] = term_action[row.base];
+        for (int sym : syms)
+        {
+            used[offset + sym] = true;
+            hot_check[offset + sym] = sym;
+            hot_action[offset + sym] = term_action[row.base + sym];
+        }
+        hot_length = std::max(hot_length, offset + (syms.empty() ? 0 : syms.back()) + 1);
+        layout->rowMap[row.base] = hot_start + offset;
+    }
+
+    //
+    // The new arrays: the original ones, padded to hot_start, followed by
+    // the packed rows and enough padding for a lookup on any terminal of
+    // the last rows.
+    //
+    int length = hot_start + hot_length + nt_offset + 1;
+    layout->_termCheck.assign(length, 0);
+    layout->_termAction.assign(length, 0);
+    std::copy(term_check, term_check + check_length, layout->_termCheck.begin());
+    std::copy(term_action, term_action + action_length, layout->_termAction.begin());
+    std::copy(hot_check.begin(), hot_check.begin() + hot_length, layout->_termCheck.begin() + hot_start);
+    std::copy(hot_action.begin(), hot_action.begin() + hot_length, layout->_termAction.begin() + hot_start);
+    layout->hotStart = hot_start;
+    layout->hotLength = hot_length;
+
+    //
+    // Renumber: point the visited states and the lookahead actions to the
+    // relocated rows. The original copies of the rows are left in place.
+    //
+    for (int state = 0; state < static_cast<int>(profile.stateVisits.size()) && state < base_action_length; state++)
+    {
+        if (profile.stateVisits[state] > 0)
+            layout->_baseAction[state] = layout->rowMap[base_action[state]];
+    }
+    for (auto& act : layout->_termAction)
+    {
+        if (act > la_state_offset)
+        {
+            auto it = layout->rowMap.find(act - la_state_offset);
+            if (it != layout->rowMap.end())
+                act = la_state_offset + it->second;
+        }
+    }
+
+    return layout;
+}
+
+void ParseTableLayout::writeArrays(std::ostream& out)
+{
+    writeArray(out, "_baseAction", _baseAction);
+    writeArray(out, "_termCheck", _termCheck);
+    writeArray(out, "_termAction", _termAction);
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "ParseTable.h"
+
+struct ParseTableProfile;
+
+//
+// A parse table whose terminal action rows are laid out for locality,
+// guided by a ParseTableProfile.
+//
+// In the generated tables the rows of terminal actions of all the states
+// and lookahead states are interleaved in _termCheck/_termAction, so that
+// consecutive tokens of a typical input touch cache lines all over these
+// arrays. Here, the rows that the profile visited are copied, most visited
+// first, into a tightly packed region appended to _termCheck/_termAction,
+// and are renumbered:
+//
+//   . baseAction[state] of a visited state is set to the new row, and
+//   . every lookahead action (> LA_STATE_OFFSET) that designates a visited
+//     lookahead state is changed to designate its new row.
+//
+// State numbers are not changed: LPG numbers a state by the offset of its
+// goto row in baseAction, and the goto rows are left as they are. The rows
+// that were not visited also keep their place, so that the table remains
+// correct for the parts of the grammar that the corpus did not exercise.
+//
+// The layout is used like any other table, e.g. by giving it to the
+// parser or lexer (ParseTableProxy reads the relocated rows), by writing
+// it with BinaryParseTable::write, or by pasting the arrays produced by
+// writeArrays in the generated *prs class (which is needed for the parsers
+// specialized at compile time):
+//
+//     auto layout = ParseTableLayout::fromProfile(prs, *profile);
+//     BinaryParseTable::write(layout.get(), L"JavaParser.lpgt");
+//
+// The layout must not outlive prs.
+//
+struct ParseTableLayout :public ParseTable
+{
+    //
+    // Relocate the rows visited in profile. Returns nullptr if prs does
+    // not report the length of its arrays.
+    //
+    static std::shared_ptr<ParseTableLayout> fromProfile(ParseTable* prs, const ParseTableProfile& profile);
+
+    //
+    // rowMap[row] is the new offset of the relocated terminal row that was
+    // at offset row (baseAction[state] for a state, la_state for a
+    // lookahead state) in the original table.
+    //
+    std::map<int, int> rowMap;
+
+    //
+    // The relocated rows occupy [hotStart, hotStart + hotLength) in
+    // termCheck and termAction.
+    //
+    int hotStart = 0;
+    int hotLength = 0;
+
+    //
+    // Write _baseAction, _termCheck and _termAction in the format of the
+    // generated *prs classes.
+    //
+    void writeArrays(std::ostream& out);
+
+    ParseTable* _prs;
+    std::vector<signed int> _baseAction;
+    std::vector<signed int> _termCheck;
+    std::vector<signed int> _termAction;
+
+    explicit ParseTableLayout(ParseTable* prs) : _prs(prs)
+    {
+    }
+
+    int baseCheck(int index) override { return _prs->baseCheck(index); }
+    int rhs(int index) override { return _prs->rhs(index); }
+    int baseAction(int index) override { return _baseAction[index]; }
+    int lhs(int index) override { return _baseAction[index]; }
+    int termCheck(int index) override { return _termCheck[index]; }
+    int termAction(int index) override { return _termAction[index]; }
+    int asb(int index) override { return _prs->asb(index); }
+    int asr(int index) override { return _prs->asr(index); }
+    int nasb(int index) override { return _prs->nasb(index); }
+    int nasr(int index) override { return _prs->nasr(index); }
+    int terminalIndex(int index) override { return _prs->terminalIndex(index); }
+    int nonterminalIndex(int index) override { return _prs->nonterminalIndex(index); }
+    int scopePrefix(int index) override { return _prs->scopePrefix(index); }
+    int scopeSuffix(int index) override { return _prs->scopeSuffix(index); }
+    int scopeLhs(int index) override { return _prs->scopeLhs(index); }
+    int scopeLa(int index) override { return _prs->scopeLa(index); }
+    int scopeStateSet(int index) override { return _prs->scopeStateSet(index); }
+    int scopeRhs(int index) override { return _prs->scopeRhs(index); }
+    int scopeState(int index) override { return _prs->scopeState(index); }
+    int inSymb(int index) override { return _prs->inSymb(index); }
+    std::wstring name(int index) override { return _prs->name(index); }
+    int originalState(int state) override { return _prs->originalState(state); }
+    int asi(int state) override { return _prs->asi(state); }
+    int nasi(int state) override { return _prs->nasi(state); }
+    int inSymbol(int state) override { return _prs->inSymbol(state); }
+
+    int ntAction(int state, int sym) override
+    {
+        return _baseAction[state + sym];
+    }
+    int tAction(int state, int sym) override
+    {
+        int i = _baseAction[state],
+            k = i + sym;
+        return _termAction[_termCheck[k] == sym ? k : i];
+    }
+    int lookAhead(int la_state, int sym) override
+    {
+        int k = la_state + sym;
+        return _termAction[_termCheck[k] == sym ? k : la_state];
+    }
+
+    int getErrorSymbol() override { return _prs->getErrorSymbol(); }
+    int getScopeUbound() override { return _prs->getScopeUbound(); }
+    int getScopeSize() override { return _prs->getScopeSize(); }
+    int getMaxNameLength() override { return _prs->getMaxNameLength(); }
+    int getNumStates() override { return _prs->getNumStates(); }
+    int getNtOffset() override { return _prs->getNtOffset(); }
+    int getLaStateOffset() override { return _prs->getLaStateOffset(); }
+    int getMaxLa() override { return _prs->getMaxLa(); }
+    int getNumRules() override { return _prs->getNumRules(); }
+    int getNumNonterminals() override { return _prs->getNumNonterminals(); }
+    int getNumSymbols() override { return _prs->getNumSymbols(); }
+    int getStartState() override { return _prs->getStartState(); }
+    int getStartSymbol() override { return _prs->getStartSymbol(); }
+    int getEoftSymbol() override { return _prs->getEoftSymbol(); }
+    int getEoltSymbol() override { return _prs->getEoltSymbol(); }
+    int getAcceptAction() override { return _prs->getAcceptAction(); }
+    int getErrorAction() override { return _prs->getErrorAction(); }
+    bool isNullable(int symbol) override { return _prs->isNullable(symbol); }
+    bool isValidForParser() override { return _prs->isValidForParser(); }
+    bool getBacktrack() override { return _prs->getBacktrack(); }
+    int getIdentifier_SYMBOL() override { return _prs->getIdentifier_SYMBOL(); }
+
+    char* get_isNullable_data() override { return _prs->get_isNullable_data(); }
+    signed int* get_prosthesesIndex_data() override { return _prs->get_prosthesesIndex_data(); }
+    char* get_isKeyword_data() override { return _prs->get_isKeyword_data(); }
+    signed int* get_baseCheck_data() override { return _prs->get_baseCheck_data(); }
+    signed int* get_rhs_data() override { return _prs->get_rhs_data(); }
+    signed int* get_baseAction_data() override { return _baseAction.data(); }
+    signed int* get_lhs_data() override { return _baseAction.data(); }
+    signed int* get_termCheck_data() override { return _termCheck.data(); }
+    signed int* get_termAction_data() override { return _termAction.data(); }
+
+    int get_baseCheck_length() override { return _prs->get_baseCheck_length(); }
+    int get_baseAction_length() override { return static_cast<int>(_baseAction.size()); }
+    int get_termCheck_length() override { return static_cast<int>(_termCheck.size()); }
+    int get_termAction_length() override { return static_cast<int>(_termAction.size()); }
+    int get_isNullable_length() override { return _prs->get_isNullable_length(); }
+    int get_prosthesesIndex_length() override { return _prs->get_prosthesesIndex_length(); }
+    int get_isKeyword_length() override { return _prs->get_isKeyword_length(); }
+    int get_asb_length() override { return _prs->get_asb_length(); }
+    int get_asr_length() override { return _prs->get_asr_length(); }
+    int get_nasb_length() override { return _prs->get_nasb_length(); }
+    int get_nasr_length() override { return _prs->get_nasr_length(); }
+    int get_terminalIndex_length() override { return _prs->get_terminalIndex_length(); }
+    int get_nonterminalIndex_length() override { return _prs->get_nonterminalIndex_length(); }
+    int get_scopePrefix_length() override { return _prs->get_scopePrefix_length(); }
+    int get_scopeSuffix_length() override { return _prs->get_scopeSuffix_length(); }
+    int get_scopeLhs_length() override { return _prs->get_scopeLhs_length(); }
+    int get_scopeLa_length() override { return _prs->get_scopeLa_length(); }
+    int get_scopeStateSet_length() override { return _prs->get_scopeStateSet_length(); }
+    int get_scopeRhs_length() override { return _prs->get_scopeRhs_length(); }
+    int get_scopeState_length() override { return _prs->get_scopeState_length(); }
+    int get_inSymb_length() override { return _prs->get_inSymb_length(); }
+    int get_name_length() override { return _prs->get_name_length(); }
+};
@@ -0,0 +1,46 @@
+#include "ParseTableProfile.h"
+
+#include <map>
+#include <mutex>
+
+#include "ParseTable.h"
+
+namespace
+{
+    std::mutex registry_lock;
+    std::map<ParseTable*, std::shared_ptr<ParseTableProfile>> registry;
+}
+
+ParseTableProfile::ParseTableProfile(ParseTable* prs)
+{
+    int accept_action = prs->getAcceptAction();
+    width = prs->getNtOffset() + 1;
+    stateVisits.assign(accept_action, 0);
+    transitions.assign(static_cast<size_t>(accept_action) * width, 0);
+    lookaheadVisits.assign(prs->get_termCheck_length(), 0);
+}
+
+void ParseTableProfile::merge(const ParseTableProfile& other)
+{
+    for (size_t i = 0; i < stateVisits.size() && i < other.stateVisits.size(); i++)
+        stateVisits[i] += other.stateVisits[i];
+    for (size_t i = 0; i < transitions.size() && i < other.transitions.size(); i++)
+        transitions[i] += other.transitions[i];
+    for (size_t i = 0; i < lookaheadVisits.size() && i < other.lookaheadVisits.size(); i++)
+        lookaheadVisits[i] += other.lookaheadVisits[i];
+}
+
+void ParseTableProfile::install(ParseTable* prs, std::shared_ptr<ParseTableProfile> profile)
+{
+    std::lock_guard<std::mutex> guard(registry_lock);
+    if (profile)
+        registry[prs] = profile;
+    else registry.erase(prs);
+}
+
+std::shared_ptr<ParseTableProfile> ParseTableProfile::find(ParseTable* prs)
+{
+    std::lock_guard<std::mutex> guard(registry_lock);
+    auto it = registry.find(prs);
+    return (it == registry.end() ? nullptr : it->second);
+}
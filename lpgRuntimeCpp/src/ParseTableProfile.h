@@ -0,0 +1,87 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+struct ParseTable;
+
+//
+// Per-state and per-(state, terminal) counts of the terminal actions
+// computed on a parse table, recorded while parsing a representative
+// corpus. The counts drive ParseTableLayout (and can also be given to
+// DenseActionRows::fromProfile).
+//
+// The parse tables are only profiled when the runtime is built with
+// LPG_PROFILE_PARSE_TABLES. A profile installed for a table is then picked
+// up by every ParseTableProxy built afterwards over that table, which
+// records each tAction and lookAhead call:
+//
+//     auto profile = std::make_shared<ParseTableProfile>(prs);
+//     ParseTableProfile::install(prs, profile);
+//     ... lex/parse the corpus with DeterministicParser, BacktrackingParser or LexParser ...
+//     ParseTableProfile::install(prs, nullptr);
+//
+// The parsers specialized at compile time (DeterministicParserT, ...) do
+// not go through ParseTableProxy: they record into the profile installed
+// for the table they are given when they are reset (see ParseTableT, and
+// JavaExample -profile for a tool that profiles a corpus). The counters
+// are not atomic: profile from a single thread.
+//
+struct ParseTableProfile
+{
+    //
+    // Number of terminal symbols (NT_OFFSET + 1).
+    //
+    int width = 0;
+
+    //
+    // stateVisits[state] is the number of terminal actions computed in
+    // state, and transitions[state * width + sym] the number of them that
+    // were computed on the terminal sym. States are numbered as in the
+    // table (see DenseActionRows::states), so both arrays are indexed up to
+    // ACCEPT_ACTION.
+    //
+    std::vector<unsigned> stateVisits;
+    std::vector<unsigned> transitions;
+
+    //
+    // lookaheadVisits[la_state] is the number of lookAhead calls made on
+    // the lookahead state la_state.
+    //
+    std::vector<unsigned> lookaheadVisits;
+
+    explicit ParseTableProfile(ParseTable* prs);
+
+    void recordAction(int state, int sym)
+    {
+        if ((unsigned) state < stateVisits.size() && (unsigned) sym < (unsigned) width)
+        {
+            stateVisits[state]++;
+            transitions[state * width + sym]++;
+        }
+    }
+
+    void recordLookahead(int la_state)
+    {
+        if ((unsigned) la_state < lookaheadVisits.size())
+            lookaheadVisits[la_state]++;
+    }
+
+    unsigned transitionCount(int state, int sym) const
+    {
+        return transitions[state * width + sym];
+    }
+
+    //
+    // Add the counts of another profile of the same table.
+    //
+    void merge(const ParseTableProfile& other);
+
+    //
+    // Register profile for prs (nullptr to stop profiling). Only the
+    // proxies built (and the specialized parsers reset) after this call
+    // record into it.
+    //
+    static void install(ParseTable* prs, std::shared_ptr<ParseTableProfile> profile);
+
+    static std::shared_ptr<ParseTableProfile> find(ParseTable* prs);
+};
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <memory>
+
+#include "CompactIntArray.h"
+#include "DenseActionRows.h"
 #include "ParseTable.h"
+#include "ParseTableProfile.h"
 
 class ParseTableProxy
 {
 public:
    
-	ParseTableProxy(ParseTable*);
+	ParseTableProxy(ParseTable*, bool compact = true);
 	
     ParseTable* _prs;
     const  int ERROR_SYMBOL;
@@ -57,17 +62,69 @@ public:
     bool isKeyword(int index) { return _isKeyword[index] != 0; }
 	
     const  signed int* _baseCheck;
-    int baseCheck(int index) { return _baseCheck[index]; }
+    int baseCheck(int index) { return _compactBaseCheck[index]; }
     const   signed int* _rhs;
-    int rhs(int index) { return _rhs[index]; }
+    int rhs(int index) { return _compactRhs[index]; }
     const   signed int* _baseAction;
-    int baseAction(int index) { return _baseAction[index]; }
+    int baseAction(int index) { return _compactBaseAction[index]; }
     const   signed int* _lhs;
-    int lhs(int index) { return _lhs[index]; }
+    int lhs(int index) { return _compactLhs[index]; }
     const  signed int* _termCheck;
-    int termCheck(int index) { return _termCheck[index]; }
+    int termCheck(int index) { return _compactTermCheck[index]; }
     const   signed int* _termAction;
-    int termAction(int index) { return _termAction[index]; }
+    int termAction(int index) { return _compactTermAction[index]; }
+
+    //
+    // The arrays used by the driver loops, each one stored with the
+    // narrowest element type that can hold its values.
+    //
+    CompactIntArray _compactBaseCheck;
+    CompactIntArray _compactBaseAction;
+    CompactIntArray _compactTermCheck;
+    CompactIntArray _compactTermAction;
+    CompactIntArray _compactRhs;
+    CompactIntArray _compactLhs;
+
+    //
+    // tAction, lookAhead and ntAction for the element types of the compact
+    // arrays. The lookups switch on the width of each array they read,
+    // which stays the same for the life of the proxy, so that the branches
+    // are predicted and the lookup is inlined in the driver loops.
+    //
+    template <typename BaseAction, typename TermCheck, typename TermAction>
+    int compactTAction(int state, int sym) const
+    {
+        const BaseAction* base_action = static_cast<const BaseAction*>(_compactBaseAction.data);
+        const TermCheck* term_check = static_cast<const TermCheck*>(_compactTermCheck.data);
+        int i = base_action[state],
+            k = i + sym;
+        return static_cast<const TermAction*>(_compactTermAction.data)[term_check[k] == sym ? k : i];
+    }
+
+    template <typename TermCheck, typename TermAction>
+    int compactLookAhead(int la_state, int sym) const
+    {
+        const TermCheck* term_check = static_cast<const TermCheck*>(_compactTermCheck.data);
+        int k = la_state + sym;
+        return static_cast<const TermAction*>(_compactTermAction.data)[term_check[k] == sym ? k : la_state];
+    }
+
+    //
+    // Dense terminal action rows installed for this table, if any
+    // (see DenseActionRows).
+    //
+    std::shared_ptr<DenseActionRows> _denseRows;
+    int _denseFirst = 0;
+    const int* _denseActions = nullptr;
+    unsigned _denseStates = 0;
+    unsigned _denseWidth = 0;
+
+#ifdef LPG_PROFILE_PARSE_TABLES
+    //
+    // Profile being recorded for this table, if any (see ParseTableProfile).
+    //
+    std::shared_ptr<ParseTableProfile> _profile;
+#endif
  
 
     int asb(int index) { return _prs->asb(index); }
@@ -96,20 +153,38 @@ public:
      * assert(! goto_default);
      */
     int ntAction(int state, int sym) {
-        return _baseAction[state + sym];
+        return _compactBaseAction[state + sym];
     }
 
     /**
      * assert(! shift_default);
      */
     int tAction(int state, int sym) {
-        int i = _baseAction[state],
-            k = i + sym;
-        return _termAction[_termCheck[k] == sym ? k : i];
+#ifdef LPG_PROFILE_PARSE_TABLES
+        if (_profile)
+            _profile->recordAction(state, sym);
+#endif
+        unsigned row = (unsigned) (state - _denseFirst);
+        if (row < _denseStates && (unsigned) sym < _denseWidth)
+            return _denseActions[row * _denseWidth + sym];
+        return CompactIntArray::withElementType(_compactBaseAction.width, [&](auto base_action) {
+            return CompactIntArray::withElementType(_compactTermCheck.width, [&](auto term_check) {
+                return CompactIntArray::withElementType(_compactTermAction.width, [&](auto term_action) {
+                    return compactTAction<decltype(base_action), decltype(term_check), decltype(term_action)>(state, sym);
+                });
+            });
+        });
     }
     int lookAhead(int la_state, int sym) {
-        int k = la_state + sym;
-        return _termAction[_termCheck[k] == sym ? k : la_state];
+#ifdef LPG_PROFILE_PARSE_TABLES
+        if (_profile)
+            _profile->recordLookahead(la_state);
+#endif
+        return CompactIntArray::withElementType(_compactTermCheck.width, [&](auto term_check) {
+            return CompactIntArray::withElementType(_compactTermAction.width, [&](auto term_action) {
+                return compactLookAhead<decltype(term_check), decltype(term_action)>(la_state, sym);
+            });
+        });
     }
 
 	
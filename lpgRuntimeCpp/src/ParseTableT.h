@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+#include "CompactIntArray.h"
+#include "DenseActionRows.h"
+#include "Exception.h"
+#include "GeneratedParseTable.h"
+#include "ParseTable.h"
+#include "ParseTableProfile.h"
+
+//
+// A class written by DirectCodeGenerator codes its terminal actions as
+// switch blocks (directTAction, directLookAhead) and says so with
+// "constexpr static bool DIRECT_CODED = true".
+//
+template <class Prs, class = void>
+struct IsDirectCoded : std::false_type
+{
+};
+
+template <class Prs>
+struct IsDirectCoded<Prs, std::void_t<decltype(Prs::DIRECT_CODED)>> : std::bool_constant<Prs::DIRECT_CODED>
+{
+};
+
+//
+// Compile-time view of a generated parse table class (e.g. JavaParserprs).
+//
+// The generated *prs classes publish their constants as "constexpr static"
+// members and their tables as "inline static" arrays. ParseTableT reads them
+// directly instead of going through a heap allocated ParseTableProxy, so that
+// the compiler can inline tAction/ntAction/lookAhead and fold the comparisons
+// against NUM_RULES, ERROR_ACTION, LA_STATE_OFFSET, ... into immediates.
+//
+// It has the same lookup functions as ParseTableProxy, all of them static
+// but tAction. When Prs is direct coded, tAction and lookAhead use its switch blocks.
+//
+// Like ParseTableProxy, the lookups read copies of the four hot arrays
+// stored with the narrowest element type. Here the types are picked at
+// compile time from bounds on the values of each array, and the copies are
+// static arrays, so that their address stays a link-time constant. They are
+// filled by prepare, which the specialized parsers call when they are reset.
+//
+// Dense terminal action rows installed for the table (see DenseActionRows)
+// are looked up by prepare, at every reset, and kept in the ParseTableT of
+// the parser. tAction reads them before the compressed arrays, unless Prs
+// is direct coded.
+//
+// When LPG_PROFILE_PARSE_TABLES is defined, tAction and lookAhead record
+// into the profile installed for the table (see ParseTableProfile), which
+// prepare looks up again at every reset and keeps, like the dense rows, in
+// the ParseTableT of the parser. Without it, they record nothing and do
+// not test for a profile.
+//
+template <class Prs>
+struct ParseTableT
+{
+    static_assert(std::is_base_of<ParseTable, Prs>::value,
+                  "ParseTableT expects a generated *prs class derived from ParseTable");
+
+    constexpr static int ERROR_SYMBOL = Prs::ERROR_SYMBOL;
+    constexpr static int NUM_STATES = Prs::NUM_STATES;
+    constexpr static int NT_OFFSET = Prs::NT_OFFSET;
+    constexpr static int LA_STATE_OFFSET = Prs::LA_STATE_OFFSET;
+    constexpr static int MAX_LA = Prs::MAX_LA;
+    constexpr static int NUM_RULES = Prs::NUM_RULES;
+    constexpr static int NUM_NONTERMINALS = Prs::NUM_NONTERMINALS;
+    constexpr static int NUM_SYMBOLS = Prs::NUM_SYMBOLS;
+    constexpr static int START_STATE = Prs::START_STATE;
+    constexpr static int EOFT_SYMBOL = Prs::EOFT_SYMBOL;
+    constexpr static int ACCEPT_ACTION = Prs::ACCEPT_ACTION;
+    constexpr static int ERROR_ACTION = Prs::ERROR_ACTION;
+    constexpr static bool BACKTRACK = Prs::BACKTRACK;
+
+    constexpr static int BASE_CHECK_LENGTH = sizeof(Prs::_baseCheck) / sizeof(Prs::_baseCheck[0]);
+    constexpr static int BASE_ACTION_LENGTH = sizeof(Prs::_baseAction) / sizeof(Prs::_baseAction[0]);
+    constexpr static int TERM_CHECK_LENGTH = sizeof(Prs::_termCheck) / sizeof(Prs::_termCheck[0]);
+    constexpr static int TERM_ACTION_LENGTH = sizeof(Prs::_termAction) / sizeof(Prs::_termAction[0]);
+
+    //
+    // baseCheck holds rule lengths, symbols and negated states; baseAction
+    // holds offsets in baseAction and termCheck, left-hand side symbols
+    // and goto actions (states and goto-reduce actions, all of them below
+    // LA_STATE_OFFSET); termCheck holds terminal symbols; termAction holds
+    // actions and lookahead states, which are offsets in termCheck above
+    // LA_STATE_OFFSET.
+    //
+    typedef NarrowestInt<std::max(NUM_SYMBOLS, NUM_STATES)> BaseCheckType;
+    typedef NarrowestInt<std::max({ BASE_ACTION_LENGTH, TERM_CHECK_LENGTH, LA_STATE_OFFSET, NUM_SYMBOLS })>
+        BaseActionType;
+    typedef NarrowestInt<NT_OFFSET> TermCheckType;
+    typedef NarrowestInt<LA_STATE_OFFSET + TERM_CHECK_LENGTH> TermActionType;
+
+    inline static BaseCheckType compactBaseCheck[BASE_CHECK_LENGTH];
+    inline static BaseActionType compactBaseAction[BASE_ACTION_LENGTH];
+    inline static TermCheckType compactTermCheck[TERM_CHECK_LENGTH];
+    inline static TermActionType compactTermAction[TERM_ACTION_LENGTH];
+
+    std::shared_ptr<DenseActionRows> denseRows;
+    const int* denseActions = nullptr;
+    int denseFirst = 0;
+    unsigned denseStates = 0;
+    unsigned denseWidth = 0;
+
+#ifdef LPG_PROFILE_PARSE_TABLES
+    std::shared_ptr<ParseTableProfile> profile;
+#endif
+
+    //
+    // Fill the narrowed arrays, the first time only, and look up the dense
+    // rows. prs is the table given to the parser, which must be a Prs.
+    //
+    void prepare(ParseTable* prs)
+    {
+        static const bool narrowed = (narrow(), true);
+        (void) narrowed;
+        findDenseRows(prs);
+#ifdef LPG_PROFILE_PARSE_TABLES
+        profile = ParseTableProfile::find(prs);
+#endif
+    }
+
+    //
+    // _rhs and _lhs are aliases of _baseCheck and _baseAction in the
+    // generated tables.
+    //
+    static int rhs(int index) { return compactBaseCheck[index]; }
+    static int lhs(int index) { return compactBaseAction[index]; }
+    static int baseAction(int index) { return compactBaseAction[index]; }
+
+    /**
+     * assert(! goto_default);
+     */
+    static int ntAction(int state, int sym)
+    {
+        return compactBaseAction[state + sym];
+    }
+
+    /**
+     * assert(! shift_default);
+     */
+    int tAction(int state, int sym) const
+    {
+#ifdef LPG_PROFILE_PARSE_TABLES
+        if (profile)
+            profile->recordAction(state, sym);
+#endif
+        if constexpr (IsDirectCoded<Prs>::value)
+            return Prs::directTAction(state, sym);
+        else
+        {
+            unsigned row = (unsigned) (state - denseFirst);
+            if (row < denseStates && (unsigned) sym < denseWidth)
+                return denseActions[row * denseWidth + sym];
+            int i = compactBaseAction[state],
+                k = i + sym;
+            return compactTermAction[compactTermCheck[k] == sym ? k : i];
+        }
+    }
+
+    int lookAhead(int la_state, int sym) const
+    {
+#ifdef LPG_PROFILE_PARSE_TABLES
+        if (profile)
+            profile->recordLookahead(la_state);
+#endif
+        if constexpr (IsDirectCoded<Prs>::value)
+            return Prs::directLookAhead(la_state, sym);
+        else
+        {
+            int k = la_state + sym;
+            return compactTermAction[compactTermCheck[k] == sym ? k : la_state];
+        }
+    }
+
+    //
+    // A shared instance of the table, for the cold paths (error recovery,
+    // diagnosis) that still need the dynamic ParseTable interface.
+    //
+    static ParseTable* instance()
+    {
+        static GeneratedParseTable<Prs> table;
+        return &table;
+    }
+
+private:
+    template <typename T, int N>
+    static void copy(const signed int (&values)[N], T (&compact)[N])
+    {
+        for (int i = 0; i < N; i++)
+        {
+            if (values[i] != static_cast<T>(values[i]))
+                throw BadParseTableFileException("ParseTableT: a value of the table is out of the bounds of its type");
+            compact[i] = static_cast<T>(values[i]);
+        }
+    }
+
+    void findDenseRows(ParseTable* prs)
+    {
+        denseRows = DenseActionRows::find(prs);
+        denseActions = (denseRows ? denseRows->actions.data() : nullptr);
+        denseFirst = (denseRows ? denseRows->firstState : 0);
+        denseStates = (denseRows ? static_cast<unsigned>(denseRows->count) : 0);
+        denseWidth = (denseRows ? static_cast<unsigned>(denseRows->width) : 0);
+    }
+
+    static void narrow()
+    {
+        copy(Prs::_baseCheck, compactBaseCheck);
+        copy(Prs::_baseAction, compactBaseAction);
+        copy(Prs::_termCheck, compactTermCheck);
+        copy(Prs::_termAction, compactTermAction);
+    }
+};
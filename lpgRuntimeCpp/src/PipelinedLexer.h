@@ -0,0 +1,358 @@
+#pragma once
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AbstractToken.h"
+#include "ITokenSource.h"
+#include "LexParser.h"
+#include "LexStream.h"
+#include "Monitor.h"
+#include "PrsStream.h"
+
+//
+// Lex the input of a lexer on a thread of its own while the parser reads
+// the tokens on this one:
+//
+//     JavaLexer lexer(file_name, tab);
+//     JavaParser parser(lexer.getILexStream());
+//     PipelinedLexer<JavaLexer> pipeline(lexer, nullptr, parser.getIPrsStream());
+//     auto ast = parser.parser();
+//
+// The lexer thread lexes with a lexer of its own into a PrsStream of its
+// own, and hands the tokens and adjuncts over, in the order in which they
+// were made, through a single producer, single consumer ring. A lexical
+// error goes in the ring before the first token or adjunct that ends at
+// or after its left_loc: after the ones that end before it, and before
+// the one it was found in, which is only made once it is scanned. The stream of the parser is fed as with PullLexer: when
+// the parser gets to the end of the tokens received so far
+// (PrsStream::getNext), those in the ring are added to the stream as
+// makeToken and makeAdjunct would have added them, and the lexical errors
+// reported. As all of them stay in the stream, lookahead and the resets
+// of the backtracking and recovery parsers work as before, within the
+// tokens received so far.
+//
+// A thread that cannot go on (the parser, when the ring is empty; the
+// lexer, when it is full) spins for a while, then yields, then waits to be
+// notified. The lexer thread costs time of its own: its lexer indexes the
+// lines of the input again, and the tokens cross from a core to another.
+// It can only pay off for large inputs with a core to spare; on a single
+// core it is slower than lexing first (see JavaExample -pull). Lexer is a lexer generated from LexerTemplateF.gi (see
+// ParallelLexer); its rule actions must not keep any state from a token
+// to the next. The PipelinedLexer must outlive the parse: when it is
+// destroyed, the lexer thread is stopped.
+//
+template <class Lexer>
+struct PipelinedLexer : public ITokenSource, public Monitor
+{
+    constexpr static int RING_SIZE = 1 << 12, // a power of 2
+                         PUBLISH_SIZE = 64,   // how many entries the lexer thread makes visible at once
+                         SPINS = 1 << 10,
+                         YIELDS = 1 << 6;
+
+    //
+    // Start lexing the input of lexer into prsStream, as
+    // lexer.lexer(monitor, prsStream) does. A token stream that is not a
+    // PrsStream is lexed all at once. The monitor, if any, is asked from
+    // the lexer thread.
+    //
+    PipelinedLexer(Lexer& lexer, Monitor* monitor, IPrsStream* prsStream) :
+        lexer(lexer), monitor(monitor), prsStream(dynamic_cast<PrsStream*>(prsStream)), ring(RING_SIZE)
+    {
+        if (this->prsStream == nullptr)
+        {
+            lexer.lexer(monitor, prsStream);
+            return;
+        }
+        lexer.initializeLexer(prsStream, 0, -1);
+        this->prsStream->setStreamLength();
+        this->prsStream->setTokenSource(this);
+
+        LexStream* stream = static_cast<LexStream*>(lexer.getILexStream());
+        thread = std::thread(&PipelinedLexer::lexInput, this, stream->getInputChars(), stream->getFileName(),
+                             stream->getTab(), this->prsStream->kindMap);
+    }
+
+    PipelinedLexer(const PipelinedLexer&) = delete;
+    PipelinedLexer& operator=(const PipelinedLexer&) = delete;
+
+    ~PipelinedLexer()
+    {
+        if (thread.joinable())
+        {
+            stop.store(true);
+            notify(not_full);
+            thread.join();
+        }
+        for (std::size_t i = head.load(); i != tail.load(); i++)
+            delete ring[i & (RING_SIZE - 1)].error;
+        if (prsStream != nullptr)
+        {
+            prsStream->adoptTokenPools(tokens);
+            if (prsStream->tokenSource == this)
+                prsStream->setTokenSource(nullptr);
+        }
+    }
+
+    //
+    // Receive the rest of the tokens.
+    //
+    void lexAll()
+    {
+        while (prsStream != nullptr && prsStream->tokenSource == this)
+            lexMore();
+    }
+
+    //
+    // Add the entries in the ring to the stream, once there are some.
+    //
+    void lexMore() override
+    {
+        std::size_t first = head.load(std::memory_order_relaxed),
+                    last = tail.load(std::memory_order_acquire);
+        for (int spins = 0; first == last; spins++)
+        {
+            if (spins < SPINS + YIELDS)
+            {
+                if (spins >= SPINS)
+                    std::this_thread::yield();
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                parser_waiting.store(true);
+                not_empty.wait(lock, [&] { return tail.load() != first; });
+                parser_waiting.store(false);
+            }
+            last = tail.load(std::memory_order_acquire);
+        }
+
+        bool end = false;
+        for (std::size_t i = first; i != last; i++)
+        {
+            Entry& entry = ring[i & (RING_SIZE - 1)];
+            if (entry.kind == Entry::TOKEN_ENTRY && entry.token == nullptr)
+                prsStream->addToken(entry.start_offset, entry.end_offset, entry.token_kind);
+            else if (entry.kind == Entry::TOKEN_ENTRY)
+            {
+                static_cast<AbstractToken*>(entry.token)->iPrsStream = prsStream;
+                prsStream->addToken(entry.token);
+            }
+            else if (entry.kind == Entry::ADJUNCT_ENTRY)
+            {
+                static_cast<AbstractToken*>(entry.token)->iPrsStream = prsStream;
+                prsStream->addAdjunct(entry.token);
+            }
+            else if (entry.kind == Entry::ERROR_ENTRY)
+            {
+                const LexStream::LexicalError& error = *entry.error;
+                static_cast<LexStream*>(lexer.getILexStream())->reportLexicalError(error.errorCode,
+                    error.left_loc, error.right_loc, error.error_left_loc, error.error_right_loc, error.errorInfo);
+                delete entry.error;
+            }
+            else end = true;
+            entry.token = nullptr;
+            entry.error = nullptr;
+        }
+        head.store(last, std::memory_order_seq_cst);
+        if (lexer_waiting.load())
+            notify(not_full);
+
+        if (!end)
+        {
+            prsStream->setStreamLength();
+            return;
+        }
+
+        thread.join();
+        prsStream->adoptTokenPools(tokens);
+        prsStream->setTokenSource(nullptr);
+        if (failure)
+            std::rethrow_exception(failure);
+        lexer.addEOF(prsStream, end_offset);
+    }
+
+    //
+    // On the lexer thread, before each token, white space or comment:
+    // hand over what was made since the last time, and stop if the
+    // monitor of the lexer says so, or if the PipelinedLexer is destroyed.
+    //
+    bool isCancelled() override
+    {
+        if (tokens.getSize() + tokens.adjuncts.size() + static_cast<int>(errors.size()) >= PUBLISH_SIZE)
+            publish();
+        return stop.load(std::memory_order_relaxed) || (monitor != nullptr && monitor->isCancelled());
+    }
+
+private:
+    struct Entry
+    {
+        enum Kind
+        {
+            TOKEN_ENTRY,
+            ADJUNCT_ENTRY,
+            ERROR_ENTRY,
+            END_ENTRY
+        } kind = END_ENTRY;
+        IToken* token = nullptr; // nullptr for a token that has no object (see PrsStream::getIToken)
+        LexStream::LexicalError* error = nullptr;
+        int token_kind = 0,
+            start_offset = 0,
+            end_offset = 0;
+    };
+
+    Lexer& lexer;
+    Monitor* monitor;
+    PrsStream* prsStream;
+
+    std::vector<Entry> ring;
+    alignas(64) std::atomic<std::size_t> head{ 0 }; // the next entry that the parser reads
+    alignas(64) std::atomic<std::size_t> tail{ 0 }; // the next entry that the lexer thread writes
+    alignas(64) std::atomic<bool> parser_waiting{ false },
+                                  lexer_waiting{ false },
+                                  stop{ false };
+    std::mutex mutex;
+    std::condition_variable not_empty,
+                            not_full;
+
+    std::thread thread;
+    std::exception_ptr failure;
+    int end_offset = 0;
+
+    //
+    // On the lexer thread: its stream and errors. The tokens handed over
+    // stay in the token pool of the stream, which the stream of the parser
+    // adopts in the end.
+    //
+    PrsStream tokens;
+    std::vector<LexStream::LexicalError> errors;
+    std::size_t free_until = 0; // the entries before it are free
+
+    void notify(std::condition_variable& condition)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        condition.notify_one();
+    }
+
+    //
+    // Make the entries before end visible to the parser.
+    //
+    void release(std::size_t end)
+    {
+        tail.store(end, std::memory_order_seq_cst);
+        if (parser_waiting.load())
+            notify(not_empty);
+    }
+
+    void lexInput(shared_ptr_wstring input_chars, std::wstring file_name, int tab, shared_ptr_array<int> kindMap)
+    {
+        try
+        {
+            Lexer producer(input_chars, file_name, tab);
+            LexStream* lexStream = static_cast<LexStream*>(producer.getILexStream());
+            lexStream->setPrsStream(&tokens);
+            lexStream->deferredErrors = &errors;
+            tokens.kindMap = kindMap;
+
+            producer.getParser()->lexCharacters(this, 0);
+            publish();
+            end_offset = lexStream->getStreamIndex();
+            lexStream->deferredErrors = nullptr;
+        }
+        catch (...)
+        {
+            failure = std::current_exception();
+        }
+        release(push({}, tail.load(std::memory_order_relaxed)));
+    }
+
+    //
+    // Move the errors, tokens and adjuncts made since the last time to the
+    // ring, with each error at its place among the tokens (see above), and
+    // make them visible to the parser. The errors keep the order in which
+    // they were made, and the adjuncts that precede a token go before it.
+    // The tuples of the stream are emptied, to be filled again in the
+    // cache: the tokens that the parser receives are given their indices by
+    // addToken and addAdjunct, and a token that has no object is passed by
+    // its entry in the token store.
+    //
+    void publish()
+    {
+        std::size_t end = tail.load(std::memory_order_relaxed);
+        std::size_t e = 0;
+        auto pushErrors = [&](int offset)
+        {
+            for (; e < errors.size() && errors[e].left_loc <= offset; e++)
+                end = push({ Entry::ERROR_ENTRY, nullptr, new LexStream::LexicalError(std::move(errors[e])) }, end);
+        };
+        auto pushAdjuncts = [&](int k, int last)
+        {
+            for (; k < last; k++)
+            {
+                pushErrors(tokens.adjunctStore.endOffsets[k]);
+                end = push({ Entry::ADJUNCT_ENTRY, tokens.adjuncts[k], nullptr }, end);
+            }
+            return k;
+        };
+
+        const TokenStore& store = tokens.tokenStore;
+        int k = 0;
+        for (int t = 0; t < tokens.tokens.size(); t++)
+        {
+            k = pushAdjuncts(k, store.adjunctIndexes[t]);
+            pushErrors(store.endOffsets[t]);
+            end = push({ Entry::TOKEN_ENTRY, tokens.tokens[t], nullptr,
+                         store.kinds[t], store.startOffsets[t], store.endOffsets[t] }, end);
+        }
+        pushAdjuncts(k, tokens.adjuncts.size());
+        pushErrors(INT_MAX);
+        errors.clear();
+
+        tokens.tokens.reset();
+        tokens.adjuncts.reset();
+        tokens.tokenStore.resize(0);
+        tokens.adjunctStore.resize(0);
+        release(end);
+    }
+
+    //
+    // Write an entry at end, once the ring has room for it, and return
+    // where the next one goes. When the PipelinedLexer is destroyed, the
+    // entry is not written (its token stays in the pool).
+    //
+    std::size_t push(const Entry& entry, std::size_t end)
+    {
+        for (int spins = 0; end == free_until; spins++)
+        {
+            free_until = head.load(std::memory_order_acquire) + RING_SIZE;
+            if (end != free_until)
+                break;
+            if (stop.load())
+            {
+                delete entry.error;
+                return end;
+            }
+            if (spins < SPINS + YIELDS)
+            {
+                if (spins >= SPINS)
+                    std::this_thread::yield();
+                continue;
+            }
+
+            //
+            // Let the parser have what was written so far, and wait.
+            //
+            release(end);
+            std::unique_lock<std::mutex> lock(mutex);
+            lexer_waiting.store(true);
+            not_full.wait(lock, [&] { return head.load() + RING_SIZE != end || stop.load(); });
+            lexer_waiting.store(false);
+        }
+        ring[end & (RING_SIZE - 1)] = entry;
+        return end + 1;
+    }
+};
@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "ObjectTuple.h"
+
+//
+// The line and the column of an offset, found without a scan of its line:
+//
+//     . the line is found in the offsets of the line feeds, made
+//       contiguous (see Tuple::Contiguous), by a binary search, unless it
+//       is the line found the last time or the next one: the next question
+//       (the column of the same offset, the end of the same token, the next
+//       token) is likely to be about one of them;
+//
+//     . the tabs of the input are indexed the first time a column is
+//       asked for, each with where its line would start if the tabs up to
+//       it were expanded to the tab stops. The column of an offset is then
+//       its distance from the expanded start of its line, as of the last
+//       tab before it on the line.
+//
+// The tabs must be indexed again (invalidate) when the characters, the
+// line feeds or the size of a tab change.
+//
+// Several threads may ask for lines and columns at once, as they may read
+// the stream: the line offsets are only read (if they are not contiguous,
+// they are searched as they are), the line found the last time is a hint
+// that any thread may replace, and the tabs are indexed by the first
+// thread that needs them while the others wait. Changing the stream
+// (invalidate) must not happen at the same time as the questions.
+//
+struct PositionIndex
+{
+    PositionIndex() {}
+
+    //
+    // A copy starts from line 1, and indexes the tabs again.
+    //
+    PositionIndex(const PositionIndex&) {}
+
+    PositionIndex& operator=(const PositionIndex&)
+    {
+        invalidate();
+        return *this;
+    }
+
+    //
+    // The number of the line of offset i (from 1), as given by a binary
+    // search of lineOffsets (see LexStream::getLineNumberOfCharAt).
+    //
+    int lineOf(IntSegmentedTuple& lineOffsets, int i)
+    {
+        int count = lineOffsets.size();
+        if (count == 0)
+            return 1;
+        const int* offsets = lineOffsets.ContiguousElements();
+        if (offsets == nullptr)
+        {
+            int index = binarySearch(lineOffsets, i);
+            return index < 0 ? -index : index == 0 ? 1 : index;
+        }
+
+        int last = last_line.load(std::memory_order_relaxed);
+        for (int line = last; line <= count && line <= last + 1; line++)
+        {
+            if (offsets[line - 1] < i && (line == count || i <= offsets[line]))
+            {
+                if (line != last)
+                    last_line.store(line, std::memory_order_relaxed);
+                return line;
+            }
+        }
+
+        int line = static_cast<int>(std::lower_bound(offsets, offsets + count, i) - offsets);
+        if (line > 0)
+            last_line.store(line, std::memory_order_relaxed);
+        return (line == 0 ? 1 : line);
+    }
+
+    //
+    // Where the line of offset i, which starts after the line feed at
+    // start, would start if its tabs before i were expanded.
+    //
+    template <typename Char>
+    int expandedStart(const Char* chars, int length, IntSegmentedTuple& lineOffsets, int tab, int start, int i)
+    {
+        if (!tabs_indexed.load(std::memory_order_acquire) || tab != tab_size)
+        {
+            std::lock_guard<std::mutex> lock(tabs_mutex);
+            if (!tabs_indexed.load(std::memory_order_relaxed) || tab != tab_size)
+                indexTabs(chars, length, lineOffsets, tab);
+        }
+        int k = static_cast<int>(std::lower_bound(tabs.begin(), tabs.end(), i) - tabs.begin()) - 1;
+        return (k >= 0 && tabs[k] > start ? expanded_starts[k] : start);
+    }
+
+    void invalidate()
+    {
+        tabs_indexed.store(false, std::memory_order_relaxed);
+        tabs.clear();
+        expanded_starts.clear();
+    }
+
+private:
+    std::atomic<int> last_line{ 1 };
+
+    std::mutex tabs_mutex;
+    std::atomic<bool> tabs_indexed{ false };
+    int tab_size = 0;
+    std::vector<int> tabs,
+                     expanded_starts;
+
+    template <typename Char>
+    void indexTabs(const Char* chars, int length, IntSegmentedTuple& lineOffsets, int tab)
+    {
+        tabs.clear();
+        expanded_starts.clear();
+        int line = 0,
+            start = 0;
+        for (const Char* p = std::find(chars, chars + length, '\t'); p < chars + length;
+             p = std::find(p + 1, chars + length, '\t'))
+        {
+            int k = static_cast<int>(p - chars),
+                tab_line = lineOf(lineOffsets, k);
+            if (tab_line != line)
+            {
+                line = tab_line;
+                start = lineOffsets[line - 1];
+            }
+            int offset = (k - start) - 1;
+            start -= ((tab - 1) - offset % tab);
+            tabs.push_back(k);
+            expanded_starts.push_back(start);
+        }
+        tab_size = tab;
+        tabs_indexed.store(true, std::memory_order_release);
+    }
+};
@@ -1,6 +1,7 @@
 #include "PrsStream.h"
 
 #include <iostream>
+#include <new>
 
 #include "ILexStream.h"
 #include "Exception.h"
@@ -70,24 +71,79 @@ void PrsStream::remapTerminalSymbols(const std::vector<std::wstring>& ordered_pa
 }
 void PrsStream::internalResetTokenStream()
 {
-	for (int i = 0; i < tokens.size(); ++i)
+	if (heapTokens > 0)
 	{
-		delete tokens[i];
+		auto deleteHeapToken = [](IToken* token)
+		{
+			auto t = dynamic_cast<AbstractToken*>(token);
+			if (t == nullptr || !t->pooled)
+				delete token;
+		};
+		for (int i = 0; i < tokens.size(); ++i)
+			deleteHeapToken(tokens[i]);
+		for (int i = 0; i < adjuncts.size(); ++i)
+			deleteHeapToken(adjuncts[i]);
+		heapTokens = 0;
 	}
+	if (tokenPool != nullptr)
+		tokenPool->Reset();
+	adoptedPools.clear();
 	tokens.reset();
 	index = 0;
-	for (int i = 0; i < adjuncts.size(); ++i)
-	{
-		delete adjuncts[i];
-	}
 	adjuncts.reset();
-	rangeTokens.reset();
+	tokenStore.resize(0);
+	adjunctStore.resize(0);
+	tokenSource = nullptr;
 }
 void PrsStream::resetTokenStream()
 {
 	internalResetTokenStream();
 }
 
+template <typename T, typename... Args>
+T* PrsStream::newToken(Args&&... args)
+{
+	if (tokenPool == nullptr)
+		tokenPool = std::make_unique<Jikes::StoragePool>(POOL_TOKENS);
+	T* token = new (tokenPool->Alloc(sizeof(T))) T(std::forward<Args>(args)...);
+	token->pooled = true;
+	token->store = this;
+	return token;
+}
+
+//
+// A token added to the stream is told that its entry is in tokenStore (or
+// adjunctStore). If it is not in a pool, it is deleted when the stream is
+// reset.
+//
+void PrsStream::adoptToken(IToken* token)
+{
+	auto t = dynamic_cast<AbstractToken*>(token);
+	if (t != nullptr)
+		t->store = this;
+	if (t == nullptr || !t->pooled)
+		heapTokens++;
+}
+
+void PrsStream::adoptTokenPools(PrsStream& other)
+{
+	if (other.tokenPool != nullptr)
+		adoptedPools.push_back(std::move(other.tokenPool));
+	for (auto& pool : other.adoptedPools)
+		adoptedPools.push_back(std::move(pool));
+	other.adoptedPools.clear();
+}
+
+//
+// Token i has not been lexed yet: lex up to it, or to the end of file.
+//
+int PrsStream::lexMoreTokens(int i)
+{
+	while (i >= len && tokenSource != nullptr)
+		tokenSource->lexMore();
+	return (i < len ? i : len - 1);
+}
+
 void PrsStream::setLexStream(ILexStream* lexStream)
 {
 	this->iLexStream = lexStream;
@@ -97,17 +153,53 @@ void PrsStream::setLexStream(ILexStream* lexStream)
 void PrsStream::resetLexStream(LexStream* lexStream)
 {
 	this->iLexStream = lexStream;
+	invalidateTokenPositions();
 	if (lexStream != nullptr) lexStream->setPrsStream(this);
 }
 
 void PrsStream::makeToken(int startLoc, int endLoc, int kind)
 {
-	Token* token = new Token(this, startLoc, endLoc, mapKind(kind));
-	token->setTokenIndex(tokens.size());
-	tokens.add(token);
-	rangeTokens.add(token);
-	token->setAdjunctIndex(adjuncts.size());
-	
+	addToken(startLoc, endLoc, mapKind(kind));
+}
+
+void PrsStream::addToken(int startLoc, int endLoc, int kind)
+{
+	tokens.add(nullptr);
+	tokenStore.add(kind, startLoc, endLoc, adjuncts.size());
+}
+
+//
+// Make the object of token i, which makeToken did not make.
+//
+IToken* PrsStream::makeTokenObject(int i)
+{
+	Token* token = newToken<Token>(this, tokenStore.startOffsets[i], tokenStore.endOffsets[i], tokenStore.kinds[i]);
+	token->setTokenIndex(i);
+	token->setAdjunctIndex(tokenStore.adjunctIndexes[i]);
+	tokens[i] = token;
+	return token;
+}
+
+Tuple<IToken*> PrsStream::getTokens()
+{
+	for (int i = 0; i < tokens.size(); i++)
+		getIToken(i);
+	return tokens;
+}
+
+Tuple<IToken*> PrsStream::getRangeTokens()
+{
+	Tuple<IToken*> range_tokens;
+	int k = 0;
+	for (int i = 0; i < tokens.size(); i++)
+	{
+		for (; k < tokenStore.adjunctIndexes[i]; k++)
+			range_tokens.add(adjuncts[k]);
+		range_tokens.add(getIToken(i));
+	}
+	for (; k < adjuncts.size(); k++)
+		range_tokens.add(adjuncts[k]);
+	return range_tokens;
 }
 
 void PrsStream::makeToken(IToken* token, int offset_adjustment)
@@ -116,10 +208,10 @@ void PrsStream::makeToken(IToken* token, int offset_adjustment)
 	token->setEndOffset(token->getEndOffset() + offset_adjustment);
 
 	token->setTokenIndex(tokens.size());
-	rangeTokens.add(token);
-	tokens.add(token);
 	token->setAdjunctIndex(adjuncts.size());
-
+	tokens.add(token);
+	tokenStore.add(token);
+	adoptToken(token);
 }
 
 void PrsStream::removeLastToken()
@@ -138,9 +230,10 @@ void PrsStream::removeLastToken()
 	 * SegmentedTuple implementation
 	 */
 	int last_index = tokens.size() - 1;
-	Token* token = (Token*)tokens.get(last_index);
-	adjuncts.reset(token->getAdjunctIndex());
+	adjuncts.reset(tokenStore.adjunctIndexes[last_index]);
+	adjunctStore.resize(adjuncts.size());
 	tokens.reset(last_index);
+	tokenStore.resize(last_index);
 }
 
 int PrsStream::makeErrorToken(int firsttok, int lasttok, int errortok, int kind)
@@ -153,35 +246,46 @@ int PrsStream::makeErrorToken(int firsttok, int lasttok, int errortok, int kind)
 	// the calling program (a parser driver) to pass to us the proper kind
 	// that it wants for an error token->
 	//
-	Token* token = new ErrorToken(getIToken(firsttok),
+	Token* token = newToken<ErrorToken>(getIToken(firsttok),
 	                               getIToken(lasttok),
 	                               getIToken(errortok),
 	                               getStartOffset(firsttok),
 	                               getEndOffset(lasttok),
 	                               kind);
 	token->setTokenIndex(tokens.size());
-	tokens.add(token);
 	token->setAdjunctIndex(adjuncts.size());
-	rangeTokens.add(token);
+	tokens.add(token);
+	tokenStore.add(token);
 	return index;
 }
 
 void PrsStream::addToken(IToken* token)
 {
 	token->setTokenIndex(tokens.size());
-	tokens.add(token);
 	token->setAdjunctIndex(adjuncts.size());
-	rangeTokens.add(token);
+	tokens.add(token);
+	tokenStore.add(token);
+	adoptToken(token);
+}
+
+void PrsStream::updateToken(IToken* token)
+{
+	int i = token->getTokenIndex();
+	if (i >= 0 && i < tokenStore.size() && tokens[i] == token)
+		tokenStore.set(i, token);
+	int k = token->getAdjunctIndex();
+	if (k >= 0 && k < adjunctStore.size() && adjuncts[k] == token)
+		adjunctStore.set(k, token);
 }
 
 void PrsStream::makeAdjunct(int startLoc, int endLoc, int kind)
 {
 	int token_index = tokens.size() - 1; // index of last token processed
-	auto adjunct = new Adjunct(this, startLoc, endLoc, mapKind(kind));
+	auto adjunct = newToken<Adjunct>(this, startLoc, endLoc, mapKind(kind));
 	adjunct->setAdjunctIndex(adjuncts.size());
 	adjunct->setTokenIndex(token_index);
 	adjuncts.add(adjunct);
-	rangeTokens.add(adjunct);
+	adjunctStore.add(adjunct);
 }
 
 void PrsStream::makeAdjunct(IToken* adjunct, int offset_adjustment)
@@ -193,7 +297,8 @@ void PrsStream::makeAdjunct(IToken* adjunct, int offset_adjustment)
 	adjunct->setAdjunctIndex(adjuncts.size());
 	adjunct->setAdjunctIndex(token_index);
 	adjuncts.add(adjunct);
-	rangeTokens.add(adjunct);
+	adjunctStore.add(adjunct);
+	adoptToken(adjunct);
 }
 
 void PrsStream::addAdjunct(IToken* adjunct)
@@ -202,55 +307,80 @@ void PrsStream::addAdjunct(IToken* adjunct)
 	adjunct->setTokenIndex(token_index);
 	adjunct->setAdjunctIndex(adjuncts.size());
 	adjuncts.add(adjunct);
-	rangeTokens.add(adjunct);
+	adjunctStore.add(adjunct);
+	adoptToken(adjunct);
 }
 
 std::wstring PrsStream::getTokenText(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return t->toString();
+	IToken* t = tokens.get(i);
+	return (t != nullptr ? t->toString() : iLexStream->toString(tokenStore.startOffsets[i], tokenStore.endOffsets[i]));
 }
 
 int PrsStream::getStartOffset(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return t->getStartOffset();
+	return tokenStore.startOffsets[i];
 }
 
 int PrsStream::getEndOffset(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return t->getEndOffset();
+	return tokenStore.endOffsets[i];
 }
 
 int PrsStream::getTokenLength(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return t->getEndOffset() - t->getStartOffset() + 1;
+	return tokenStore.endOffsets[i] - tokenStore.startOffsets[i] + 1;
+}
+
+//
+// The lines and columns of the tokens are found all at once, in the order
+// of their offsets, which the line lookups of the lex stream are fastest
+// for (see PositionIndex), and kept in the token store. The store may grow
+// while they are found, so they are read under positionsMutex as well.
+//
+void PrsStream::positionTokens(int i)
+{
+	if (i < tokenStore.positioned)
+		return;
+	tokenStore.positionAll([this](int offset, int& line, int& column)
+	{
+		line = iLexStream->getLineNumberOfCharAt(offset);
+		column = iLexStream->getColumnOfCharAt(offset);
+	});
 }
 
 int PrsStream::getLineNumberOfTokenAt(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return iLexStream->getLineNumberOfCharAt(t->getStartOffset());
+	std::lock_guard<std::mutex> lock(positionsMutex);
+	positionTokens(i);
+	return tokenStore.lines[i];
 }
 
 int PrsStream::getEndLineNumberOfTokenAt(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return iLexStream->getLineNumberOfCharAt(t->getEndOffset());
+	std::lock_guard<std::mutex> lock(positionsMutex);
+	positionTokens(i);
+	return tokenStore.endLines[i];
 }
 
 int PrsStream::getColumnOfTokenAt(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return iLexStream->getColumnOfCharAt(t->getStartOffset());
+	std::lock_guard<std::mutex> lock(positionsMutex);
+	positionTokens(i);
+	return tokenStore.columns[i];
 }
 
 int PrsStream::getEndColumnOfTokenAt(int i)
 {
-	IToken* t = (IToken*)tokens.get(i);
-	return iLexStream->getColumnOfCharAt(t->getEndOffset());
+	std::lock_guard<std::mutex> lock(positionsMutex);
+	positionTokens(i);
+	return tokenStore.endColumns[i];
+}
+
+void PrsStream::invalidateTokenPositions()
+{
+	std::lock_guard<std::mutex> lock(positionsMutex);
+	tokenStore.positioned = 0;
 }
 
 int PrsStream::getLineOffset(int i)
@@ -320,7 +450,7 @@ void PrsStream::addTokensInRangeToList(std::vector<IToken*>& list, IToken* start
 	//
 	for (; token_index < tokens.size(); token_index++)
 	{
-		IToken* token = tokens.get(token_index);
+		IToken* token = getIToken(token_index);
 		list.push_back(token);
 		if (token == end_token)
 			return;
@@ -356,7 +486,7 @@ shared_ptr_string PrsStream::getInputBytes()
 
 std::wstring PrsStream::toString(int first_token, int last_token)
 {
-	return toString((IToken*)tokens.get(first_token), (IToken*)tokens.get(last_token));
+	return iLexStream->toString(tokenStore.startOffsets[first_token], tokenStore.endOffsets[last_token]);
 }
 
 std::wstring PrsStream::toString(IToken* t1, IToken* t2)
@@ -364,30 +494,6 @@ std::wstring PrsStream::toString(IToken* t1, IToken* t2)
 	return iLexStream->toString(t1->getStartOffset(), t2->getEndOffset());
 }
 
-int PrsStream::getTokenIndexAtCharacter(int offset)
-{
-	int low = 0,
-	    high = tokens.size();
-	while (high > low)
-	{
-		int mid = (high + low) / 2;
-		IToken* mid_element = (IToken*)tokens.get(mid);
-		if (offset >= mid_element->getStartOffset() &&
-			offset <= mid_element->getEndOffset())
-			return mid;
-		else if (offset < mid_element->getStartOffset())
-			high = mid;
-		else low = mid + 1;
-	}
-
-	return -(low - 1);
-}
-
-IToken* PrsStream::getIToken(int i)
-{
-	return (IToken*)tokens.get(i);
-}
-
 void PrsStream::dumpTokens()
 {
 	if (getSize() <= 2) return;
@@ -421,7 +527,7 @@ Tuple<IToken*> PrsStream::incrementalResetAtCharacterOffset(int damage_offset)
 	//
 	if (getTokenAt(token_index)->getEndOffset() + 1 < damage_offset)
 	{
-		for (int i = tokens.get(token_index)->getAdjunctIndex();
+		for (int i = tokenStore.adjunctIndexes[token_index];
 		     i < adjuncts.size() && adjuncts.get(i)->getTokenIndex() == token_index;
 		     i++)
 		{
@@ -438,7 +544,7 @@ Tuple<IToken*> PrsStream::incrementalResetAtCharacterOffset(int damage_offset)
 	//
 	int count = (adjunct_index >= 0
 		             ? (adjuncts.size() - adjunct_index)
-		             : (adjuncts.size() - tokens.get(token_index)->getAdjunctIndex()))
+		             : (adjuncts.size() - tokenStore.adjunctIndexes[token_index]))
 		+
 		(tokens.size() - token_index);
 
@@ -447,27 +553,29 @@ Tuple<IToken*> PrsStream::incrementalResetAtCharacterOffset(int damage_offset)
 		assert(token_index < tokens.size());
 
 		token_index++; // next token following adjunct->..
-		for (int i = adjunct_index; i < tokens.get(token_index)->getAdjunctIndex(); i++)
+		for (int i = adjunct_index; i < tokenStore.adjunctIndexes[token_index]; i++)
 			affected_tokens.add(adjuncts.get(i));
 		adjuncts.reset(adjunct_index); // remove all adjuncts from adjunct_index on from the adjunct list
 	}
-	else adjuncts.reset(tokens.get(token_index)->getAdjunctIndex()); // remove all adjuncts associated with token index
+	else adjuncts.reset(tokenStore.adjunctIndexes[token_index]); // remove all adjuncts associated with token index
 	// and all adjuncts following those from the adjunct list.
+	adjunctStore.resize(adjuncts.size());
 
 	//
 	// Add all remaining tokens and their adjuncts to the list of affected tokens.
 	//
 	for (int i = token_index; i < tokens.size() - 1; i++)
 	{
-		affected_tokens.add(tokens.get(i));
-		for (int k = tokens.get(i)->getAdjunctIndex(); k < tokens.get(i + 1)->getAdjunctIndex(); k++)
+		affected_tokens.add(getIToken(i));
+		for (int k = tokenStore.adjunctIndexes[i]; k < tokenStore.adjunctIndexes[i + 1]; k++)
 		{
 			affected_tokens.add(adjuncts.get(k));
 		}
 	}
-	affected_tokens.add(tokens.get(tokens.size() - 1));
+	affected_tokens.add(getIToken(tokens.size() - 1));
 
 	tokens.reset(token_index); // remove all tokens from token_index on from the token list
+	tokenStore.resize(token_index);
 
 	//^System.out.println("***The number of affected tokens is " + count +
 	//*                   "; The size of the array list is " + affected_tokens.size());
@@ -475,25 +583,13 @@ Tuple<IToken*> PrsStream::incrementalResetAtCharacterOffset(int damage_offset)
 	return affected_tokens;
 }
 
-std::vector<IToken*> PrsStream::getAdjuncts(int i)
+AdjunctRange PrsStream::getAdjunctRange(int i)
 {
-	int start_index = ((IToken*)tokens.get(i))->getAdjunctIndex(),
+	int start_index = tokenStore.adjunctIndexes[i],
 	    end_index = (i + 1 == tokens.size()
 		                 ? adjuncts.size()
-		                 : ((IToken*)tokens.get(getNext(i)))->getAdjunctIndex()),
-	    size = end_index - start_index;
-
-	std::vector<IToken*> slice(size,nullptr);
-
-	for (int j = start_index, k = 0; j < end_index; j++, k++)
-		slice[k] = (IToken*)adjuncts.get(j);
-	return slice;
-}
-
-int PrsStream::getKind(int i)
-{
-	IToken* t = (IToken*)tokens.get(i);
-	return t->getKind();
+		                 : tokenStore.adjunctIndexes[getNext(i)]);
+	return AdjunctRange(&adjuncts, start_index, end_index);
 }
 
 std::wstring PrsStream::getFileName()
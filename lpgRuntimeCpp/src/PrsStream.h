@@ -1,8 +1,14 @@
 #pragma once
-
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "IPrsStream.h"
+#include "ITokenSource.h"
 #include "ParseErrorCodes.h"
+#include "StoragePool.h"
+#include "TokenStore.h"
 #include "tuple.h"
 struct LexStream;
 //
@@ -13,11 +19,59 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
 
     ILexStream* iLexStream;
     shared_ptr_array<int> kindMap;
+
+    //
+    // The token objects, in step with tokenStore. The slot of a token made
+    // by makeToken is nullptr until getIToken makes its object.
+    //
     Tuple<IToken*> tokens;
-    Tuple<IToken*> rangeTokens;
     Tuple<IToken*> adjuncts;
+
+    //
+    // The kinds, offsets and adjunct indices of the tokens.
+    //
+    TokenStore tokenStore;
+
+    //
+    // The same for the adjuncts, in step with adjuncts (the adjunct index
+    // of an adjunct is its own).
+    //
+    TokenStore adjunctStore;
+
+    //
+    // Where the last lookups by offset ended (see TokenStore::findOffset).
+    // They are only hints, read and written relaxed, so that threads can
+    // look up offsets at the same time (each one is then faster with a
+    // finger of its own).
+    //
+    std::atomic<int> tokenFinger{ 0 },
+                     adjunctFinger{ 0 };
+
+    //
+    // makeToken, makeAdjunct and makeErrorToken allocate their tokens in
+    // tokenPool (whose first segment is allocated with the first token),
+    // with the pools of the tokens moved here from other streams next to
+    // it, so that resetting the stream releases all of them at once, and
+    // keeps the segments of tokenPool to be used again. Only the tokens
+    // added that are not in a pool (heapTokens of them) are deleted one by
+    // one. The destructors of the tokens in a pool are not run, which is
+    // safe because a token owns nothing: its ext data is a plain pointer
+    // kept in the token (see IToken::setExtData).
+    //
+    constexpr static unsigned POOL_TOKENS = 1 << 16;
+    std::unique_ptr<Jikes::StoragePool> tokenPool;
+    std::vector<std::unique_ptr<Jikes::StoragePool>> adoptedPools;
+    int heapTokens = 0;
     int index = 0;
     int len = 0;
+
+    //
+    // While the tokens are lexed on demand, the source that lexes more of
+    // them when the parser gets to the end of those that have been lexed
+    // (len is then the number of tokens lexed so far). Resetting the
+    // stream detaches it.
+    //
+    ITokenSource* tokenSource = nullptr;
     ~PrsStream();
     PrsStream();
 
@@ -38,6 +92,9 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
      */
     void resetLexStream(LexStream* lexStream);
 
+    //
+    // Add a token, without an object (see getIToken).
+    //
     void makeToken(int startLoc, int endLoc, int kind);
 
     /**
@@ -53,6 +110,22 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
 
     void addToken(IToken* token);
 
+    //
+    // Add a token as makeToken does, with a kind that is already mapped.
+    //
+    void addToken(int startLoc, int endLoc, int kind);
+
+    //
+    // Keep the tokens that other allocated in its pools (those moved here
+    // by ParallelLexer or PipelinedLexer) until this stream is reset.
+    //
+    void adoptTokenPools(PrsStream& other);
+
+    //
+    // The kind or the offsets of token were set after it was added.
+    //
+    void updateToken(IToken* token);
+
     void makeAdjunct(int startLoc, int endLoc, int kind);
 
     /**
@@ -80,6 +153,13 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
 
     int getEndColumnOfTokenAt(int i);
 
+    //
+    // Forget the lines and columns found for the tokens, which the lex
+    // stream calls when its tab, characters or line offsets change. Like
+    // the four functions above, it may be called by several threads.
+    //
+    void invalidateTokenPositions();
+
     std::vector< std::wstring > orderedTerminalSymbols() { return {}; }
 
     /**
@@ -148,7 +228,13 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
     // not exist, it returns the negation of the index of the 
     // element immediately preceding the offset.
     //
-    int getTokenIndexAtCharacter(int offset);
+    // A lookup near the previous one is answered in constant time. A
+    // caller with lookups of its own to make, in another part of the
+    // input or on another thread, can keep its own finger.
+    //
+    int getTokenIndexAtCharacter(int offset) { return findOffset(tokenStore, offset, tokenFinger); }
+
+    int getTokenIndexAtCharacter(int offset, int& finger) { return tokenStore.findOffset(offset, finger); }
 
     IToken* getTokenAtCharacter(int offset)
     {
@@ -156,14 +242,41 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
         return (tokenIndex < 0) ? nullptr : getTokenAt(tokenIndex);
     }
 
-    IToken* getTokenAt(int i) { return (IToken*)tokens.get(i); }
+    //
+    // The same for the adjuncts.
+    //
+    int getAdjunctIndexAtCharacter(int offset) { return findOffset(adjunctStore, offset, adjunctFinger); }
+
+    int getAdjunctIndexAtCharacter(int offset, int& finger) { return adjunctStore.findOffset(offset, finger); }
+
+    IToken* getAdjunctAtCharacter(int offset)
+    {
+        int adjunctIndex = getAdjunctIndexAtCharacter(offset);
+        return (adjunctIndex < 0) ? nullptr : getAdjunctAt(adjunctIndex);
+    }
 
+    IToken* getTokenAt(int i) { return getIToken(i); }
+
+    //
+    // The object of token i, made in the token pool the first time it is
+    // asked for if the token was made by makeToken. Making it writes its
+    // slot in tokens, so the token objects are not to be asked for by
+    // several threads at once; the kinds, offsets, lines and columns that
+    // the stream answers by index do not make them.
+    //
     /**
      * @deprecated replaced by {@link #getTokenAt()}
      */
-    IToken* getIToken(int i);
+    IToken* getIToken(int i)
+    {
+        IToken* token = tokens.get(i);
+        return (token != nullptr ? token : makeTokenObject(i));
+    }
 
-    Tuple<IToken*> getTokens() { return tokens; }
+    //
+    // All the token objects, which are made first.
+    //
+    Tuple<IToken*> getTokens();
 
     int getStreamIndex() { return index; }
 
@@ -194,10 +307,22 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
      * If an update occurred in the input stream, calculate the token (or adjunct)
      * where to start rescanning. Reset the stream accordingly and return the list
      * of starting offset of the tokens that were removed from the stream.
+     *
+     * The tokens returned that were made by makeToken, makeAdjunct or
+     * makeErrorToken stay in the token pool of the stream: they are valid
+     * until the next reset of the stream, which reuses their memory, and must
+     * not be deleted. The tokens that were added with addToken (or made
+     * outside of a pool) are no longer held by the stream, and are given to
+     * the caller.
      */
     Tuple<IToken*> incrementalResetAtCharacterOffset(int damage_offset);
 
-    std::vector<IToken*> getAdjuncts(int i);
+    std::vector<IToken*> getAdjuncts(int i) { return getAdjunctRange(i).toVector(); }
+
+    //
+    // The adjuncts that follow token i, in place (see AdjunctRange).
+    //
+    AdjunctRange getAdjunctRange(int i);
 
     //
     // Return an iterator for the adjuncts that follow token i.
@@ -212,6 +337,10 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
         return getAdjuncts(getPrevious(i));
     }
 
+    AdjunctRange getFollowingAdjunctRange(int i) { return getAdjunctRange(i); }
+
+    AdjunctRange getPrecedingAdjunctRange(int i) { return getAdjunctRange(getPrevious(i)); }
+
     IToken* getAdjunctAt(int i) { return (IToken*)adjuncts.get(i); }
 
     Tuple<IToken*> getAdjuncts() { return adjuncts; }
@@ -230,9 +359,15 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
         return index = (index < end_token ? getNext(index) : len - 1);
     }
 
-    int getKind(int i);
+    //
+    // final, so that the parsers read the kinds of a PrsStream without a
+    // virtual call (see DeterministicParser::kindOf).
+    //
+    int getKind(int i) final { return tokenStore.kinds[i]; }
+
+    int getNext(int i) { return (++i < len ? i : lexMoreTokens(i)); }
 
-    int getNext(int i) { return (++i < len ? i : len - 1); }
+    void setTokenSource(ITokenSource* source) { tokenSource = source; }
 
     int getPrevious(int i) { return (i <= 0 ? 0 : i - 1); }
 
@@ -283,9 +418,35 @@ struct PrsStream :public IPrsStream, public ParseErrorCodes
 
 private:
     void internalResetTokenStream();
-public:
-    Tuple<IToken*> getRangeTokens() override
+
+    template <typename T, typename... Args>
+    T* newToken(Args&&... args);
+
+    void adoptToken(IToken* token);
+
+    IToken* makeTokenObject(int i);
+
+    void positionTokens(int i);
+
+    static int findOffset(const TokenStore& store, int offset, std::atomic<int>& finger)
     {
-       return  rangeTokens;
+        int from = finger.load(std::memory_order_relaxed),
+            to = from,
+            index = store.findOffset(offset, to);
+        if (to != from)
+            finger.store(to, std::memory_order_relaxed);
+        return index;
     }
+
+    //
+    // Held while the lines and columns of the tokens are found or read.
+    //
+    std::mutex positionsMutex;
+
+    int lexMoreTokens(int i);
+public:
+    //
+    // The token objects and the adjuncts, in the order of their offsets.
+    //
+    Tuple<IToken*> getRangeTokens() override;
 };
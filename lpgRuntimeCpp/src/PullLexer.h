@@ -0,0 +1,110 @@
+#pragma once
+#include "ITokenSource.h"
+#include "LexParser.h"
+#include "LexStream.h"
+#include "Monitor.h"
+#include "PrsStream.h"
+
+//
+// Lex the input of a lexer as its parser reads the tokens, instead of all
+// of it before the parser starts: when the parser gets to the end of the
+// tokens lexed so far (PrsStream::getNext), the next batch_size tokens
+// are lexed, and the parser reads them while they are still in the cache.
+// A syntax error is thus found before the rest of the input is lexed.
+//
+//     JavaLexer lexer(file_name, tab);
+//     JavaParser parser(lexer.getILexStream());
+//     PullLexer<JavaLexer> pull(lexer, nullptr, parser.getIPrsStream());
+//     auto ast = parser.parser();
+//
+// The stream grows as it is read: until its end-of-file token is made,
+// getStreamLength() is the number of tokens lexed so far, and only the
+// parsers' way of reading the stream (getToken, peek, getNext...) lexes
+// more. A consumer that needs all the tokens calls lexAll first, or lexes
+// the input with lexer.lexer(monitor, prsStream) as before.
+//
+// A batch stops where a token, white space or comment starts (see
+// LexParser::lexCharacters), and the next one starts there, so the rule
+// actions of the lexer must not keep any state from a token to the next,
+// or change the tokens already made (the generated ones do not). The
+// PullLexer must outlive the parse; the stream is detached from it when
+// it is reset, or when the PullLexer is destroyed.
+//
+template <class Lexer>
+struct PullLexer : public ITokenSource, public Monitor
+{
+    constexpr static int BATCH_SIZE = 256;
+
+    //
+    // Start lexing the input of lexer into prsStream, as
+    // lexer.lexer(monitor, prsStream) does. A token stream that is not a
+    // PrsStream is lexed all at once.
+    //
+    PullLexer(Lexer& lexer, Monitor* monitor, IPrsStream* prsStream, int batch_size = BATCH_SIZE) :
+        lexer(lexer), monitor(monitor), prsStream(dynamic_cast<PrsStream*>(prsStream)), batch_size(batch_size)
+    {
+        if (this->prsStream == nullptr)
+        {
+            lexer.lexer(monitor, prsStream);
+            return;
+        }
+        lexer.initializeLexer(prsStream, 0, -1);
+        this->prsStream->setStreamLength();
+        this->prsStream->setTokenSource(this);
+    }
+
+    PullLexer(const PullLexer&) = delete;
+    PullLexer& operator=(const PullLexer&) = delete;
+
+    ~PullLexer()
+    {
+        if (prsStream != nullptr && prsStream->tokenSource == this)
+            prsStream->setTokenSource(nullptr);
+    }
+
+    //
+    // Lex the rest of the input.
+    //
+    void lexAll()
+    {
+        while (prsStream != nullptr && prsStream->tokenSource == this)
+            lexMore();
+    }
+
+    void lexMore() override
+    {
+        target = prsStream->tokens.size() + batch_size;
+        stopped = false;
+        lexer.getParser()->lexCharacters(this, offset);
+        if (stopped)
+        {
+            offset = lexer.getParser()->curtok;
+            prsStream->setStreamLength();
+            return;
+        }
+
+        prsStream->setTokenSource(nullptr);
+        lexer.addEOF(prsStream, static_cast<LexStream*>(lexer.getILexStream())->getStreamIndex());
+    }
+
+    //
+    // Stop at the end of the batch, or for good when the monitor of the
+    // lexer says so.
+    //
+    bool isCancelled() override
+    {
+        if (monitor != nullptr && monitor->isCancelled())
+            return true;
+        stopped = (prsStream->tokens.size() >= target);
+        return stopped;
+    }
+
+private:
+    Lexer& lexer;
+    Monitor* monitor;
+    PrsStream* prsStream;
+    int batch_size,
+        target = 0,
+        offset = 0; // where the next batch starts
+    bool stopped = false;
+};
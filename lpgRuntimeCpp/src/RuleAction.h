@@ -1,4 +1,7 @@
 #pragma once
+#include <type_traits>
+#include <vector>
+
 #include "AstPoolHolder.h"
 
 struct RuleAction
@@ -6,4 +9,68 @@ struct RuleAction
 	pool_holder _automatic_ast_pool;
 	virtual ~RuleAction() = default;
 	virtual   void ruleAction(int ruleNumber) = 0;
+
+	//
+	// Bitmap of the rules that have an action (bit ruleNumber & 7 of byte
+	// ruleNumber >> 3), or nullptr if it is not known. The parsers use it to
+	// skip the unit reductions that do nothing (see UnitReductions). The
+	// templates of the generated parsers and lexers compute it with
+	// findRuleActions, below.
+	//
+	virtual const unsigned char* getRuleActionMap() { return nullptr; }
+
+	//
+	// Called by the lexer at the beginning of each token, at offset. A lexer
+	// may process there the tokens that it scans faster than its automaton,
+	// such as white space and comments, exactly as its rule actions would,
+	// and return the offset of the character that follows them. By default,
+	// nothing is scanned.
+	//
+	virtual int scanSkippedTokens(int offset) { return offset; }
 };
+
+//
+// Call the ruleAction (scanSkippedTokens) of actions. When Actions is a
+// class derived from RuleAction, the call is qualified (not virtual), so
+// Actions should be the most derived class that implements ruleAction
+// (scanSkippedTokens).
+//
+template <class Actions>
+void applyRuleAction(Actions* actions, int ruleNumber)
+{
+	if constexpr (std::is_same<Actions, RuleAction>::value)
+		actions->ruleAction(ruleNumber);
+	else
+		actions->Actions::ruleAction(ruleNumber);
+}
+
+template <class Actions>
+int applyScanSkippedTokens(Actions* actions, int offset)
+{
+	if constexpr (std::is_same<Actions, RuleAction>::value)
+		return actions->scanSkippedTokens(offset);
+	else
+		return actions->Actions::scanSkippedTokens(offset);
+}
+
+//
+// The bitmap of RuleAction::getRuleActionMap for the rules 1..num_rules of
+// a generated class. The generated switch of rule actions is a member
+// template, ruleAction<probe>(ruleNumber, found): each case of a rule with
+// an action begins with "if constexpr (probe) { *found = true; break; }",
+// so that ruleAction<true> runs no action and only tells which rules have
+// one.
+//
+template <class Actions>
+std::vector<unsigned char> findRuleActions(Actions* actions, int num_rules)
+{
+	std::vector<unsigned char> map((num_rules >> 3) + 1);
+	for (int rule = 1; rule <= num_rules; rule++)
+	{
+		bool found = false;
+		actions->template ruleAction<true>(rule, &found);
+		if (found)
+			map[rule >> 3] |= 1 << (rule & 7);
+	}
+	return map;
+}
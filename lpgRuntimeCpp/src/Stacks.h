@@ -6,6 +6,35 @@
 
 struct Object;
 
+//
+// A frame of the parse stack when LPG_FUSED_STACKS is defined: the state,
+// the location (token) and the AST of a symbol of the current sentential
+// form, in one 16-byte record.
+//
+struct StackFrame
+{
+    int state;
+    int location;
+    Object* sym;
+};
+
+//
+// The parse stack of the parsers that run rule actions.
+//
+// By default it is made of three parallel arrays, stateStack, locationStack
+// and parseStack. When LPG_FUSED_STACKS is defined, the parsers push a
+// StackFrame on frameStack instead while they run the rule actions
+// (DeterministicParser::parseEntry and parseActions, and
+// BacktrackingParser::parseActions, and their counterparts specialized at
+// compile time), so that a shift writes a single cache line and a
+// reduction reads the contiguous frames of its right-hand side. The parses
+// that only need the states (recognize, backtracking trials, the
+// incremental parser and error recovery) keep using the dense stateStack
+// and locationStack in both layouts.
+//
+// The code that runs the rule actions goes through frameState,
+// frameLocation and frameSym, which select the layout.
+//
 struct Stacks
 {
     int STACK_INCREMENT = 1024,
@@ -13,8 +42,22 @@ struct Stacks
 
     Array< int> stateStack;
     Array< int>         locationStack;
+#ifdef LPG_FUSED_STACKS
+    Array< StackFrame > frameStack;
+
+    int& frameState(int i) { return frameStack[i].state; }
+    int& frameLocation(int i) { return frameStack[i].location; }
+    Object*& frameSym(int i) { return frameStack[i].sym; }
+    int frameStackSize() { return frameStack.Size(); }
+#else
     Array< Object* >  parseStack;
 
+    int& frameState(int i) { return stateStack[i]; }
+    int& frameLocation(int i) { return locationStack[i]; }
+    Object*& frameSym(int i) { return parseStack[i]; }
+    int frameStackSize() { return stateStack.Size(); }
+#endif
+
     //
     // Given a rule of the form     A ::= x1 x2 ... xn     n > 0
     //
@@ -24,7 +67,7 @@ struct Stacks
     //
     int getToken(int i)
     {
-        return locationStack[stateStackTop + (i - 1)];
+        return frameLocation(stateStackTop + (i - 1));
     }
 
     //
@@ -37,8 +80,8 @@ struct Stacks
     // setSYM1(Object ast) is a function that allows us to assign an AST
     // tree to GETSYM(1).
     //
-    Object* getSym(int i) { return parseStack[stateStackTop + (i - 1)]; }
-    void setSym1(Object* ast) { parseStack[stateStackTop] = ast; }
+    Object* getSym(int i) { return frameSym(stateStackTop + (i - 1)); }
+    void setSym1(Object* ast) { frameSym(stateStackTop) = ast; }
 
     //
     // Allocate or reallocate all the stacks. Their sizes should always be the same.
@@ -50,7 +93,11 @@ struct Stacks
         int   stack_length = old_stack_length + STACK_INCREMENT;
         stateStack.Resize(stack_length);
         locationStack.Resize(stack_length);
+#ifdef LPG_FUSED_STACKS
+        frameStack.Resize(stack_length);
+#else
         parseStack.Resize(stack_length);
+#endif
         return;
     }
 
@@ -72,7 +119,12 @@ struct Stacks
     {
         locationStack.Memset(0);
         locationStack.Resize(stateStack.Size());
+#ifdef LPG_FUSED_STACKS
+        frameStack.Memset(0);
+        frameStack.Resize(stateStack.Size());
+#else
         parseStack.Memset(0);
         parseStack.Resize(stateStack.Size());
+#endif
     }
 };
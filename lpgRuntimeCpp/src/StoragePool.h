@@ -145,8 +145,11 @@ namespace Jikes { // Open namespace Jikes block
 		//
 		virtual ~StoragePool()
 		{
+			//
+			// After a Reset, the segments past base_index are still there.
+			//
 			if (base)
-				for (unsigned i = 0; i <= base_index; i++)
+				for (unsigned i = 0; i < base_size; i++)
 					delete[] base[i];
 			delete[] base;
 		}
@@ -14,10 +14,20 @@ Token::Token(IPrsStream* iPrsStream, int startOffset, int endOffset, int kind) :
 
 std::vector<IToken*> Token::getFollowingAdjuncts()
 {
-	return getIPrsStream()->getFollowingAdjuncts(getTokenIndex());
+	return getFollowingAdjunctRange().toVector();
 }
 
 std::vector<IToken*> Token::getPrecedingAdjuncts()
 {
-	return getIPrsStream()->getPrecedingAdjuncts(getTokenIndex());
+	return getPrecedingAdjunctRange().toVector();
+}
+
+AdjunctRange Token::getFollowingAdjunctRange()
+{
+	return getIPrsStream()->getFollowingAdjunctRange(getTokenIndex());
+}
+
+AdjunctRange Token::getPrecedingAdjunctRange()
+{
+	return getIPrsStream()->getPrecedingAdjunctRange(getTokenIndex());
 }
@@ -14,5 +14,9 @@ struct Token :
      std::vector<IToken*> getFollowingAdjuncts();
 
      std::vector<IToken*> getPrecedingAdjuncts();
+
+     AdjunctRange getFollowingAdjunctRange();
+
+     AdjunctRange getPrecedingAdjunctRange();
 };
 
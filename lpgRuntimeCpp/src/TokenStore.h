@@ -0,0 +1,172 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+
+#include "IToken.h"
+
+//
+// The kind, the offsets and the first adjunct of each token of a
+// PrsStream, in one contiguous array each, indexed by the index of the
+// token. The parsers read the kind of a token with a single load from
+// kinds, instead of a segment lookup in the tuple of tokens followed by a
+// virtual call on the token; the offsets and the adjunct indices serve the
+// other questions that PrsStream answers by token index.
+//
+// The store is where the tokens made by makeToken are kept: the object
+// that getIToken returns for one of them is only made when it is first
+// asked for (see PrsStream::getIToken). A token object in a stream, made
+// there or added, whose kind or offsets are set later writes them through
+// (see PrsStream::updateToken, reached from the token by its store
+// pointer).
+//
+// The lines and columns of the tokens are kept too, for the first
+// positioned tokens: they are found the first time one of them is asked
+// for (see PrsStream::getLineNumberOfTokenAt), for all the tokens added so
+// far, and forgotten from a token on when it is moved or removed, and for
+// all of them when the tab, characters or line offsets of the lex stream
+// change (see LexStream::invalidatePositions).
+//
+struct TokenStore
+{
+    std::vector<int> kinds,
+                     startOffsets,
+                     endOffsets,
+                     adjunctIndexes;
+
+    std::vector<int> lines,
+                     columns,
+                     endLines,
+                     endColumns;
+    int positioned = 0;
+
+    int size() const { return static_cast<int>(kinds.size()); }
+
+    void add(int kind, int startOffset, int endOffset, int adjunctIndex)
+    {
+        kinds.push_back(kind);
+        startOffsets.push_back(startOffset);
+        endOffsets.push_back(endOffset);
+        adjunctIndexes.push_back(adjunctIndex);
+    }
+
+    void add(IToken* token)
+    {
+        add(token->getKind(), token->getStartOffset(), token->getEndOffset(), token->getAdjunctIndex());
+    }
+
+    void set(int i, int kind, int startOffset, int endOffset, int adjunctIndex)
+    {
+        if (positioned > i)
+            positioned = i;
+        kinds[i] = kind;
+        startOffsets[i] = startOffset;
+        endOffsets[i] = endOffset;
+        adjunctIndexes[i] = adjunctIndex;
+    }
+
+    void set(int i, IToken* token)
+    {
+        set(i, token->getKind(), token->getStartOffset(), token->getEndOffset(), token->getAdjunctIndex());
+    }
+
+    //
+    // The index of the first entry that starts at or after offset.
+    //
+    int lowerBound(int offset) const
+    {
+        return static_cast<int>(std::lower_bound(startOffsets.begin(), startOffsets.end(), offset) -
+                                startOffsets.begin());
+    }
+
+    //
+    // Keep the first n entries (or make room for n).
+    //
+    void resize(int n)
+    {
+        kinds.resize(n);
+        startOffsets.resize(n);
+        endOffsets.resize(n);
+        adjunctIndexes.resize(n);
+        if (positioned > n)
+            positioned = n;
+    }
+
+    //
+    // The index of the entry whose offsets contain offset; otherwise the
+    // negation of the index of the last entry that starts before offset
+    // (see PrsStream::getTokenIndexAtCharacter).
+    //
+    // The search starts from finger, where the previous one ended, and
+    // gallops away from it: an offset in the entry of the previous one, or
+    // in the next, is found in O(1), one k entries away in O(log k). An
+    // offset further than 2^GALLOPS entries away is searched for in all the
+    // entries, so that the first entries compared are always the same ones,
+    // and stay in the cache. The last 2^GALLOPS entries are searched
+    // without branches.
+    //
+    constexpr static int GALLOPS = 4;
+
+    int findOffset(int offset, int& finger) const
+    {
+        int n = size();
+        if (n == 0)
+            return 1;
+        const int* starts = startOffsets.data();
+        int low = (finger < 0 ? 0 : finger < n ? finger : n - 1),
+            high,
+            step = 1;
+        if (starts[low] <= offset)
+        {
+            for (; step <= (1 << GALLOPS) && low + step < n && starts[low + step] <= offset; step *= 2)
+                low += step;
+            high = (low + step < n ? low + step : n);
+        }
+        else
+        {
+            high = low;
+            for (; step <= (1 << GALLOPS) && high - step >= 0 && starts[high - step] > offset; step *= 2)
+                high -= step;
+            low = (high - step > 0 ? high - step : 0);
+        }
+        if (step > (1 << GALLOPS))
+        {
+            low = 0;
+            high = n;
+        }
+
+        while (high - low > (1 << GALLOPS))
+        {
+            int middle = low + (high - low) / 2;
+            if (starts[middle] <= offset)
+                low = middle;
+            else high = middle;
+        }
+        const int* base = starts + low;
+        for (int length = high - low; length > 1; length -= length / 2)
+            base = (base[length / 2] <= offset ? base + length / 2 : base);
+        int k = static_cast<int>(base - starts) - (*base > offset);
+
+        finger = (k < 0 ? 0 : k);
+        return (k >= 0 && offset <= endOffsets[k] ? k : -k);
+    }
+
+    //
+    // Find the lines and columns of the tokens that have none, with
+    // position(offset, line, column).
+    //
+    template <typename Position>
+    void positionAll(Position position)
+    {
+        int n = size();
+        lines.resize(n);
+        columns.resize(n);
+        endLines.resize(n);
+        endColumns.resize(n);
+        for (int i = positioned; i < n; i++)
+        {
+            position(startOffsets[i], lines[i], columns[i]);
+            position(endOffsets[i], endLines[i], endColumns[i]);
+        }
+        positioned = n;
+    }
+};
@@ -0,0 +1,27 @@
+#include "UnitReductions.h"
+
+#include "ParseTableProxy.h"
+
+void UnitReductions::reset(ParseTableProxy* prs, const unsigned char* action_map, bool without_actions)
+{
+    skippable.clear();
+    entries.clear();
+    hits = misses = 0;
+    if (action_map == nullptr && !without_actions)
+        return;
+
+    int count = 0;
+    skippable.assign(prs->NUM_RULES + 1, 0);
+    for (int rule = 1; rule <= prs->NUM_RULES; rule++)
+    {
+        if (prs->rhs(rule) == 1 && (without_actions || (action_map[rule >> 3] & (1 << (rule & 7))) == 0))
+        {
+            skippable[rule] = 1;
+            count++;
+        }
+    }
+
+    if (count == 0)
+        skippable.clear();
+    else entries.resize(SIZE);
+}
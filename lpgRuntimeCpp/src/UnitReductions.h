@@ -0,0 +1,84 @@
+#pragma once
+#include <vector>
+
+class ParseTableProxy;
+
+//
+// Collapsing of the chains of unit reductions that have no semantic action.
+//
+// Grammars such as the Java grammar have long chains of unit productions
+// (Expression ::= AssignmentExpression, AssignmentExpression ::=
+// ConditionalExpression, ...), most of which have no action. After a goto
+// in a state, the drivers would reduce by each link of the chain in turn:
+// nothing is popped, the action does nothing, and the next goto is taken
+// in the same state. Here such a chain is followed once for a given state
+// and goto symbol, and its end is remembered in a small direct-mapped
+// cache, so that later reductions skip the whole chain in one step.
+//
+// A rule is skipped if its right-hand side has one symbol and it has no
+// action, according to the bitmap given by RuleAction::getRuleActionMap.
+// Without a bitmap nothing is skipped, except in the trial parse of the
+// backtracking parser, which does not execute the actions at all.
+//
+struct UnitReductions
+{
+    constexpr static int SIZE = 1024; // must be a power of 2
+
+    struct Entry
+    {
+        int state = 0;
+        int symbol = 0;
+        int action = 0;
+    };
+
+    //
+    // skippable[rule] != 0 if a reduction by rule can be skipped.
+    //
+    std::vector<unsigned char> skippable;
+    std::vector<Entry> entries;
+    unsigned long long hits = 0,
+                       misses = 0;
+
+    //
+    // action_map is a bitmap of the rules that have an action (bit
+    // rule & 7 of byte rule >> 3), or nullptr. If without_actions is
+    // true, the actions are not executed and every unit rule is skipped.
+    //
+    void reset(ParseTableProxy* prs, const unsigned char* action_map, bool without_actions = false);
+
+    static unsigned index(int state, int symbol)
+    {
+        return (((unsigned) state * 31u + (unsigned) symbol) * 2654435761u >> 22) & (SIZE - 1);
+    }
+
+    //
+    // act is the goto action of state on symbol. If it is a reduction by a
+    // skippable rule, return the action found at the end of the chain.
+    // nt_action(state, symbol) and lhs(rule) are the functions of the table.
+    //
+    template <typename NtAction, typename Lhs>
+    int collapse(int state, int symbol, int act, NtAction nt_action, Lhs lhs)
+    {
+        if ((unsigned) act >= skippable.size() || !skippable[act])
+            return act;
+
+        Entry& entry = entries[index(state, symbol)];
+        if (entry.state == state && entry.symbol == symbol)
+        {
+            hits++;
+            return entry.action;
+        }
+        misses++;
+
+        do
+        {
+            act = nt_action(state, lhs(act));
+        }
+        while ((unsigned) act < skippable.size() && skippable[act]);
+
+        entry.state = state;
+        entry.symbol = symbol;
+        entry.action = act;
+        return act;
+    }
+};
@@ -2,8 +2,10 @@
 
 #include <iostream>
 #include <ostream>
+#include <sys/stat.h>
 
 #include "Exception.h"
+#include "FileCharSource.h"
 #include "IMessageHandler.h"
 #include "IPrsStream.h"
 #include "stringex.h"
@@ -163,15 +165,49 @@ void Utf8LexStream::this_tab(int tab)
 
 
 
+//
+// The bytes of the file are read a chunk at a time into the array that is
+// lexed, and the line feeds of each chunk are indexed as soon as it is
+// read, while it is still in the cache. There is nothing to decode, so the
+// bytes are the same as those of IcuUtil::getFileRawContent, and no other
+// copy of them is made.
+//
 Utf8LexStream::Utf8LexStream(const std::wstring& fileName, int tab)
 {
+	constexpr int CHUNK_SIZE = FileCharSource::CHUNK_SIZE;
+
 	this_tab(tab);
 	string temp;
-	IcuUtil::getFileRawContent(fileName.c_str(), temp);
+	FILE* file = nullptr;
+	_wfopen_s(&file, fileName.c_str(), L"r");
+	if (file != nullptr)
+	{
+		//
+		// One more byte than the file has, so that the read that finds the
+		// end of the file does not grow the array.
+		//
+		struct _stat32 statbuf;
+		if (_wstat32(fileName.c_str(), &statbuf) == 0)
+			temp.reserve(statbuf.st_size + 1);
+		lineOffsets->Contiguous(1)[0] = -1;
+		for (;;)
+		{
+			int start = static_cast<int>(temp.size()),
+			    room = static_cast<int>(temp.capacity()) - start;
+			temp.resize(start + (room > 0 && room < CHUNK_SIZE ? room : CHUNK_SIZE));
+			int count = static_cast<int>(fread(&temp[start], 1, temp.size() - start, file));
+			temp.resize(start + count);
+			if (count == 0)
+				break;
+			CharScanner::indexNewlines(temp.data(), start, start + count, lineOffsets->size(),
+			                           [this](int n) { return lineOffsets->Contiguous(n); });
+		}
+		fclose(file);
+	}
 
 	shared_ptr_string buffer(std::move(temp));
-	initialize(buffer, fileName);
-
+	setInputBytes(buffer);
+	setFileName(fileName);
 }
 
 Utf8LexStream::Utf8LexStream(shared_ptr_string inputBytes, const std::wstring& fileName)
@@ -203,10 +239,9 @@ void Utf8LexStream::initialize(std::shared_ptr<IntSegmentedTuple>& lineOffsets,
 
 void Utf8LexStream::computeLineOffsets()
 {
-	lineOffsets->reset();
-	setLineOffset(-1);
-	for (int i = startIndex + 1; i < inputBytes.length(); i++)
-		if (inputBytes[i] == 0x0A) setLineOffset(i);
+	lineOffsets->Contiguous(1)[0] = -1;
+	CharScanner::indexNewlines(inputBytes.data(), startIndex + 1, inputBytes.length(), 1,
+	                           [this](int n) { return lineOffsets->Contiguous(n); });
 }
 
 void Utf8LexStream::setInputBytes(shared_ptr_string buffer)
@@ -223,8 +258,7 @@ void Utf8LexStream::setInputBytes(shared_ptr_string buffer)
 
 int Utf8LexStream::getLineNumberOfCharAt(int i)
 {
-	int index = binarySearch(*(lineOffsets.get()), i);
-	return index < 0 ? -index : index == 0 ? 1 : index;
+	return positions.lineOf(*lineOffsets, i);
 }
 
 int Utf8LexStream::getColumnOfCharAt(int i)
@@ -1,7 +1,9 @@
 #pragma once
+#include "CharScanner.h"
 #include "ILexStream.h"
 #include "ObjectTuple.h"
 #include "ParseErrorCodes.h"
+#include "PositionIndex.h"
 
 
 //
@@ -51,6 +53,7 @@
      bool isUTF8= false;
      std::wstring fileName;
      std::shared_ptr<IntSegmentedTuple>  lineOffsets = std::make_shared<IntSegmentedTuple>();
+     PositionIndex positions; // for the lines only: the columns are counted in characters, not bytes
 
      int tab = DEFAULT_TAB;
      IPrsStream* iPrsStream= nullptr;
@@ -170,6 +173,17 @@
 
      int getIntValue(int i) { return getUnicodeValue(i); }
 
+    //
+    // Scans of the bytes from offset i to the end of the input, a vector
+    // of bytes at a time (see CharScanner). They stop only on ASCII
+    // characters, so that the offsets returned are those of characters.
+    //
+     int skipWhitespace(int i) { return CharScanner::skipWhitespace(inputBytes.data(), i, inputBytes.length()); }
+
+     int findLineEnd(int i) { return CharScanner::findLineEnd(inputBytes.data(), i, inputBytes.length()); }
+
+     int findBlockCommentEnd(int i) { return CharScanner::findBlockCommentEnd(inputBytes.data(), i, inputBytes.length()); }
+
      int getUnicodeValue(int i)
     {
         return (isUTF8
@@ -10,6 +10,7 @@
 #include "TokenStream.h"
 #include "ParseTable.h"
 #include "tuple.h"
+#include "CompactIntArray.h"
 const  std::vector< std::wstring> ParseErrorCodes::errorMsgText =
 {
     /* LEX_ERROR_CODE */                      (L"unexpected character ignored"), //$NON-NLS-1$
@@ -41,17 +42,12 @@ const  std::vector< std::wstring> ParseErrorCodes::errorMsgText =
      return IcuUtil::ws2s(toString());
  }
 
-struct IToken::Data
-{
-    void* data=nullptr;
-};
-IToken::IToken():d_ptr(nullptr)
+IToken::IToken()
 {
 }
 
 IToken::~IToken()
 {
-    delete d_ptr;
 }
 
 std::string IToken::to_utf8_string()
@@ -61,19 +57,12 @@ std::string IToken::to_utf8_string()
 
 void IToken::setExtData(void* _v)
 {
-	if(!d_ptr)
-	{
-        d_ptr = new Data();
-	}
-  
-    d_ptr->data = _v;
+    extData = _v;
 }
 
 void* IToken::getExtData() const
 {
-	if(d_ptr)
-	 return  d_ptr->data;
-	return nullptr;
+    return extData;
 }
 
 std::string TokenStream::to_utf8_string(int startOffset, int endOffset)
@@ -84,7 +73,7 @@ std::string TokenStream::to_utf8_string(int startOffset, int endOffset)
 
 
 
-  ParseTableProxy::ParseTableProxy(ParseTable* prs) : _prs(prs), ERROR_SYMBOL(prs->getErrorSymbol()),
+  ParseTableProxy::ParseTableProxy(ParseTable* prs, bool compact) : _prs(prs), ERROR_SYMBOL(prs->getErrorSymbol()),
                                                       SCOPE_UBOUND(prs->getScopeUbound()),
                                                       SCOPE_SIZE(prs->getScopeSize()),
                                                       MAX_NAME_LENGTH(prs->getMaxNameLength()),
@@ -106,11 +95,65 @@ std::string TokenStream::to_utf8_string(int startOffset, int endOffset)
                                                       _isNullable(prs->get_isNullable_data()),
                                                       _prosthesesIndex(prs->get_prosthesesIndex_data()),
                                                       _isKeyword(prs->get_isKeyword_data()),
-                                                      _baseCheck(prs->get_baseCheck_data()), _rhs(prs->get_rhs_data()),
-                                                      _baseAction(prs->get_baseAction_data()), _lhs(prs->get_lhs_data()),
-                                                      _termCheck(prs->get_termCheck_data()),
-                                                      _termAction(prs->get_termAction_data())
+                                                      _baseCheck(nullptr), _rhs(nullptr),
+                                                      _baseAction(nullptr), _lhs(nullptr),
+                                                      _termCheck(nullptr),
+                                                      _termAction(nullptr)
 
   {
+#ifdef LPG_PROFILE_PARSE_TABLES
+      _profile = ParseTableProfile::find(prs);
+#endif
+
+      _denseRows = DenseActionRows::find(prs);
+      if (_denseRows)
+      {
+          _denseFirst = _denseRows->firstState;
+          _denseActions = _denseRows->actions.data();
+          _denseStates = static_cast<unsigned>(_denseRows->count);
+          _denseWidth = static_cast<unsigned>(_denseRows->width);
+      }
+
+      if (prs->get_compact_arrays(_compactBaseCheck, _compactBaseAction, _compactTermCheck, _compactTermAction))
+      {
+          //
+          // The table holds its own narrowed arrays (e.g. a mapped binary
+          // table file); use them in place. The raw int pointers are not
+          // set, to avoid widening the arrays.
+          //
+          _compactRhs = _compactBaseCheck;
+          _compactLhs = _compactBaseAction;
+          return;
+      }
+
+      _baseCheck = prs->get_baseCheck_data();
+      _rhs = prs->get_rhs_data();
+      _baseAction = prs->get_baseAction_data();
+      _lhs = prs->get_lhs_data();
+      _termCheck = prs->get_termCheck_data();
+      _termAction = prs->get_termAction_data();
+
+      if (compact)
+      {
+          _compactBaseCheck = CompactIntArray::narrow(_baseCheck, prs->get_baseCheck_length(), prs->compactArrays);
+          _compactBaseAction = CompactIntArray::narrow(_baseAction, prs->get_baseAction_length(), prs->compactArrays);
+          _compactTermCheck = CompactIntArray::narrow(_termCheck, prs->get_termCheck_length(), prs->compactArrays);
+          _compactTermAction = CompactIntArray::narrow(_termAction, prs->get_termAction_length(), prs->compactArrays);
+      }
+      else
+      {
+          _compactBaseCheck = CompactIntArray(_baseCheck, prs->get_baseCheck_length());
+          _compactBaseAction = CompactIntArray(_baseAction, prs->get_baseAction_length());
+          _compactTermCheck = CompactIntArray(_termCheck, prs->get_termCheck_length());
+          _compactTermAction = CompactIntArray(_termAction, prs->get_termAction_length());
+      }
+
+      //
+      // In the generated tables, rhs and lhs share the storage of
+      // baseCheck and baseAction.
+      //
+      _compactRhs = (_rhs == _baseCheck ? _compactBaseCheck : CompactIntArray(_rhs, 0));
+      _compactLhs = (_lhs == _baseAction ? _compactBaseAction : CompactIntArray(_lhs, 0));
   }
 
+
@@ -292,6 +292,41 @@ public:
 
         top = n;
     }
+
+    //
+    // Set the size of the dynamic array to n and make sure that its
+    // elements are stored in a single block, so that they can be written
+    // directly through the pointer returned. The first elements are kept,
+    // up to n. This is meant for arrays that are filled in bulk, once their
+    // final size is known.
+    //
+    T* Contiguous(const int n)
+    {
+        if (n > Blksize() || _size == 0)
+        {
+            int length = (top < n ? top : n);
+            T* elements = new T[length > 0 ? length : 1];
+            for (int i = 0; i < length; i++)
+                elements[i] = (*this)[i];
+            Resize(0);
+
+            for (log_blksize = DEFAULT_LOG_BLKSIZE; (1 << log_blksize) < n && log_blksize < 30; log_blksize++)
+                ;
+            AllocateMoreSpace();
+            memmove(base[0], elements, length * sizeof(T));
+            delete[] elements;
+        }
+        top = n;
+
+        return base[0];
+    }
+
+    //
+    // The elements, if they are all stored in a single block (as they are
+    // after Contiguous), or nullptr. Nothing is changed, so that the array
+    // can be read by several threads at once.
+    //
+    T* ContiguousElements() { return (top > 0 && top <= Blksize() ? base[0] : nullptr); }
     //
 // Return a reference to the ith element of the dynamic array.
 //
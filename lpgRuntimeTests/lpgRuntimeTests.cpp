@@ -0,0 +1,954 @@
+//
+// Tests of the runtime, run over the parsers of the examples: ExprParser
+// (DeterministicParserT, also over ExprParserdirect, the direct-coded
+// actions written by ExampleExpr -direct) and JavaParser
+// (BacktrackingParserT), and the lexers of Java and of LPG (LexParserT
+// over JavaLexerdirect and LPGLexerdirect).
+//
+// lpgRuntimeTests [name]
+//
+// runs every test, or the tests whose name starts with name, and exits
+// with the number of failed checks.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BinaryParseTable.h"
+#include "DenseActionRows.h"
+#include "ExprLexer.h"
+#include "ExprParser.h"
+#include "ExprParserdirect.h"
+#include "FileCharSource.h"
+#include "GeneratedParseTable.h"
+#include "IcuUtil.h"
+#include "JavaLexer.h"
+#include "JavaLexerdirect.h"
+#include "JavaParser.h"
+#include "JavaParser_top_level_ast.h"
+#include "LPGLexer.h"
+#include "LPGLexerdirect.h"
+#include "IMessageHandler.h"
+#include "Monitor.h"
+#include "ParallelLexer.h"
+#include "PipelinedLexer.h"
+#include "PrsStream.h"
+#include "Token.h"
+#include "Utf8LexStream.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* test, const char* what)
+{
+    if (!condition)
+    {
+        std::cout << test << ": " << what << std::endl;
+        failures++;
+    }
+}
+
+//
+// A monitor that cancels the parse at its calls-th check.
+//
+struct CancelAfter : public Monitor
+{
+    int calls;
+
+    explicit CancelAfter(int calls) : calls(calls) {}
+
+    bool isCancelled() override { return --calls < 0; }
+};
+
+static const wchar_t* javaInput = LR"(
+class Cancel
+{
+    int sum(int[] values)
+    {
+        int total = 0;
+        for (int i = 0; i < values.length; i++)
+            total += values[i];
+        return total;
+    }
+}
+)";
+
+//
+// recognize returns 0 only when the input is accepted: a parse cancelled
+// by the monitor returns the current token instead.
+//
+static void testRecognizeCancelled()
+{
+    const char* test = "recognize-cancelled";
+
+    shared_ptr_wstring expression;
+    expression = L"(1+2)*3+4*(5+6)";
+    ExprLexer expr_lexer(expression, L"cancel.expr");
+    ExprParser expr_parser(&expr_lexer);
+    expr_lexer.lexer(&expr_parser);
+    DeterministicParser* deterministic = expr_parser.getParser();
+    check(deterministic->recognize() == 0, test, "the expression is not accepted");
+    CancelAfter expr_monitor(5);
+    deterministic->setMonitor(&expr_monitor);
+    check(deterministic->recognize() != 0, test, "a cancelled deterministic parse is accepted");
+    deterministic->setMonitor(nullptr);
+
+    shared_ptr_wstring source;
+    source = javaInput;
+    JavaLexer java_lexer(source, L"Cancel.java", 4);
+    JavaParser java_parser(java_lexer.getILexStream());
+    java_lexer.lexer(nullptr, java_parser.getIPrsStream());
+    BacktrackingParser* backtracking = java_parser.getParser();
+    check(backtracking->recognize() == 0, test, "the Java class is not accepted");
+    CancelAfter java_monitor(5);
+    backtracking->setMonitor(&java_monitor);
+    check(backtracking->recognize() != 0, test, "a cancelled backtracking parse is accepted");
+    backtracking->setMonitor(nullptr);
+    check(backtracking->recognize() == 0, test, "the Java class is not accepted after a cancelled parse");
+}
+
+//
+// The switch blocks of a direct-coded class (ExprParserdirect,
+// JavaLexerdirect, LPGLexerdirect) compute the same actions as the
+// compressed tables of its *prs class, in every state and lookahead state.
+//
+template <class Direct, class Prs>
+static void checkDirectActions(const char* test)
+{
+    GeneratedParseTable<Prs> table;
+    check(table.get_termAction_length() == static_cast<int>(std::size(Prs::_termAction)), test,
+          "the table does not report the length of its arrays");
+    for (int state : DenseActionRows::states(&table))
+    {
+        for (int sym = 0; sym <= Prs::NT_OFFSET; sym++)
+            check(Direct::directTAction(state, sym) == table.tAction(state, sym), test,
+                  "a terminal action differs");
+    }
+    for (int i = 0; i < table.get_termAction_length(); i++)
+    {
+        int la_state = table.termAction(i) - Prs::LA_STATE_OFFSET;
+        for (int sym = 0; la_state > 0 && sym <= Prs::NT_OFFSET; sym++)
+            check(Direct::directLookAhead(la_state, sym) == table.lookAhead(la_state, sym), test,
+                  "a lookahead action differs");
+    }
+}
+
+static void testDirectActions()
+{
+    const char* test = "direct-actions";
+
+    checkDirectActions<ExprParserdirect, ExprParserprs>(test);
+    checkDirectActions<JavaLexerdirect, JavaLexerprs>(test);
+    checkDirectActions<LPGLexerdirect, LPGLexerprs>(test);
+}
+
+//
+// ExprParser gives the same trees, and detects errors on the same tokens,
+// with DeterministicParserT over ExprParserdirect as over ExprParserprs.
+//
+static void testDirectParse()
+{
+    const char* test = "direct-parse";
+
+    static ExprParserdirect direct_table;
+    for (const wchar_t* text : { L"1", L"(1+2)*3+4*(5+6)", L"((((7))))*8*9+10", L"1+*2", L"(1+2", L"1 2" })
+    {
+        shared_ptr_wstring input;
+        input = text;
+        ExprLexer table_lexer(input, L"table.expr"),
+                  direct_lexer(input, L"direct.expr");
+        ExprParser table_parser(&table_lexer),
+                   direct_parser(&direct_lexer);
+        delete direct_parser.dtParser;
+        direct_parser.dtParser =
+            new DeterministicParserT<ExprParserdirect, ExprParser>(&direct_parser, &direct_table, &direct_parser);
+        table_lexer.lexer(&table_parser);
+        direct_lexer.lexer(&direct_parser);
+
+        int error_token = table_parser.dtParser->recognize();
+        check(direct_parser.dtParser->recognize() == error_token, test, "recognize differs");
+        if (error_token == 0)
+        {
+            Ast* table_tree = table_parser.parser();
+            Ast* direct_tree = direct_parser.parser();
+            check(table_tree != nullptr && direct_tree != nullptr && table_tree->toString() == direct_tree->toString(),
+                  test, "the trees differ");
+        }
+    }
+}
+
+//
+// Over a table that is not a Prs, the specialized parsers and lexers run
+// the driver loops of the dynamic ones: the lexers and parsers of Java and
+// of expressions give the same results over a BinaryParseTable written
+// from their tables.
+//
+static void testOtherTables()
+{
+    const char* test = "other-tables";
+
+    BinaryParseTable::write(ExprLexer::prs, L"lpgRuntimeTests.exprlexer.lpgt");
+    BinaryParseTable::write(ExprParser::prs, L"lpgRuntimeTests.expr.lpgt");
+    BinaryParseTable::write(JavaLexer::prs, L"lpgRuntimeTests.javalexer.lpgt");
+    BinaryParseTable::write(JavaParser::prsTable, L"lpgRuntimeTests.java.lpgt");
+    auto expr_lexer_table = BinaryParseTable::load(L"lpgRuntimeTests.exprlexer.lpgt");
+    auto expr_table = BinaryParseTable::load(L"lpgRuntimeTests.expr.lpgt");
+    auto java_lexer_table = BinaryParseTable::load(L"lpgRuntimeTests.javalexer.lpgt");
+    auto java_table = BinaryParseTable::load(L"lpgRuntimeTests.java.lpgt");
+
+    auto same_tokens = [](PrsStream* expected, PrsStream* actual)
+    {
+        if (expected->getSize() != actual->getSize())
+            return false;
+        for (int i = 0; i < expected->getSize(); i++)
+        {
+            if (expected->getKind(i) != actual->getKind(i) ||
+                expected->getStartOffset(i) != actual->getStartOffset(i) ||
+                expected->getEndOffset(i) != actual->getEndOffset(i))
+                return false;
+        }
+        return true;
+    };
+
+    for (const wchar_t* text : { L"(1+2)*3+4*(5+6)", L"1+*2" })
+    {
+        shared_ptr_wstring input;
+        input = text;
+        ExprLexer prs_lexer(input, L"prs.expr");
+        ParseTable* prs_lexer_table = ExprLexer::prs;
+        ExprLexer::prs = expr_lexer_table.get();
+        ExprLexer file_lexer(input, L"file.expr");
+        ExprLexer::prs = prs_lexer_table;
+        ExprParser prs_parser(&prs_lexer),
+                   file_parser(&file_lexer);
+        delete file_parser.dtParser;
+        file_parser.dtParser =
+            new DeterministicParserT<ExprParserprs, ExprParser>(&file_parser, expr_table.get(), &file_parser);
+        prs_lexer.lexer(&prs_parser);
+        file_lexer.lexer(&file_parser);
+        check(same_tokens(&prs_parser, &file_parser), test, "the expression tokens differ");
+
+        int error_token = prs_parser.dtParser->recognize();
+        check(file_parser.dtParser->recognize() == error_token, test, "recognize differs over ExprParser");
+        if (error_token == 0)
+        {
+            Ast* prs_tree = prs_parser.parser();
+            Ast* file_tree = file_parser.parser();
+            check(prs_tree != nullptr && file_tree != nullptr && prs_tree->toString() == file_tree->toString(),
+                  test, "the expression trees differ");
+        }
+    }
+
+    for (const wchar_t* text : { javaInput, L"class Broken { int f() { return 1 + ; } }" })
+    {
+        shared_ptr_wstring source;
+        source = text;
+        JavaLexer prs_lexer(source, L"Prs.java", 4);
+        ParseTable* prs_lexer_table = JavaLexer::prs;
+        JavaLexer::prs = java_lexer_table.get();
+        JavaLexer file_lexer(source, L"File.java", 4);
+        JavaLexer::prs = prs_lexer_table;
+        JavaParser prs_parser(prs_lexer.getILexStream());
+        ParseTable* prs_table = JavaParser::prsTable;
+        JavaParser::prsTable = java_table.get();
+        JavaParser file_parser(file_lexer.getILexStream());
+        JavaParser::prsTable = prs_table;
+        prs_lexer.lexer(nullptr, prs_parser.getIPrsStream());
+        file_lexer.lexer(nullptr, file_parser.getIPrsStream());
+        check(same_tokens(prs_parser.getPrsStream(), file_parser.getPrsStream()), test, "the Java tokens differ");
+
+        int error_token = prs_parser.getParser()->recognize();
+        check(file_parser.getParser()->recognize() == error_token, test, "recognize differs over JavaParser");
+        if (error_token == 0)
+        {
+            auto prs_tree = prs_parser.parser();
+            auto file_tree = file_parser.parser();
+            check(prs_tree != nullptr && file_tree != nullptr && prs_tree->toString() == file_tree->toString(),
+                  test, "the Java trees differ");
+        }
+    }
+}
+
+//
+// BinaryParseTable::load rejects a table file whose char arrays are not
+// stored one byte per element, whose name offsets are not in order, or
+// whose arrays are too short for the constants or the actions of the
+// table, rather than let the parsers read out of its bounds.
+//
+static void testBadTableFiles()
+{
+    const char* test = "bad-table-files";
+
+    BinaryParseTable::write(ExprParser::prs, L"lpgRuntimeTests.expr.lpgt");
+    std::ifstream in("lpgRuntimeTests.expr.lpgt", std::ios::binary);
+    std::string file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    BinaryParseTable::Header header;
+    memcpy(&header, file.data(), sizeof(header));
+    size_t entries = sizeof(header) + header.numConstants * sizeof(int32_t);
+    auto corrupt = [&](const char* what, uint32_t id, const std::function<void(BinaryParseTable::SectionEntry&, std::string&)>& change)
+    {
+        std::string bad = file;
+        for (uint32_t i = 0; i < header.numSections; i++)
+        {
+            BinaryParseTable::SectionEntry entry;
+            memcpy(&entry, bad.data() + entries + i * sizeof(entry), sizeof(entry));
+            if (entry.id != id)
+                continue;
+            change(entry, bad);
+            memcpy(&bad[entries + i * sizeof(entry)], &entry, sizeof(entry));
+        }
+        std::ofstream("lpgRuntimeTests.bad.lpgt", std::ios::binary) << bad;
+        bool rejected = false;
+        try
+        {
+            BinaryParseTable::load(L"lpgRuntimeTests.bad.lpgt");
+        }
+        catch (BadParseTableFileException&)
+        {
+            rejected = true;
+        }
+        check(rejected, test, what);
+    };
+
+    check(BinaryParseTable::load(L"lpgRuntimeTests.expr.lpgt") != nullptr, test, "the table file is not loaded");
+    corrupt("a wide isNullable is accepted", BinaryParseTable::IS_NULLABLE,
+            [](BinaryParseTable::SectionEntry& entry, std::string&) { entry.width = sizeof(short); });
+    corrupt("names out of order are accepted", BinaryParseTable::NAME,
+            [](BinaryParseTable::SectionEntry& entry, std::string& bad)
+            {
+                uint32_t* offsets = reinterpret_cast<uint32_t*>(&bad[entry.offset]);
+                offsets[1] = offsets[2] + 1;
+            });
+    corrupt("a short baseAction is accepted", BinaryParseTable::BASE_ACTION,
+            [](BinaryParseTable::SectionEntry& entry, std::string&) { entry.length = ExprParserprs::NUM_RULES; });
+    corrupt("a short termAction is accepted", BinaryParseTable::TERM_ACTION,
+            [](BinaryParseTable::SectionEntry& entry, std::string&) { entry.length = 1; });
+}
+
+//
+// The kind and the offsets of a token set after it was added to its
+// PrsStream, pooled or not, are the ones the stream answers by index.
+//
+static void testTokenStore()
+{
+    const char* test = "token-store";
+
+    shared_ptr_wstring source;
+    source = javaInput;
+    JavaLexer java_lexer(source, L"Store.java", 4);
+    JavaParser java_parser(java_lexer.getILexStream());
+    java_lexer.lexer(nullptr, java_parser.getIPrsStream());
+    IPrsStream* stream = java_parser.getIPrsStream();
+
+    IToken* pooled = stream->getIToken(1);
+    pooled->setKind(pooled->getKind() + 1);
+    pooled->setEndOffset(pooled->getEndOffset() + 1);
+    check(stream->getKind(1) == pooled->getKind(), test, "the kind of a pooled token is not updated");
+    check(stream->getEndOffset(1) == pooled->getEndOffset(), test, "the offset of a pooled token is not updated");
+
+    PrsStream other;
+    other.makeToken(0, 0, 0);
+    Token* added = new Token(&other, 1, 5, 7);
+    other.addToken(added);
+    added->setKind(8);
+    added->setStartOffset(2);
+    check(other.getKind(1) == 8, test, "the kind of an added token is not updated");
+    check(other.getStartOffset(1) == 2, test, "the offset of an added token is not updated");
+}
+
+//
+// FileCharSource, reading a chunk at a time, finds the characters that
+// IcuUtil::getFileUnicodeContent finds in the whole file: the same
+// encoding, detected on the start of the file even if other characters
+// follow, a character split between two chunks, a character cut short
+// by the end of the file. Utf8LexStream reads the bytes and the lines of
+// a file as it does the same bytes given in memory.
+//
+static void testFileInput()
+{
+    const char* test = "file-input";
+
+    const int chunk = FileCharSource::CHUNK_SIZE;
+    std::string ascii_then_latin1, split_utf8, cut_utf8;
+    for (int i = 0; ascii_then_latin1.size() < 2 * chunk; i++)
+        ascii_then_latin1 += "int a;\n";
+    ascii_then_latin1 += "// caf\xe9 na\xefve r\xe9sum\xe9\n";
+    split_utf8 = std::string(chunk - 1, 'a');
+    for (int i = 0; i < 100; i++)
+        split_utf8 += "\xe6\x97\xa5\xe6\x9c\xac\n";
+    for (int i = 0; cut_utf8.size() < chunk; i++)
+        cut_utf8 += "int \xc3\xa9;\n";
+    cut_utf8 += "\xe6\x97";
+
+    for (const std::string& bytes : { ascii_then_latin1, split_utf8, cut_utf8, std::string() })
+    {
+        const std::string name = "lpgRuntimeTests.input";
+        const std::wstring file_name(name.begin(), name.end());
+        {
+            std::ofstream file(name, std::ios::binary);
+            file.write(bytes.data(), bytes.size());
+        }
+
+        std::wstring expected;
+        check(IcuUtil::getFileUnicodeContent(file_name.c_str(), expected), test, "the file is not read");
+        std::wstring chars;
+        FileCharSource source(file_name);
+        std::vector<wchar_t> buffer(1000);
+        int count;
+        while ((count = source.read(buffer.data(), static_cast<int>(buffer.size()))) > 0)
+            chars.append(buffer.data(), count);
+        check(count == 0 && chars == expected, test, "FileCharSource differs from getFileUnicodeContent");
+
+        Utf8LexStream from_file(file_name);
+        shared_ptr_string in_memory;
+        in_memory = bytes;
+        Utf8LexStream from_bytes(in_memory, file_name);
+        check(from_file.getInputBytes().length() == static_cast<int>(bytes.size()) &&
+              std::string(from_file.getInputBytes().data(), bytes.size()) == bytes,
+              test, "Utf8LexStream reads other bytes");
+        bool same_lines = (from_file.getLineCount() == from_bytes.getLineCount());
+        for (int i = 0; same_lines && i < from_bytes.getLineCount(); i++)
+            same_lines = (from_file.getLineOffset(i) == from_bytes.getLineOffset(i));
+        check(same_lines, test, "Utf8LexStream finds other lines");
+        std::remove(name.c_str());
+    }
+}
+
+//
+// Where the lexical errors of a stream are reported: at each, the offset
+// of the error and how many tokens the stream of the parser had.
+//
+struct ErrorPlaces : public IMessageHandler
+{
+    IPrsStream* stream;
+    std::vector<std::pair<int, int>> places;
+
+    explicit ErrorPlaces(IPrsStream* stream) : stream(stream) {}
+
+    void handleMessage(int errorCode, const Location& msgLocation, const Location& errorLocation,
+                       const std::wstring& filename, const std::vector<std::wstring>& errorInfo) override
+    {
+        places.push_back({ msgLocation.left_loc, stream->getSize() });
+    }
+};
+
+//
+// PipelinedLexer reports a lexical error once the parser has the tokens
+// that end before it, and none of those that follow.
+//
+static void testPipelinedErrors()
+{
+    const char* test = "pipelined-errors";
+
+    std::wstring text = L"class Errors\n{\n";
+    for (int i = 0; i < 200; i++)
+    {
+        text += L"    int f" + std::to_wstring(i) + L" = " + std::to_wstring(i) + L";\n";
+        if (i % 70 == 35)
+            text += L"    # \n";
+    }
+    text += L"}\n";
+    shared_ptr_wstring source;
+    source = text;
+
+    JavaLexer lexed_lexer(source, L"Errors.java", 4);
+    JavaParser lexed_parser(lexed_lexer.getILexStream());
+    ErrorPlaces lexed(lexed_parser.getIPrsStream());
+    lexed_lexer.getLexStream()->setMessageHandler(&lexed);
+    lexed_lexer.lexer(nullptr, lexed_parser.getIPrsStream());
+    IPrsStream* tokens = lexed_parser.getIPrsStream();
+    check(lexed.places.size() == 3, test, "the input does not have three lexical errors");
+
+    JavaLexer piped_lexer(source, L"Errors.java", 4);
+    JavaParser piped_parser(piped_lexer.getILexStream());
+    ErrorPlaces piped(piped_parser.getIPrsStream());
+    piped_lexer.getLexStream()->setMessageHandler(&piped);
+    {
+        PipelinedLexer<JavaLexer> pipeline(piped_lexer, nullptr, piped_parser.getIPrsStream());
+        pipeline.lexAll();
+    }
+    check(piped.places.size() == lexed.places.size(), test, "other lexical errors are reported");
+    for (std::size_t e = 0; e < piped.places.size() && e < lexed.places.size(); e++)
+    {
+        int before = 0;
+        while (before < tokens->getSize() && tokens->getEndOffset(before) < lexed.places[e].first)
+            before++;
+        check(piped.places[e].first == lexed.places[e].first && piped.places[e].second == before, test,
+              "a lexical error is reported out of place");
+    }
+}
+
+//
+// The tokens, adjuncts and lexical errors of a PrsStream, as the parser and
+// the tools see them.
+//
+struct LexedStream
+{
+    std::vector<std::vector<int>> tokens,
+                                  adjuncts,
+                                  rangeTokens;
+    std::vector<int> errors;
+
+    LexedStream(PrsStream* stream, const ErrorPlaces& errorPlaces)
+    {
+        for (int i = 0; i < stream->getSize(); i++)
+        {
+            IToken* token = stream->getIToken(i);
+            tokens.push_back({ stream->getKind(i), stream->getStartOffset(i), stream->getEndOffset(i),
+                               token->getKind(), token->getStartOffset(), token->getTokenIndex(),
+                               token->getAdjunctIndex() });
+        }
+        Tuple<IToken*> adjunct_tokens = stream->getAdjuncts();
+        for (int i = 0; i < adjunct_tokens.size(); i++)
+        {
+            IToken* adjunct = adjunct_tokens[i];
+            adjuncts.push_back({ adjunct->getKind(), adjunct->getStartOffset(), adjunct->getEndOffset(),
+                                 adjunct->getTokenIndex(), adjunct->getAdjunctIndex() });
+        }
+        Tuple<IToken*> range = stream->getRangeTokens();
+        for (int i = 0; i < range.size(); i++)
+            rangeTokens.push_back({ range[i]->getKind(), range[i]->getStartOffset(), range[i]->getEndOffset() });
+        for (const std::pair<int, int>& place : errorPlaces.places)
+            errors.push_back(place.first);
+    }
+};
+
+//
+// ParallelLexer, with 2 to 16 threads, makes the tokens, the adjuncts and
+// the lexical errors that Lexer makes sequentially from text. At least one
+// chunk must start inside one of spans, the offsets of the lines of text
+// that a chunk lexed alone would lex in another way.
+//
+template <class Lexer>
+static void checkParallelLexer(const char* test, const std::wstring& text, const std::vector<std::pair<int, int>>& spans)
+{
+    shared_ptr_wstring source;
+    source = text;
+    Lexer sequential_lexer(source, L"Chunks", 4);
+    LexStream* sequential_stream = static_cast<LexStream*>(sequential_lexer.getILexStream());
+    PrsStream sequential_tokens(sequential_stream);
+    ErrorPlaces sequential_errors(&sequential_tokens);
+    sequential_stream->setMessageHandler(&sequential_errors);
+    sequential_lexer.lexer(nullptr, &sequential_tokens);
+    LexedStream sequential(&sequential_tokens, sequential_errors);
+    check(!sequential.errors.empty(), test, "the input has no lexical errors");
+
+    bool in_span = false;
+    for (int threads : { 2, 3, 5, 8, 16 })
+    {
+        std::vector<int> starts = ParallelLexer<Lexer>::split(sequential_stream, threads);
+        check(starts.size() == static_cast<std::size_t>(threads), test, "the input is not split in a chunk per thread");
+        for (int start : starts)
+        {
+            for (const std::pair<int, int>& span : spans)
+                in_span = in_span || (span.first < start && start < span.second);
+        }
+
+        Lexer lexer(source, L"Chunks", 4);
+        LexStream* stream = static_cast<LexStream*>(lexer.getILexStream());
+        PrsStream tokens(stream);
+        ErrorPlaces errors(&tokens);
+        stream->setMessageHandler(&errors);
+        ParallelLexer<Lexer>::lexer(lexer, nullptr, &tokens, threads);
+        LexedStream parallel(&tokens, errors);
+        check(parallel.tokens == sequential.tokens, test, "the tokens differ");
+        check(parallel.adjuncts == sequential.adjuncts, test, "the adjuncts differ");
+        check(parallel.rangeTokens == sequential.rangeTokens, test, "the range tokens differ");
+        check(parallel.errors == sequential.errors, test, "the lexical errors differ");
+    }
+    check(in_span, test, "no chunk starts inside a span");
+}
+
+//
+// The Java lexer over block comments that hold what would be tokens,
+// unterminated strings and lexical errors outside of them; the LPG lexer,
+// whose single-line comments are adjuncts, over blocks that hold what
+// would be rules and comments outside of them.
+//
+static void testParallelLexer()
+{
+    const char* test = "parallel-lexer";
+
+    unsigned seed = 17;
+    auto random = [&seed](unsigned n)
+    {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    };
+    std::size_t size = 17 * ParallelLexer<JavaLexer>::MIN_CHUNK_SIZE;
+
+    std::wstring text = L"class Chunks\n{\n";
+    std::vector<std::pair<int, int>> spans;
+    for (int i = 0; text.size() < size; i++)
+    {
+        unsigned choice = random(100);
+        std::wstring n = std::to_wstring(i);
+        if (choice < 1)
+        {
+            text += L"    /*\n";
+            int begin = static_cast<int>(text.size());
+            for (unsigned line = random(400); line > 0; line--)
+                text += L"    int c" + n + L" = \"open # ` // " + std::to_wstring(line) + L";\n";
+            spans.push_back({ begin, static_cast<int>(text.size()) });
+            text += L"    */\n";
+        }
+        else if (choice < 4)
+            text += L"    int e" + n + L" = 1 # ` 2;\n";
+        else if (choice < 5)
+            text += L"    String u" + n + L" = \"open;\n";
+        else if (choice < 10)
+            text += L"    // a /* that does not open a comment\n";
+        else if (choice < 14)
+            text += L"    /** f" + n + L" */ int d" + n + L";\n";
+        else if (choice < 16)
+            text += L"    String s" + n + L" = \"/* not a comment */\";\n";
+        else
+            text += L"    int f" + n + L" = " + n + L"; // " + n + L"\n";
+    }
+    text += L"}\n";
+    checkParallelLexer<JavaLexer>(test, text, spans);
+
+    text = L"%Rules\n";
+    spans.clear();
+    for (int i = 0; text.size() < size; i++)
+    {
+        unsigned choice = random(100);
+        std::wstring n = std::to_wstring(i);
+        if (choice < 1)
+        {
+            text += L"    /.\n";
+            int begin = static_cast<int>(text.size());
+            for (unsigned line = random(400); line > 0; line--)
+                text += L"    B" + n + L" ::= C" + n + L" -- " + std::to_wstring(line) + L"\n";
+            spans.push_back({ begin, static_cast<int>(text.size()) });
+            text += L"    ./\n";
+        }
+        else if (choice < 4)
+            text += L"    E" + n + L" ::= \x01 e" + n + L"\n";
+        else if (choice < 5)
+            text += L"    U" + n + L" ::= 'open\n";
+        else if (choice < 20)
+            text += L"    -- a /. that does not open a block\n";
+        else
+            text += L"    A" + n + L" ::= A" + n + L" '+' T" + n + L" -- " + n + L"\n";
+    }
+    text += L"%End\n";
+    checkParallelLexer<LPGLexer>(test, text, spans);
+}
+
+//
+// Threads that ask a stream for the lines and the columns of its offsets
+// at the same time get the answers that a single thread gets.
+//
+static void testConcurrentPositions()
+{
+    const char* test = "concurrent-positions";
+
+    std::wstring text;
+    for (int i = 0; i < 2000; i++)
+        text += std::wstring(i % 3, L'\t') + L"int f" + std::to_wstring(i) + L";\t// " + std::to_wstring(i) + L"\n";
+    shared_ptr_wstring source;
+    source = text;
+    JavaLexer alone(source, L"Alone.java", 4),
+              shared(source, L"Shared.java", 4);
+    ILexStream* reference = alone.getILexStream();
+    std::vector<int> lines(text.size()),
+                     columns(text.size());
+    for (int i = 0; i < static_cast<int>(text.size()); i++)
+    {
+        lines[i] = reference->getLineNumberOfCharAt(i);
+        columns[i] = reference->getColumnOfCharAt(i);
+    }
+
+    ILexStream* stream = shared.getILexStream();
+    std::atomic<int> differences{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&, t]
+        {
+            for (int k = 0; k < static_cast<int>(text.size()); k++)
+            {
+                int i = (t % 2 == 0 ? k : static_cast<int>(text.size()) - 1 - k);
+                if (stream->getLineNumberOfCharAt(i) != lines[i] || stream->getColumnOfCharAt(i) != columns[i])
+                    differences++;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    check(differences.load() == 0, test, "a thread gets another line or column");
+}
+
+//
+// The lines and columns of the tokens of a PrsStream follow the tab of its
+// lex stream, and threads that ask for them at the same time get the
+// answers of the lex stream, and the tokens at their offsets that a
+// single thread gets.
+//
+static void testTokenPositions()
+{
+    const char* test = "token-positions";
+
+    std::wstring text;
+    for (int i = 0; i < 500; i++)
+        text += std::wstring(i % 3, L'\t') + L"int f" + std::to_wstring(i) + L";\n";
+    shared_ptr_wstring source;
+    source = text;
+    JavaLexer java_lexer(source, L"Tabs.java", 4);
+    JavaParser java_parser(java_lexer.getILexStream());
+    java_lexer.lexer(nullptr, java_parser.getIPrsStream());
+    PrsStream* stream = static_cast<PrsStream*>(java_parser.getIPrsStream());
+    ILexStream* lex_stream = java_lexer.getILexStream();
+
+    //
+    // "int" of the third line follows two tabs.
+    //
+    int token = stream->getTokenIndexAtCharacter(static_cast<int>(text.find(L"\t\tint")) + 2);
+    check(stream->getColumnOfTokenAt(token) == 9, test, "a token after two tabs of 4 is not at column 9");
+    static_cast<LexStream*>(lex_stream)->setTab(8);
+    check(stream->getColumnOfTokenAt(token) == 17, test, "a token after two tabs of 8 is not at column 17");
+
+    std::vector<int> indexes(stream->getSize());
+    int finger = 0;
+    for (int i = 0; i < stream->getSize(); i++)
+        indexes[i] = stream->getTokenIndexAtCharacter(stream->getStartOffset(i), finger);
+
+    std::atomic<int> differences{ 0 };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&, t]
+        {
+            int n = stream->getSize();
+            for (int k = 0; k < n; k++)
+            {
+                int i = (t % 2 == 0 ? k : n - 1 - k);
+                if (stream->getLineNumberOfTokenAt(i) != lex_stream->getLineNumberOfCharAt(stream->getStartOffset(i)) ||
+                    stream->getEndColumnOfTokenAt(i) != lex_stream->getColumnOfCharAt(stream->getEndOffset(i)) ||
+                    stream->getTokenIndexAtCharacter(stream->getStartOffset(i)) != indexes[i])
+                    differences++;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    check(differences.load() == 0, test, "a thread gets another line, column or index of a token");
+}
+
+//
+// What a lexer gives for an input: the kind and the offsets of its tokens
+// and of its adjuncts, with the token each adjunct follows, and the places
+// of its lexical errors (see ErrorPlaces).
+//
+struct Lexed
+{
+    std::vector<std::vector<int>> tokens,
+                                  adjuncts;
+    std::vector<std::pair<int, int>> errors;
+
+    bool operator==(const Lexed& other) const
+    {
+        return tokens == other.tokens && adjuncts == other.adjuncts && errors == other.errors;
+    }
+};
+
+template <class Lexer>
+static Lexed lexWith(Lexer& lexer, ILexStream* lex_stream, bool dfa)
+{
+    if (!dfa)
+        lexer.getParser()->dfa.enabled = false;
+    PrsStream stream(lex_stream);
+    ErrorPlaces errors(&stream);
+    lex_stream->setMessageHandler(&errors);
+    lexer.lexer(&stream);
+    lex_stream->setMessageHandler(nullptr);
+
+    Lexed lexed;
+    for (int i = 0; i < stream.getSize(); i++)
+        lexed.tokens.push_back({ stream.getKind(i), stream.getStartOffset(i), stream.getEndOffset(i) });
+    for (int i = 0; i < stream.getAdjuncts().size(); i++)
+    {
+        IToken* adjunct = stream.getAdjunctAt(i);
+        lexed.adjuncts.push_back({ adjunct->getKind(), adjunct->getStartOffset(), adjunct->getEndOffset(),
+                                   adjunct->getTokenIndex() });
+    }
+    lexed.errors = errors.places;
+    return lexed;
+}
+
+//
+// The lexers of Java, of LPG and of expressions give the same tokens,
+// adjuncts and lexical errors with their DFA (LexerDfa) as without it, on
+// inputs with comments, literals, lexical errors and unterminated tokens.
+//
+static void testLexerDfa()
+{
+    const char* test = "lexer-dfa";
+
+    std::wstring long_java;
+    for (int i = 0; i < 300; i++)
+        long_java += L"    /** f" + std::to_wstring(i) + L" */ double f" + std::to_wstring(i) + L" = 0x" +
+                     std::to_wstring(i) + L"L + " + std::to_wstring(i) + L".5e-3f; // \u00e9t\u00e9\n";
+    for (const std::wstring& text : std::vector<std::wstring>{
+             javaInput,
+             L"class C { String s = \"a\\tb\\\"c\"; char c = '\\n'; int \\u0061 = 1 >>>= 2; }",
+             L"class Errors { int a = 1 # 2; char c = 'ab'; String s = \"open\n; }",
+             L"/* a comment that is never closed\nclass C {}",
+             L"class C { } // the last line has no end",
+             L"class C" + std::wstring(1, L'{') + L"\n" + long_java + L"}",
+             L"\n" })
+    {
+        shared_ptr_wstring source;
+        source = text;
+        JavaLexer dfa_lexer(source, L"Dfa.java", 4),
+                  automaton_lexer(source, L"Automaton.java", 4);
+        check(dfa_lexer.getParser()->dfa.enabled, test, "the Java lexer does not use its DFA");
+        check(lexWith(dfa_lexer, dfa_lexer.getILexStream(), true) ==
+                  lexWith(automaton_lexer, automaton_lexer.getILexStream(), false),
+              test, "the Java lexer gives other tokens with its DFA");
+    }
+
+    for (const wchar_t* text : {
+             L"%options package=expr,template=dtParserTemplateD.g\n"
+             L"-- a comment\n"
+             L"%Terminals\n    PLUS ::= '+'\n    LPAREN ::= '('\n%End\n"
+             L"%Rules\n    E ::= E '+' T\n        /.$setResult(new Plus($getSym(1), $getSym(3)));./\n"
+             L"      | T\n    T ::= IntegerLiteral$lit\n%End\n",
+             L"%Headers\n    /:int x = 1;:/\n%End\n$Header\n/. // $rule_text\n./\n",
+             L"%Rules\n    A ::= 'unterminated\n    B ::= \"also\n%End\n",
+             L"%Rules A ::= \x01 \x7f \u00e9 ::?= -- /. never closed",
+             L"\n" })
+    {
+        shared_ptr_wstring source;
+        source = text;
+        LPGLexer dfa_lexer(source, L"Dfa.g", 4),
+                 automaton_lexer(source, L"Automaton.g", 4);
+        check(dfa_lexer.getParser()->dfa.enabled, test, "the LPG lexer does not use its DFA");
+        check(lexWith(dfa_lexer, dfa_lexer.getILexStream(), true) ==
+                  lexWith(automaton_lexer, automaton_lexer.getILexStream(), false),
+              test, "the LPG lexer gives other tokens with its DFA");
+    }
+
+    for (const wchar_t* text : { L"(1+2)*3+4*(5+6)", L"  12 +\t345 * ( 6789 )\n", L"1 $ 2 @", L"((((", L"\n" })
+    {
+        shared_ptr_wstring source;
+        source = text;
+        ExprLexer dfa_lexer(source, L"dfa.expr"),
+                  automaton_lexer(source, L"automaton.expr");
+        check(dfa_lexer.getParser()->dfa.enabled, test, "the expression lexer does not use its DFA");
+        check(lexWith(dfa_lexer, &dfa_lexer, true) == lexWith(automaton_lexer, &automaton_lexer, false),
+              test, "the expression lexer gives other tokens with its DFA");
+    }
+}
+
+//
+// The dense rows of a table (DenseActionRows) hold the actions of its
+// compressed tables, whatever their budget, and the lexers and parsers
+// reset after they are installed read them.
+//
+static void testDenseRows()
+{
+    const char* test = "dense-rows";
+
+    for (ParseTable* prs : { JavaLexer::prs, JavaParser::prsTable, ExprLexer::prs })
+    {
+        std::vector<int> states = DenseActionRows::states(prs),
+                         visits(prs->getAcceptAction());
+        for (size_t i = 0; i < states.size(); i += 3)
+            visits[states[i]] = static_cast<int>(i);
+        size_t row_size = DenseActionRows::rowSize(prs);
+        check(DenseActionRows::fromBudget(prs, 7 * row_size)->count <= 7, test, "the rows exceed their budget");
+        for (auto rows : { DenseActionRows::fromBudget(prs, row_size), DenseActionRows::fromBudget(prs, 7 * row_size),
+                           DenseActionRows::fromBudget(prs, 1 << 24), DenseActionRows::fromProfile(prs, visits, 5 * row_size),
+                           DenseActionRows::fromStates(prs, { states[states.size() / 2], states.back() }) })
+        {
+            check(rows->count > 0 && rows->actions.size() == size_t(rows->count) * rows->width, test,
+                  "the rows do not have their size");
+            for (int state : states)
+            {
+                unsigned row = unsigned(state - rows->firstState);
+                for (int sym = 0; row < unsigned(rows->count) && sym < rows->width; sym++)
+                    check(rows->actions[row * rows->width + sym] == prs->tAction(state, sym), test,
+                          "a dense action differs");
+            }
+        }
+    }
+
+    shared_ptr_wstring expression;
+    expression = L"(1+2)*3+4*(5+6) $ 7";
+    ExprLexer compressed_lexer(expression, L"compressed.expr");
+    Lexed expected = lexWith(compressed_lexer, &compressed_lexer, false);
+    auto rows = DenseActionRows::fromBudget(ExprLexer::prs, 1 << 20);
+    DenseActionRows::install(ExprLexer::prs, rows);
+    ExprLexer dense_lexer(expression, L"dense.expr");
+    check(lexWith(dense_lexer, &dense_lexer, false) == expected, test,
+          "the expression lexer gives other tokens with dense rows");
+    auto error_rows = std::make_shared<DenseActionRows>(*rows);
+    std::fill(error_rows->actions.begin(), error_rows->actions.end(), ExprLexer::prs->getErrorAction());
+    DenseActionRows::install(ExprLexer::prs, error_rows);
+    ExprLexer error_lexer(expression, L"error.expr");
+    check(!(lexWith(error_lexer, &error_lexer, false) == expected), test,
+          "the expression lexer does not read the rows installed after it was first reset");
+    DenseActionRows::install(ExprLexer::prs, nullptr);
+
+    shared_ptr_wstring source;
+    source = javaInput;
+    JavaLexer lexer(source, L"Parsed.java", 4);
+    JavaParser compressed_parser(lexer.getILexStream());
+    lexer.lexer(nullptr, compressed_parser.getIPrsStream());
+    auto compressed_tree = compressed_parser.parser();
+    DenseActionRows::install(JavaParser::prsTable, DenseActionRows::fromBudget(JavaParser::prsTable, 64 * 1024));
+    JavaParser dense_parser(lexer.getILexStream());
+    lexer.lexer(nullptr, dense_parser.getIPrsStream());
+    auto dense_tree = dense_parser.parser();
+    DenseActionRows::install(JavaParser::prsTable, nullptr);
+    check(compressed_tree != nullptr && dense_tree != nullptr && compressed_tree->toString() == dense_tree->toString(),
+          test, "the Java trees differ with dense rows");
+}
+
+struct Test
+{
+    const char* name;
+    void (*run)();
+};
+
+static const std::vector<Test> tests = {
+    { "recognize-cancelled", testRecognizeCancelled },
+    { "direct-actions", testDirectActions },
+    { "direct-parse", testDirectParse },
+    { "other-tables", testOtherTables },
+    { "bad-table-files", testBadTableFiles },
+    { "token-store", testTokenStore },
+    { "file-input", testFileInput },
+    { "pipelined-errors", testPipelinedErrors },
+    { "parallel-lexer", testParallelLexer },
+    { "concurrent-positions", testConcurrentPositions },
+    { "token-positions", testTokenPositions },
+    { "lexer-dfa", testLexerDfa },
+    { "dense-rows", testDenseRows },
+};
+
+int main(int argc, char* argv[])
+{
+    int count = 0;
+    for (const Test& test : tests)
+    {
+        if (argc > 1 && strncmp(test.name, argv[1], strlen(argv[1])) != 0)
+            continue;
+        test.run();
+        count++;
+    }
+    std::cout << count << " tests, " << failures << " failed checks" << std::endl;
+    return failures;
+}